@@ -0,0 +1,133 @@
+//============================================================================
+//                                  I B E X
+// File        : arith_bench.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+/*
+ * Micro-benchmark of the underlying interval arithmetic on Eval (forward
+ * evaluation) and HC4Revise (forward-backward contraction).
+ *
+ * Only one interval library is linked with Ibex, so this program has to be
+ * run once with each configuration, e.g.:
+ *
+ *   ./waf configure --with-gaol=     ...   ./__build__/examples/arith_bench
+ *   ./waf configure --with-filib=    ...   ./__build__/examples/arith_bench
+ *   ./waf configure --with-native-itv ...  ./__build__/examples/arith_bench
+ *
+ * usage: arith_bench [nb_iter]
+ */
+
+#include "ibex.h"
+#include <stdlib.h>
+
+using namespace std;
+using namespace ibex;
+
+const char* interval_lib() {
+#ifdef _IBEX_WITH_GAOL_
+	return "gaol";
+#endif
+#ifdef _IBEX_WITH_BIAS_
+	return "Profil/Bias";
+#endif
+#ifdef _IBEX_WITH_FILIB_
+	return "filib";
+#endif
+#ifdef _IBEX_WITH_NATIVE_
+	return "native";
+#endif
+}
+
+void bench(const char* name, Function& f, const IntervalVector& box, const Interval& y, int nb_iter) {
+
+	Interval sum;
+
+	Timer::start();
+	for (int i=0; i<nb_iter; i++) {
+		sum=f.eval(box);
+	}
+	Timer::stop();
+	double t_eval=Timer::VIRTUAL_TIMELAPSE();
+
+	Timer::start();
+	for (int i=0; i<nb_iter; i++) {
+		IntervalVector x(box);
+		try {
+			f.backward(y,x);
+		} catch(EmptyBoxException&) { }
+	}
+	Timer::stop();
+	double t_hc4=Timer::VIRTUAL_TIMELAPSE();
+
+	cout << "  " << name << "\t eval: " << t_eval << "s\t HC4Revise: " << t_hc4 << "s" << endl;
+}
+
+int main(int argc, char** argv) {
+
+	int nb_iter= argc>1 ? atoi(argv[1]) : 100000;
+
+	cout << "interval arithmetic: " << interval_lib() << " (" << nb_iter << " iterations)" << endl;
+
+	{
+		// polynomial (only +,-,*, sqr)
+		Variable x,y,z;
+		Function f(x,y,z,sqr(x)*y-2*x*y*z+pow(z,3)-x*(y-z)+1);
+		bench("polynomial",f,IntervalVector(3,Interval(-1,2)),Interval(-1,1),nb_iter);
+	}
+
+	{
+		// rational
+		Variable x,y;
+		Function f(x,y,(x+y)/(1+sqr(x))-x*y/(2+sqr(y)));
+		bench("rational  ",f,IntervalVector(2,Interval(-1,2)),Interval(0,1),nb_iter);
+	}
+
+	{
+		// transcendental
+		Variable x,y;
+		Function f(x,y,exp(x)*cos(y)-log(1+sqr(x))+sin(x*y)+atan(y));
+		bench("transcend.",f,IntervalVector(2,Interval(-1,2)),Interval(0,1),nb_iter);
+	}
+
+	{
+		// vector-valued (Brown-like system)
+		const int n=10;
+		Variable x(n);
+		Array<const ExprNode> c(n);
+		const ExprNode* sum=&x[0];
+		for (int i=1; i<n; i++) sum=&(*sum+x[i]);
+		const ExprNode* prod=&x[0];
+		for (int i=1; i<n; i++) prod=&(*prod*x[i]);
+		for (int i=0; i<n-1; i++) c.set_ref(i,x[i]+*sum-(n+1));
+		c.set_ref(n-1,*prod-1);
+		Function f(x,ExprVector::new_(c,false));
+
+		IntervalVector box(n,Interval(-1,2));
+
+		Timer::start();
+		for (int i=0; i<nb_iter; i++) {
+			f.eval_vector(box);
+		}
+		Timer::stop();
+		double t_eval=Timer::VIRTUAL_TIMELAPSE();
+
+		Timer::start();
+		for (int i=0; i<nb_iter; i++) {
+			IntervalVector x(box);
+			try {
+				f.backward(IntervalVector(n,Interval::ZERO),x);
+			} catch(EmptyBoxException&) { }
+		}
+		Timer::stop();
+		double t_hc4=Timer::VIRTUAL_TIMELAPSE();
+
+		cout << "  brown-10  \t eval: " << t_eval << "s\t HC4Revise: " << t_hc4 << "s" << endl;
+	}
+
+	return 0;
+}
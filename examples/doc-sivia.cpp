@@ -72,19 +72,18 @@ int main() {
 	box[1]=Interval(-10,10);
 
 	// Run the paver
-	SubPaving* paving=p.pave(box);
+	Paving paving(box);
+	p.pave(paving);
 
 	// Display the paving
-	// each box ([lx,ux],[ly,uy]) contracted by contractor n°i is displayed like this:
+	// each box ([lx,ux],[ly,uy]) removed by contractor n°i is displayed like this:
 	// lx ux ly uy i
 	for (int i=0; i<3; i++) {
-		for (std::vector<std::pair<IntervalVector,IntervalVector> >::const_iterator it=paving[i].traces.begin(); it!=paving[i].traces.end(); it++) {
-			IntervalVector *boxes;
-			int size=it->first.diff(it->second,boxes);
-			for (int j=0; j<size; j++) {
-				cout << boxes[j][0].lb() << " " << boxes[j][0].ub() << " " <<
-						boxes[j][1].lb() << " " << boxes[j][1].ub() << " " << i << endl;
-			}
+		std::vector<IntervalVector> boxes;
+		paving.boxes(i,boxes);
+		for (std::vector<IntervalVector>::const_iterator it=boxes.begin(); it!=boxes.end(); it++) {
+			cout << (*it)[0].lb() << " " << (*it)[0].ub() << " " <<
+					(*it)[1].lb() << " " << (*it)[1].ub() << " " << i << endl;
 		}
 	}
 
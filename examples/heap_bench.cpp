@@ -0,0 +1,86 @@
+//============================================================================
+//                                  I B E X
+// File        : heap_bench.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+/*
+ * Time spent in the buffer of the optimizer (CellDoubleHeap) on a
+ * simulated search: n random open nodes are first pushed; then, at
+ * each of the n iterations, one node is popped (alternately from the
+ * first or the second heap) and replaced by two new nodes. Every 1000
+ * iterations, the loup decreases (linearly, up to the half of the initial
+ * range of the objective) and the heaps are contracted.
+ *
+ * usage: heap_bench [n] [crit]
+ *
+ * crit is the criterion of the second heap (0=LB, 1=UB, 2=C3, 3=C5,
+ * 4=C7, 5=PU), 2 by default.
+ */
+
+#include "ibex.h"
+#include <stdlib.h>
+
+using namespace std;
+using namespace ibex;
+
+/*
+ * A random node. The objective is the last variable.
+ */
+OptimCell* node() {
+	IntervalVector box(3);
+	double lb=rand()%1000000;
+	box[2]=Interval(lb,lb+rand()%1000);
+	OptimCell* c=new OptimCell(box);
+	c->pf=box[2];
+	c->pu=1;
+	return c;
+}
+
+int main(int argc, char** argv) {
+
+	int n=argc>1 ? atoi(argv[1]) : 100000;
+	int crit=argc>2 ? atoi(argv[2]) : 2;
+
+	srand(1);
+
+	CellDoubleHeap buffer(2,(CellDoubleHeap::criterion) crit);
+
+	Timer::start();
+
+	for (int i=0; i<n; i++)
+		buffer.push(node());
+
+	Timer::stop();
+	double t_fill=Timer::VIRTUAL_TIMELAPSE();
+	Timer::start();
+
+	for (int i=0; i<n; i++) {
+		OptimCell* c;
+		if (i%2) {
+			c=buffer.top();
+			buffer.pop();
+		} else {
+			c=buffer.top2();
+			buffer.pop2();
+		}
+		delete c;
+		buffer.push(node());
+		buffer.push(node());
+		if (i%1000==0)
+			buffer.contract_heap(1e6*(1-0.5*i/n));
+	}
+
+	Timer::stop();
+
+	cout << "nodes=" << n << " fill=" << t_fill << "s search=" << Timer::VIRTUAL_TIMELAPSE()
+		 << "s remaining=" << buffer.size() << endl;
+
+	buffer.flush();
+
+	return 0;
+}
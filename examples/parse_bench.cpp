@@ -0,0 +1,129 @@
+//============================================================================
+//                                  I B E X
+// File        : parse_bench.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+/*
+ * Parse throughput of the (reentrant) parser: all the .bch files of a
+ * directory tree are loaded in memory and then parsed (System(buffer,size))
+ * by 1, 2, 4, ..., N threads.
+ *
+ * usage: parse_bench [nb_threads] [dir]
+ *
+ * (by default, 4 threads and the ../benchs directory)
+ */
+
+#include "ibex.h"
+#include <stdlib.h>
+#include <string.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <pthread.h>
+#include <fstream>
+#include <sstream>
+
+using namespace std;
+using namespace ibex;
+
+/* Load all the .bch files under "dir" in memory. */
+void load_files(const string& dir, vector<string>& names, vector<string>& sources) {
+	DIR* d=opendir(dir.c_str());
+	if (!d) return;
+	struct dirent* e;
+	while ((e=readdir(d))!=NULL) {
+		if (strcmp(e->d_name,".")==0 || strcmp(e->d_name,"..")==0) continue;
+		string path=dir+"/"+e->d_name;
+		struct stat st;
+		if (stat(path.c_str(),&st)!=0) continue;
+		if (S_ISDIR(st.st_mode))
+			load_files(path,names,sources);
+		else if (path.size()>4 && path.compare(path.size()-4,4,".bch")==0) {
+			ifstream f(path.c_str());
+			stringstream s;
+			s << f.rdbuf();
+			names.push_back(path);
+			sources.push_back(s.str());
+		}
+	}
+	closedir(d);
+}
+
+struct Work {
+	const vector<string>* sources;
+	int next;               // next file to parse
+	pthread_mutex_t lock;
+	int nb_errors;
+};
+
+void* parse_files(void* arg) {
+	Work& w=*((Work*) arg);
+	for (;;) {
+		pthread_mutex_lock(&w.lock);
+		int i=w.next++;
+		pthread_mutex_unlock(&w.lock);
+		if (i>=(int) w.sources->size()) break;
+
+		const string& src=(*w.sources)[i];
+		try {
+			System sys(src.c_str(),src.size());
+		} catch(SyntaxError&) {
+			pthread_mutex_lock(&w.lock);
+			w.nb_errors++;
+			pthread_mutex_unlock(&w.lock);
+		}
+	}
+	return NULL;
+}
+
+/* Parse all the sources with n threads; return the (real) time. */
+double bench(const vector<string>& sources, int n, int& nb_errors) {
+	Work w;
+	w.sources=&sources;
+	w.next=0;
+	w.nb_errors=0;
+	pthread_mutex_init(&w.lock,NULL);
+
+	vector<pthread_t> threads(n);
+	Timer::start();
+	for (int i=0; i<n; i++)
+		pthread_create(&threads[i],NULL,parse_files,&w);
+	for (int i=0; i<n; i++)
+		pthread_join(threads[i],NULL);
+	Timer::stop(Timer::__REAL);
+
+	pthread_mutex_destroy(&w.lock);
+	nb_errors=w.nb_errors;
+	return Timer::REAL_TIMELAPSE();
+}
+
+int main(int argc, char** argv) {
+
+	int nb_threads= argc>1 ? atoi(argv[1]) : 4;
+	string dir= argc>2 ? argv[2] : "../benchs";
+
+	vector<string> names, sources;
+	load_files(dir,names,sources);
+
+	size_t bytes=0;
+	for (size_t i=0; i<sources.size(); i++) bytes+=sources[i].size();
+	cout << sources.size() << " files (" << bytes/1024 << " KB) in " << dir << endl;
+	if (sources.empty()) return 0;
+
+	double t1=0;
+	for (int n=1; n<=nb_threads; n= n<nb_threads ? std::min(2*n,nb_threads) : n+1) {
+		int nb_errors;
+		double t=bench(sources,n,nb_errors);
+		if (n==1) t1=t;
+		cout << "  " << n << " thread(s): " << t << "s  ";
+		cout << sources.size()/t << " files/s  speedup=" << t1/t;
+		if (nb_errors>0) cout << "  (" << nb_errors << " syntax errors)";
+		cout << endl;
+	}
+
+	return 0;
+}
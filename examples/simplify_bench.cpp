@@ -0,0 +1,117 @@
+//============================================================================
+//                                  I B E X
+// File        : simplify_bench.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+/*
+ * Effect of the simplification of the expressions (ExprSimplify) on the
+ * system function and its derivative: number of nodes and evaluation time,
+ * with and without simplification.
+ *
+ * usage: simplify_bench [nb_iter] [file.bch ...]
+ *
+ * (without bch file, a built-in problem is used).
+ */
+
+#include "ibex.h"
+#include <stdlib.h>
+
+using namespace std;
+using namespace ibex;
+
+/*
+ * Function of the system built without simplification
+ * (concatenation of the constraints).
+ */
+Function* raw_function(const System& sys) {
+	Array<const ExprSymbol> x(sys.args.size());
+	varcopy(sys.args,x);
+
+	Array<const ExprNode> image(sys.f.image_dim());
+	int i=0;
+	for (int j=0; j<sys.ctrs.size(); j++) {
+		Function& fj=sys.ctrs[j].f;
+		if (fj.image_dim()==1)
+			image.set_ref(i++,ExprCopy().copy(fj.args(), x, fj.expr()));
+		else
+			for (int k=0; k<fj.image_dim(); k++)
+				image.set_ref(i++,ExprCopy().index_copy(fj.args(), x, fj.expr(), k));
+	}
+	return new Function(x, image.size()>1? ExprVector::new_(image,false) : image[0]);
+}
+
+/*
+ * Derivative built without simplification.
+ */
+Function* raw_diff(const Function& f) {
+	Array<const ExprSymbol> x(f.nb_arg());
+	varcopy(f.args(),x);
+	return new Function(x, ExprDiff().diff(f.args(),x,f.expr()));
+}
+
+double eval_time(const Function& f, const IntervalVector& box, int nb_iter) {
+	Timer::start();
+	for (int i=0; i<nb_iter; i++) {
+		switch (f.expr().dim.type()) {
+		case Dim::SCALAR:     f.eval(box); break;
+		case Dim::ROW_VECTOR:
+		case Dim::COL_VECTOR: f.eval_vector(box); break;
+		default:              f.eval_matrix(box);
+		}
+	}
+	Timer::stop();
+	return Timer::VIRTUAL_TIMELAPSE();
+}
+
+void report(const char* name, const Function& raw, const Function& f, const IntervalVector& box, int nb_iter) {
+	cout << "  " << name << "\t nodes: " << raw.nb_nodes() << " -> " << f.nb_nodes();
+	cout << "\t eval: " << eval_time(raw,box,nb_iter) << "s -> " << eval_time(f,box,nb_iter) << "s" << endl;
+}
+
+void bench(const char* name, const System& sys, int nb_iter) {
+	cout << name << endl;
+
+	Function* raw_f=raw_function(sys);
+	report("f ",*raw_f,sys.f,sys.box,nb_iter);
+
+	Function* raw_df=raw_diff(sys.f);
+	Function df(sys.f,Function::DIFF);
+	report("df",*raw_df,df,sys.box,nb_iter);
+
+	delete raw_df;
+	delete raw_f;
+}
+
+int main(int argc, char** argv) {
+
+	int nb_iter= argc>1 ? atoi(argv[1]) : 10000;
+
+	if (argc>2) {
+		for (int i=2; i<argc; i++) {
+			System sys(argv[i]);
+			bench(argv[i],sys,nb_iter);
+		}
+		return 0;
+	}
+
+	// built-in problem: chain of coupled trigonometric equations
+	const int n=10;
+	Variable x(n);
+	SystemFactory fac;
+	fac.add_var(x);
+	for (int i=0; i<n; i++) {
+		const ExprNode& xi=x[i];
+		const ExprNode& xj=x[(i+1)%n];
+		fac.add_ctr(sqr(sin(xi*xj))+cos(xi*xj)*xi-1*xj+0*xi=0);
+	}
+	System sys(fac);
+	sys.box=IntervalVector(n,Interval(-1,1));
+	bench("built-in",sys,nb_iter);
+
+	return 0;
+}
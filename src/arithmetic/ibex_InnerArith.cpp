@@ -5,13 +5,14 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Jul 2, 2012
-// Last Update : Jul 2, 2012
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_InnerArith.h"
 
 #include <stdlib.h>
 #include <cassert>
+#include <fenv.h>
 
 using namespace std;
 
@@ -77,29 +78,39 @@ Interval eval(const Interval& x, const Interval& y, int op) {
   }
 }
 
+/*
+ * Note: the rounding mode is restored before returning
+ * (the native arithmetic requires the round-to-nearest mode).
+ */
 double projx(double z, double y, int op, bool round_up) {
+  int mode=fegetround();
   (round_up)? fpu_round_up() : fpu_round_down();
+  volatile double x;
   switch(op) {
-    case ADD: return z-y;
-    case SUB: return z+y;
-    case MUL: return (y==0)? POS_INFINITY:z/y;
-    default:  return z*y;
+    case ADD: x=z-y; break;
+    case SUB: x=z+y; break;
+    case MUL: x=(y==0)? POS_INFINITY:z/y; break;
+    default:  x=z*y;
   }
-  //fpu_round_near(); // unreachable!
+  fesetround(mode);
+  return x;
 }
 
 double projy(double z, double x, int op, bool round_up) {
+  int mode=fegetround();
   (round_up)? fpu_round_up() : fpu_round_down();
+  volatile double y;
   switch(op) {
-    case ADD: return z-x;
-    case SUB: return x-z;
+    case ADD: y=z-x; break;
+    case SUB: y=x-z; break;
     case MUL:
     	//assert(z!=0); // z==0 should not appear
     	assert(x!=0); // x==0 should not appear
-    	return z/x;
-    default: return (z==0)? POS_INFINITY:x/z;
+    	y=z/x; break;
+    default: y=(z==0)? POS_INFINITY:x/z;
   }
-  //fpu_round_near(); // unreachable!
+  fesetround(mode);
+  return y;
 }
 
 
@@ -204,7 +215,6 @@ bool ibwd_cmp_mono_op(bool geq, double z, Interval& x, Interval& y, const Interv
 	if ((inc_var1 && xmin > x.ub()) || (!inc_var1 && xmax < x.lb())) {
 		// this may happen including with inflate mode.
 		// e.g.: x=<1,1>, y=[0,eps] and z=1. then xmax<1.
-		if (!inc_var1) fpu_round_up(); // default mode. TODO: valid for gaol and... ?
 				if (inflate) {x=xin; y=yin; return true;}
 		else {
 		x.set_empty();
@@ -223,7 +233,6 @@ bool ibwd_cmp_mono_op(bool geq, double z, Interval& x, Interval& y, const Interv
 			if (inc_var1) { if (xmax>xin.lb()) xmax=xin.lb(); }
 			else          { if (xmin<xin.ub()) xmin=xin.ub(); }
 			if (xmin>xmax) {
-				if (!inc_var1) fpu_round_up(); // default mode. TODO: valid for gaol and... ?
 				x=xin;
 				y=yin;
 				return true;
@@ -248,7 +257,6 @@ bool ibwd_cmp_mono_op(bool geq, double z, Interval& x, Interval& y, const Interv
 
 	x = (inc_var1)? Interval(x0,x.ub()):Interval(x.lb(),x0);
 
-	if (!inc_var1 || !inc_var2) fpu_round_up(); // default mode. TODO: valid for gaol and... ?
 	// [gch] if op==MUL and z=0 we have y=[0,0]
 	// and x=[x^-,x0] (or x=[x0,x^+]) which is correct in both
 	// case although we could take x entirely in this case.
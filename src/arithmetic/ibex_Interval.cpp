@@ -21,6 +21,10 @@
 #else
 #ifdef _IBEX_WITH_FILIB_
 #include "ibex_filib_Interval.cpp_"
+#else
+#ifdef _IBEX_WITH_NATIVE_
+#include "ibex_native_Interval.cpp_"
+#endif
 #endif
 #endif
 #endif
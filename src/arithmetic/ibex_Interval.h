@@ -18,7 +18,7 @@
 /* ========================================================*/
 /* The following header file is automatically generated by
  * the compilation. It only contains the definition of
- * _IBEX_WITH_GAOL_ or _IBEX_WITH_BIAS_ */
+ * _IBEX_WITH_GAOL_, _IBEX_WITH_BIAS_, _IBEX_WITH_FILIB_ or _IBEX_WITH_NATIVE_ */
 #include "ibex_Setting.h"
 /* ======================================================= */
 
@@ -62,6 +62,14 @@
 //	#define POS_INFINITY filib::primitive::compose(0,0x7FE,(1 << 21)-1,0xffffffff)
 	/** \brief IBEX_NAN: <double> representation of NaN */
 	#define IBEX_NAN filib::primitive::compose(0,0x7FF,1 << 19,0)
+#else
+#ifdef _IBEX_WITH_NATIVE_
+	#include "ibex_native_Itv.h_"
+	/** \brief NEG_INFINITY: <double> representation of -oo */
+	#define NEG_INFINITY (-HUGE_VAL)
+	/** \brief POS_INFINITY: <double> representation of +oo */
+	#define POS_INFINITY HUGE_VAL
+#endif
 #endif
 #endif
 #endif
@@ -119,7 +127,7 @@ double next_float(double x);
  * \brief Interval
  *
  * This class defines the interval interface of IBEX and encapsulates an interval "itv" whose
- * type depends on the chosen implementation (currently: Gaol, Bias of filib).
+ * type depends on the chosen implementation (currently: Gaol, Bias, filib or the native arithmetic).
  *
  * Note that some functions of the Gaol interval interface do not appear here (like "possibly relations")
  * because there are not used by ibex; while other have been introduced (like "ratio_delta"). Some
@@ -521,6 +529,15 @@ class Interval {
 
     FI_INTERVAL itv;
 
+#else
+#ifdef _IBEX_WITH_NATIVE_
+	/* \brief Wrap the native interval [x]. */
+    Interval(const native::interval& x);
+    /* \brief Assign this to the native interval [x]. */
+    Interval& operator=(const native::interval& x);
+
+    native::interval itv;
+#endif
 #endif
 #endif
 #endif
@@ -840,6 +857,10 @@ bool bwd_integer(Interval& x);
 #else
 #ifdef _IBEX_WITH_FILIB_
 #include "ibex_filib_Interval.h_"
+#else
+#ifdef _IBEX_WITH_NATIVE_
+#include "ibex_native_Interval.h_"
+#endif
 #endif
 #endif
 #endif
@@ -948,6 +969,10 @@ inline double distance(const Interval &x1, const Interval &x2) {
 #else
 #ifdef _IBEX_WITH_FILIB_
     	return x1.itv.dist(x2.itv);
+#else
+#ifdef _IBEX_WITH_NATIVE_
+    	return hausdorff(x1,x2);
+#endif
 #endif
 #endif
 #endif
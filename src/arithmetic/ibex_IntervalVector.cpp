@@ -281,6 +281,7 @@ double          IntervalVector::perimeter() const
 double          IntervalVector::rel_distance(const IntervalVector& x) const       { return _rel_distance(*this,x); }
 Vector          IntervalVector::random(int seed) const                            { return _random<IntervalVector,Interval>(*this,seed); }
 Vector          IntervalVector::random() const                            		  { return _random<IntervalVector,Interval>(*this); }
+void            IntervalVector::random(Vector& pt) const                          { _random<IntervalVector,Interval>(*this,pt); }
 std::pair<IntervalVector,IntervalVector> IntervalVector::bisect(int i, double ratio) const  { return _bisect(*this, i, ratio); }
 
 
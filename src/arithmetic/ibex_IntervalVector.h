@@ -504,6 +504,16 @@ public:
 	Vector random(int seed) const;
 	Vector random() const;
 
+	/**
+	 * \brief Set \a pt to a random vector inside *this.
+	 *
+	 * Same as random() but \a pt is overwritten instead of
+	 * allocating a new vector.
+	 *
+	 * \pre (*this) must be nonempty and \a pt must have the same size.
+	 */
+	void random(Vector& pt) const;
+
 	/**
 	 * \brief (*this)+=x2.
 	 */
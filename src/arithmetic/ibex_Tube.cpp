@@ -9,32 +9,67 @@
  * Created     : Oct 7, 2013
  * ---------------------------------------------------------------------------- */
 
-#define __IBEX_TUBE_H__
-#ifndef __IBEX_TUBE_H__ // The class Tube is not ready !!!
-
 #include "ibex_Tube.h"
 #include "assert.h"
 
 namespace ibex {
 
+namespace {
+
+/*
+ * Hull/sum of the leaves [l,r) of a tree with n leaves
+ * (see Tube::_hull and Tube::_sum).
+ */
+Interval range_hull(const std::vector<Interval>& tree, int n, int l, int r) {
+	Interval res(Interval::EMPTY_SET);
+	for (l+=n, r+=n; l<r; l>>=1, r>>=1) {
+		if (l&1) res |= tree[l++];
+		if (r&1) res |= tree[--r];
+	}
+	return res;
+}
+
+Interval range_sum(const std::vector<Interval>& tree, int n, int l, int r) {
+	Interval res(0,0);
+	for (l+=n, r+=n; l<r; l>>=1, r>>=1) {
+		if (l&1) res += tree[l++];
+		if (r&1) res += tree[--r];
+	}
+	return res;
+}
+
+/*
+ * Values of f(t) on the n slices of step "step" starting from t0.
+ */
+void eval_slices(const Function& f, double t0, double step, Interval* res, int n) {
+	assert((f.nb_var()==1)&&(f.nb_arg()==1));
+	IntervalVector t(1);
+	for (int i=0; i<n; i++) {
+		t[0]=Interval(t0+i*step,t0+(i+1)*step);
+		res[i]=f.eval(t);
+	}
+}
+
+}
+
 Tube::Tube(double t0, double tf, double step, const Interval& x) :
-						IntervalVector((int)round(((tf - t0) / step)), x), _t0(t0), _tf(tf), _deltaT(step) {
+						IntervalVector((int)round(((tf - t0) / step)), x), _t0(t0), _tf(tf), _deltaT(step), _tree_ok(false), _dirty_lb(0), _dirty_ub(size()-1), _deriv_f(NULL), _deriv_t0(0), _deriv_dt(0) {
 }
 
 Tube::Tube(double t0, double tf, double step, const IntervalVector& x) :
-						IntervalVector(x), _t0(t0), _tf(tf), _deltaT(step) {
+						IntervalVector(x), _t0(t0), _tf(tf), _deltaT(step), _tree_ok(false), _dirty_lb(0), _dirty_ub(size()-1), _deriv_f(NULL), _deriv_t0(0), _deriv_dt(0) {
 }
 
 Tube::Tube(double t0, double tf, double step, double bounds[][2]) :
-						IntervalVector((int)round(((tf - t0) / step)), bounds), _t0(t0), _tf(tf), _deltaT(step) {
+						IntervalVector((int)round(((tf - t0) / step)), bounds), _t0(t0), _tf(tf), _deltaT(step), _tree_ok(false), _dirty_lb(0), _dirty_ub(size()-1), _deriv_f(NULL), _deriv_t0(0), _deriv_dt(0) {
 }
 
 Tube::Tube(double t0, double tf, double step, const Vector& x) :
-						IntervalVector(x), _t0(t0), _tf(tf), _deltaT(step) {
+						IntervalVector(x), _t0(t0), _tf(tf), _deltaT(step), _tree_ok(false), _dirty_lb(0), _dirty_ub(size()-1), _deriv_f(NULL), _deriv_t0(0), _deriv_dt(0) {
 }
 
 Tube::Tube(double t0, double tf, double step, const Function& fmin, const Function& fmax) :
-                				IntervalVector((int)round(((tf - t0) / step)), Interval::ALL_REALS),_t0(t0), _tf(tf), _deltaT(step) {
+                				IntervalVector((int)round(((tf - t0) / step)), Interval::ALL_REALS),_t0(t0), _tf(tf), _deltaT(step), _tree_ok(false), _dirty_lb(0), _dirty_ub(size()-1), _deriv_f(NULL), _deriv_t0(0), _deriv_dt(0) {
 
 	IntervalVector lx(1);
 	IntervalVector ux(1);
@@ -43,10 +78,73 @@ Tube::Tube(double t0, double tf, double step, const Function& fmin, const Functi
 		lx[0]= Interval(t0+i*step,t0+(i+1)*step);// FIXME A corriger pas robuste, idee stocke les temps dans un tableau pour eviter de les recalculer et d'accumuler des erreurs
 		ux[0]= Interval(t0+i*step,t0+(i+1)*step);
 
-		(*this)[i]=Interval(fmin.eval_vector(lx)[0].lb(),fmax.eval_vector(ux)[0].ub());
+		IntervalVector::operator[](i)=Interval(fmin.eval_vector(lx)[0].lb(),fmax.eval_vector(ux)[0].ub());
 	}
 }
 
+Tube::Tube(double t0, double tf, double step, const Function& f) :
+                				IntervalVector((int)round(((tf - t0) / step))),_t0(t0), _tf(tf), _deltaT(step), _tree_ok(false), _dirty_lb(0), _dirty_ub(size()-1), _deriv_f(NULL), _deriv_t0(0), _deriv_dt(0) {
+	eval_slices(f,t0,step,&IntervalVector::operator[](0),size());
+}
+
+void Tube::build_tree() const {
+	int n=size();
+	if (_tree_ok && (int) _hull.size()==2*n) return;
+
+	_hull.resize(2*n);
+	_sum.resize(2*n);
+	for (int i=0; i<n; i++) {
+		_hull[n+i]=(*this)[i];
+		_sum[n+i]=(*this)[i]*_deltaT;
+	}
+	for (int k=n-1; k>=1; k--) {
+		_hull[k]=_hull[2*k] | _hull[2*k+1];
+		_sum[k]=_sum[2*k] + _sum[2*k+1];
+	}
+	_tree_ok=true;
+}
+
+void Tube::update_slice(int i) {
+	if (i<_dirty_lb) _dirty_lb=i;
+	if (i>_dirty_ub) _dirty_ub=i;
+
+	int n=size();
+	if (!_tree_ok) return;
+	if ((int) _hull.size()!=2*n) { // resized in the meantime
+		_tree_ok=false;
+		return;
+	}
+
+	int k=n+i;
+	_hull[k]=(*this)[i];
+	_sum[k]=(*this)[i]*_deltaT;
+	for (k>>=1; k>=1; k>>=1) {
+		_hull[k]=_hull[2*k] | _hull[2*k+1];
+		_sum[k]=_sum[2*k] + _sum[2*k+1];
+	}
+}
+
+bool Tube::ctc_slice(int i, const Interval& x) {
+	Interval& xi=IntervalVector::operator[](i);
+	Interval old=xi;
+	xi &= x;
+	if (xi==old) return false;
+	update_slice(i);
+	return true;
+}
+
+void Tube::set(int i, const Interval& x) {
+	Interval& xi=IntervalVector::operator[](i);
+	if (xi==x) return;
+	xi=x;
+	update_slice(i);
+}
+
+Interval Tube::hull(int kmin, int kmax) const {
+	build_tree();
+	return range_hull(_hull,size(),kmin,kmax+1);
+}
+
 void Tube::set_t0(double t0, Interval inter) {
 	IntervalVector temp = (*this);
 
@@ -54,19 +152,20 @@ void Tube::set_t0(double t0, Interval inter) {
 		int diff = (int)round((_t0-t0)/_deltaT);
 		resize((_tf-t0)/_deltaT);
 		for(int i=0;i<size();i++) {
-			if(i<diff) (*this)[i]=inter;
-			else (*this)[i]=temp[i-diff];
+			if(i<diff) IntervalVector::operator[](i)=inter;
+			else IntervalVector::operator[](i)=temp[i-diff];
 		}
 	}
 	else {
 		int diff = (int)round((t0-_t0)/_deltaT);
 		resize((_tf-t0)/_deltaT);
 		for(int i=0;i<size();i++) {
-			(*this)[i]=temp[i+diff];
+			IntervalVector::operator[](i)=temp[i+diff];
 		}
 	}
 
 	_t0 = t0;
+	modified();
 }
 
 void Tube::set_t0(double t0) {
@@ -79,7 +178,7 @@ void Tube::set_tF(double tf, Interval inter) {
 	if(tf<get_tF()) {
 		resize((tf-_t0)/_deltaT);
 		for(int i=0;i<size();i++) {
-			(*this)[i]=temp[i];
+			IntervalVector::operator[](i)=temp[i];
 		}
 	}
 	else {
@@ -87,12 +186,13 @@ void Tube::set_tF(double tf, Interval inter) {
 		int orsize = temp.size();
 		resize((tf-_t0)/_deltaT);
 		for(int i=0;i<size();i++) {
-			if(i<orsize) (*this)[i]=temp[i];
-			else (*this)[i]=inter;
+			if(i<orsize) IntervalVector::operator[](i)=temp[i];
+			else IntervalVector::operator[](i)=inter;
 		}
 	}
 
 	_tf = tf;
+	modified();
 }
 
 void Tube::set_tF(double tf) {
@@ -101,18 +201,14 @@ void Tube::set_tF(double tf) {
 
 Interval Tube::at(const Interval& time) const {
 	assert(time.lb()>=_t0 && time.ub()<=_tf);
-	Interval temp(Interval::EMPTY_SET);
-	int first_idx=(int)round(time.lb()/_deltaT);
-	int last_idx=(int)round(time.ub()/_deltaT);
-	for(int i=first_idx;i<last_idx;i++) {
-		temp=temp|(*this)[i];
-	}
-	/*
-    for(double t=time.lb();t<time.ub();t+=_deltaT){
-        temp=temp|(*this)[(int)round((t-_t0)/_deltaT)];
-    }
-	 */
-	return temp;
+	// all the slices that intersect [t]
+	int first_idx=(int)floor((time.lb()-_t0)/_deltaT);
+	int last_idx=(int)ceil((time.ub()-_t0)/_deltaT)-1;
+	if (first_idx<0) first_idx=0;
+	if (first_idx>=size()) first_idx=size()-1;
+	if (last_idx<first_idx) last_idx=first_idx;
+	if (last_idx>=size()) last_idx=size()-1;
+	return hull(first_idx,last_idx);
 }
 
 
@@ -128,10 +224,8 @@ void Tube::resample(double new_deltaT) {
 		}
 	} else {
 		for(int i=0;i<temp.size();i++) {
-			temp[i]=Interval::EMPTY_SET;
-			for(int j=0;j<ratio;j++) {
-				temp[i]=temp[i]|(*this)[(i*ratio)+j];
-			}
+			int kmax=(int)round((i+1)*ratio)-1;
+			temp[i]=hull((int)round(i*ratio), kmax<size()? kmax : size()-1);
 		}
 	}
 
@@ -154,57 +248,64 @@ Tube& Tube::operator=(const Tube& x) {
 		_t0 = x._t0;
 		_tf = x._tf;
 		_deltaT = x._deltaT;
+		_hull = x._hull;
+		_sum = x._sum;
+		_tree_ok = x._tree_ok;
+		_dirty_lb = x._dirty_lb;
+		_dirty_ub = x._dirty_ub;
+		_deriv_f = x._deriv_f;
+		_deriv = x._deriv;
+		_deriv_t0 = x._deriv_t0;
+		_deriv_dt = x._deriv_dt;
 	}
 	return *this;
 }
 
 Tube& Tube::operator=(const IntervalVector& x) {
 	((IntervalVector&) *this)=x;
+	modified();
 	return *this;
 }
 
 Tube& Tube::operator &=(const Tube& x) {
 	__assert_tube_time_domain__(*this,x);
 	((IntervalVector&) (*this))&=x;
+	modified();
 	return *this;
 }
 
 Tube& Tube::operator |=(const Tube& x) {
 	__assert_tube_time_domain__(*this,x);
 	((IntervalVector&) (*this))|=x;
+	modified();
 	return *this;
 }
 
 double Tube::max() const {
-	if(is_unbounded()) return POS_INFINITY;
+	build_tree();
+	// the hull is unbounded iff one slice is unbounded
+	if(_hull[1].is_unbounded()) return POS_INFINITY;
 	if(is_empty()) return NEG_INFINITY; // BETA
-	double max = (*this)[0].ub();
-	for(int i=1; i<size(); i++) {
-		if((*this)[i].ub()>max) max = (*this)[i].ub();
-	}
-	return max;
+	return _hull[1].ub();
 }
 
 double Tube::min() const {
-	if(is_unbounded()) return -1000; // BETA
+	build_tree();
+	if(_hull[1].is_unbounded()) return -1000; // BETA
 	if(is_empty()) return 0; // BETA
-	double min = (*this)[0].lb();
-	for(int i=1; i<size(); i++){
-		if((*this)[i].lb()<min) min = (*this)[i].lb();
-	}
-	return min;
+	return _hull[1].lb();
 }
 
 Tube& Tube::ctcIn(double time, const Interval& in){
 	assert(time>=_t0 && time<=_tf);
-	(*this)[(int)round((time-_t0)/_deltaT)]&=in;
+	ctc_slice((int)round((time-_t0)/_deltaT),in);
 	return *this;
 }
 
 Tube& Tube::ctcIn(const Interval& time, const Interval& in){
 	assert(time.lb()>=_t0 && time.ub()<=_tf);
 	for(double t=time.lb();t<time.ub();t+=_deltaT){
-		(*this)[(int)round((t-_t0)/_deltaT)]&=in;
+		ctc_slice((int)round((t-_t0)/_deltaT),in);
 	}
 	return *this;
 }
@@ -212,7 +313,7 @@ Tube& Tube::ctcIn(const Interval& time, const Interval& in){
 Tube& Tube::ctcInter(const Tube& x){
 	__assert_tube_time_domain__(*this,x);
 	for(int i=0;i<size();i++){
-		(*this)[i] &= x[i];
+		ctc_slice(i,x[i]);
 	}
 	return *this;
 }
@@ -220,8 +321,9 @@ Tube& Tube::ctcInter(const Tube& x){
 Tube& Tube::ctcUnion(const Tube& x){
 	__assert_tube_time_domain__(*this,x);
 	for(int i=0;i<size();i++){
-		(*this)[i] |= x[i];
+		IntervalVector::operator[](i) |= x[i];
 	}
+	modified();
 	return *this;
 }
 
@@ -231,7 +333,7 @@ Tube& Tube::ctcSup(const Tube& x){
 	for(int i=0;i<size();i++){
 		intt=(*this)[i]; intx=x[i];
 		if(intt.lb() < intx.lb())
-			(*this)[i] = Interval(intx.lb(), intt.ub());
+			set(i,Interval(intx.lb(), intt.ub()));
 	}
 	return *this;
 }
@@ -242,49 +344,91 @@ Tube& Tube::ctcInf(const Tube& x){
 	for(int i=0;i<size();i++){
 		intt=(*this)[i]; intx=x[i];
 		if(intt.ub() > intx.ub())
-			(*this)[i] = Interval(intt.lb() , intx.ub());
+			set(i,Interval(intt.lb() , intx.ub()));
 	}
 	return *this;
 }
 
 
-Tube& Tube::ctcFwd(const Function& f) {
-	assert((f.nb_var()==1)&&(f.nb_arg()==1));
-	IntervalVector lx(1);
-	IntervalVector ux(1);
-	for(int i=0;i<(*this).size()-1;i++){
-		lx[0]= Interval(_t0+i*_deltaT,_t0+(i+1)*_deltaT);
-		ux[0]= Interval(_t0+i*_deltaT,_t0+(i+1)*_deltaT);
+const Interval* Tube::derivative(const Function& f) {
+	if (_deriv_f!=&f || (int) _deriv.size()!=size() || _deriv_t0!=_t0 || _deriv_dt!=_deltaT) {
+		_deriv.resize(size());
+		eval_slices(f,_t0,_deltaT,&_deriv[0],size());
+		_deriv_f=&f;
+		_deriv_t0=_t0;
+		_deriv_dt=_deltaT;
+	}
+	return &_deriv[0];
+}
+
+void Tube::fwd(const Interval* v) {
+	const Tube& x=*this; // read-only access (not marked as modified)
+	int n=size();
+	for(int i=_dirty_lb;i<n-1;i++){
 // Euler formulation  TODO replace it by RK4 or VNODES
-		(*this)[i+1] &=(*this)[i]+Interval(f.eval_vector(lx)[0].lb(),f.eval_vector(ux)[0].ub())*_deltaT;
+		if (!ctc_slice(i+1,x[i]+v[i]*_deltaT) && i+1>_dirty_ub)
+			break; // the next slices are consistent
 	}
-	return *this;
 }
 
-Tube& Tube::ctcBwd(const Function& f) {
-	assert((f.nb_var()==1)&&(f.nb_arg()==1));
-	IntervalVector lx(1);
-	IntervalVector ux(1);
-	for(int i=(*this).size()-1;i>=1;i--){
-		lx[0]= Interval(_t0+i*_deltaT,_t0+(i+1)*_deltaT);
-		ux[0]= Interval(_t0+i*_deltaT,_t0+(i+1)*_deltaT);
+void Tube::bwd(const Interval* v) {
+	const Tube& x=*this;
+	int n=size();
+	for(int i=(_dirty_ub<n? _dirty_ub : n-1);i>=1;i--){
 // Euler formulation  TODO replace it by RK4 or VNODES
-		(*this)[i-1] &= (*this)[i]-Interval(f.eval_vector(lx)[0].lb(),f.eval_vector(ux)[0].ub())*_deltaT;
+		if (!ctc_slice(i-1,x[i]-v[i-1]*_deltaT) && i-1<_dirty_lb)
+			break; // the previous slices are consistent
 	}
+}
+
+Tube& Tube::ctcFwd(const Function& f) {
+	fwd(derivative(f));
+	return *this;
+}
+
+Tube& Tube::ctcBwd(const Function& f) {
+	bwd(derivative(f));
 	return *this;
 }
 
 Tube& Tube::ctcFwdBwd(const Function& f) {
-	ctcFwd(f);
-	ctcBwd(f);
+	const Interval* v=derivative(f);
+	fwd(v);
+	bwd(v);
+	// the chain of slices is now consistent with f
+	_dirty_lb=size();
+	_dirty_ub=-1;
+	return *this;
+}
+
+Tube& Tube::ctcFwd(const Tube& v) {
+	__assert_tube_time_domain__(*this,v);
+	fwd(&v[0]);
+	return *this;
+}
+
+Tube& Tube::ctcBwd(const Tube& v) {
+	__assert_tube_time_domain__(*this,v);
+	bwd(&v[0]);
+	return *this;
+}
+
+Tube& Tube::ctcFwdBwd(const Tube& v) {
+	__assert_tube_time_domain__(*this,v);
+	fwd(&v[0]);
+	bwd(&v[0]);
+	// the chain of slices is now consistent with v
+	_dirty_lb=size();
+	_dirty_ub=-1;
 	return *this;
 }
 
 Tube& Tube::ctcPeriodic(double period) {
 	assert(period<=_tf);
 	int periodi = (int)round(period/_deltaT);
+	const Tube& x=*this;
 	for (int i = 0; i < size(); i++) {
-		(*this)[i] &= (*this)[i%periodi];
+		ctc_slice(i,x[i%periodi]);
 	}
 	return *this;
 }
@@ -295,14 +439,14 @@ Tube& Tube::ctcCSym(double pivot) {
 	double dist2tf=_tf-pivot;
 	if(dist2t0>dist2tf){// FIXME A corriger pas robuste
 		for(double t=0;t<=dist2tf;t+=_deltaT) {
-			(*this)[(int)round(((pivot+t)-_t0)/_deltaT)] &= -(*this)[(int)round(((pivot-t)-_t0)/_deltaT)];
-			(*this)[(int)round(((pivot-t)-_t0)/_deltaT)] &= -(*this)[(int)round(((pivot+t)-_t0)/_deltaT)];
+			ctc_slice((int)round(((pivot+t)-_t0)/_deltaT),-(*this)[(int)round(((pivot-t)-_t0)/_deltaT)]);
+			ctc_slice((int)round(((pivot-t)-_t0)/_deltaT),-(*this)[(int)round(((pivot+t)-_t0)/_deltaT)]);
 		}
 	}
 	else {
 		for(double t=0;t<=dist2t0;t+=_deltaT) {// FIXME A corriger pas robuste
-			(*this)[(int)round(((pivot+t)-_t0)/_deltaT)] &= -(*this)[(int)round(((pivot-t)-_t0)/_deltaT)];
-			(*this)[(int)round(((pivot-t)-_t0)/_deltaT)] &= -(*this)[(int)round(((pivot+t)-_t0)/_deltaT)];
+			ctc_slice((int)round(((pivot+t)-_t0)/_deltaT),-(*this)[(int)round(((pivot-t)-_t0)/_deltaT)]);
+			ctc_slice((int)round(((pivot-t)-_t0)/_deltaT),-(*this)[(int)round(((pivot+t)-_t0)/_deltaT)]);
 		}
 	}
 	return *this;
@@ -314,14 +458,14 @@ Tube& Tube::ctcASym(double pivot) {
 	double dist2tf=_tf-pivot;
 	if(dist2t0>dist2tf){
 		for(double t=0;t<=dist2tf;t+=_deltaT) {// FIXME A corriger pas robuste
-			(*this)[(int)round(((pivot+t)-_t0)/_deltaT)] &= (*this)[(int)round(((pivot-t)-_t0)/_deltaT)];
-			(*this)[(int)round(((pivot-t)-_t0)/_deltaT)] &= (*this)[(int)round(((pivot+t)-_t0)/_deltaT)];
+			ctc_slice((int)round(((pivot+t)-_t0)/_deltaT),(*this)[(int)round(((pivot-t)-_t0)/_deltaT)]);
+			ctc_slice((int)round(((pivot-t)-_t0)/_deltaT),(*this)[(int)round(((pivot+t)-_t0)/_deltaT)]);
 		}
 	}
 	else {
 		for(double t=0;t<=dist2t0;t+=_deltaT) {// FIXME A corriger pas robuste
-			(*this)[(int)round(((pivot+t)-_t0)/_deltaT)] &= (*this)[(int)round(((pivot-t)-_t0)/_deltaT)];
-			(*this)[(int)round(((pivot-t)-_t0)/_deltaT)] &= (*this)[(int)round(((pivot+t)-_t0)/_deltaT)];
+			ctc_slice((int)round(((pivot+t)-_t0)/_deltaT),(*this)[(int)round(((pivot-t)-_t0)/_deltaT)]);
+			ctc_slice((int)round(((pivot-t)-_t0)/_deltaT),(*this)[(int)round(((pivot+t)-_t0)/_deltaT)]);
 		}
 	}
 	return *this;
@@ -348,20 +492,20 @@ ScalarTube ScalarTube::timeIntegration(void)
   return u;
 }*/
 
-Interval Tube::integral(const int kmin, const int kmax) {
-	Interval temp(0,0);
-	for (unsigned int k=kmin; k<=kmax; k++){
-		temp += (*this)[k]*_deltaT;
-	}
-	return temp;
+Interval Tube::integral(const int kmin, const int kmax) const {
+	if (kmin>kmax) return Interval(0,0);
+	build_tree();
+	return range_sum(_sum,size(),kmin,kmax+1);
 }
 
 Tube& Tube::integral() {
-	IntervalVector temp = (*this);
+	// FIXME A mon avis l'integral est à mettre dansun autre Tube: Tube integrate(const Tube& x)
+	Interval temp(0,0);
 	for(int i=0; i < size(); i++){
-		temp[i] = integral(0,i);
+		temp += (*this)[i]*_deltaT;
+		IntervalVector::operator[](i) = temp;
 	}
-	(*this) = temp;// FIXME A mon avis l'integral est à mettre dansun autre Tube: Tube integrate(const Tube& x)
+	modified();
 	return *this;
 }
 
@@ -369,10 +513,11 @@ Tube& Tube::shift(double delay) {
 	assert(delay<_tf);
 	int shifti = (int)round(delay/_deltaT);
 	for (int i = 0; i < size(); i++) {
-		if(i+shifti>=0 && i+shifti<size()) (*this)[i] = (*this)[i+shifti];
-		else (*this)[i] = Interval::ALL_REALS; // gch: not EMPTY_SET! a vector cannot contain
-		                                       // empty components if it is not empty itself.
+		if(i+shifti>=0 && i+shifti<size()) IntervalVector::operator[](i) = (*this)[i+shifti];
+		else IntervalVector::operator[](i) = Interval::ALL_REALS; // gch: not EMPTY_SET! a vector cannot contain
+		                                                          // empty components if it is not empty itself.
 	}
+	modified();
 
 	return *this;
 }
@@ -380,6 +525,7 @@ Tube& Tube::shift(double delay) {
 Tube& Tube::scale(double coef) {// FIXME A corriger pas robuste
 	_tf=(_tf-_t0)*coef+_t0;
 	_deltaT=_deltaT*coef;
+	modified(); // the integrals depend on deltaT
 	return *this;
 }
 
@@ -407,6 +553,3 @@ std::ostream& operator <<(std::ostream& os, const Tube& x) {
 
 
 } // end namespace ibex
-
-
-#endif /* _IBEX_TUBE_H_ */
@@ -9,10 +9,11 @@
  * Created     : Oct 7, 2013
  * ---------------------------------------------------------------------------- */
 
+#ifndef __IBEX_TUBE_H__
 #define __IBEX_TUBE_H__
-#ifndef __IBEX_TUBE_H__  // The class Tube is not ready !!!
 
 #include <cassert>
+#include <vector>
 #include "ibex_Interval.h"
 #include "ibex_IntervalVector.h"
 #include "ibex_Function.h"
@@ -33,6 +34,62 @@ private:
 	double 			_tf;
 	double 			_deltaT;
 
+	/*
+	 * Binary tree over the slices, built lazily (on the first
+	 * range query) and stored as an array: the leaves are at
+	 * [n,2n), the children of node k are 2k and 2k+1 and the
+	 * root is 1. Each node stores the hull of the slices below
+	 * it (_hull) and their integral, i.e., the sum of
+	 * slice*deltaT (_sum).
+	 */
+	mutable std::vector<Interval> _hull;
+	mutable std::vector<Interval> _sum;
+	mutable bool _tree_ok;
+
+	/*
+	 * Range of the slices modified since the last call to
+	 * ctcFwdBwd (empty if _dirty_lb>_dirty_ub). The other
+	 * slices are consistent with the derivative.
+	 */
+	int _dirty_lb;
+	int _dirty_ub;
+
+	/*
+	 * Values of the derivative on all the slices, computed
+	 * by the first call to ctcFwd/ctcBwd/ctcFwdBwd with the
+	 * function _deriv_f (NULL if none) and reused until the
+	 * function or the time discretization changes.
+	 */
+	const Function* _deriv_f;
+	std::vector<Interval> _deriv;
+	double _deriv_t0;
+	double _deriv_dt;
+
+	/* Values of f on all the slices (cached). */
+	const Interval* derivative(const Function& f);
+
+	/* Euler propagation with the derivative v (one value per slice). */
+	void fwd(const Interval* v);
+	void bwd(const Interval* v);
+
+	/* Build the tree (if necessary). */
+	void build_tree() const;
+
+	/* All the slices have been modified. */
+	void modified();
+
+	/* The i^th slice has been modified: update the tree (if built). */
+	void update_slice(int i);
+
+	/*
+	 * Contract the i^th slice to x and update the tree.
+	 * Return true if the slice has changed.
+	 */
+	bool ctc_slice(int i, const Interval& x);
+
+	/* Hull of the slices kmin to kmax (included). */
+	Interval hull(int kmin, int kmax) const;
+
 public:
 
 	/**
@@ -98,6 +155,18 @@ public:
 	 */
 	Tube(double t0, double tf, double pas, const Function& fmin, const Function& fmax);
 
+	/**
+	 * \brief Create the tube of a function of time.
+	 *
+	 * \see comments in #Tube(double, double, double, const Interval&).
+	 *
+	 * The i^th component is f([t0+i*step,t0+(i+1)*step]). The
+	 * function is evaluated once per slice.
+	 *
+	 * \pre f must be a scalar function of one variable.
+	 */
+	Tube(double t0, double tf, double step, const Function& f);
+
 	/**
 	 * \brief Create [empty; ...; empty]
 	 *
@@ -245,45 +314,41 @@ public:
 	 */
 	const Interval& at(double ti) const;
 
+
 	/**
-	 * \brief Return f(t).
+	 * \brief Return f([t])
+	 *
+	 * \return an enclosure of the function for the variable varying in [t]
 	 *
-	 * \return a reference to the value of the function at t=ti
+	 * Logarithmic time once the tree of slices is built.
 	 *
 	 * \pre t0<=t<=tf.
 	 */
-	Interval& at(double ti);
+    Interval at(const Interval &t) const;
 
+	/**
+	 * \brief Return f(t_i)
+	 *
+	 * \return a const reference to the value of the function at the i^th time step.
+	 *
+	 * \pre 0<=i<=size()
+	 */
+	const Interval& operator[](int i) const;
 
 	/**
-	 * \brief Return f([t])
+	 * \brief Set f(t_i) to x.
 	 *
-	 * \return an enclosure of the function for the variable varying in [t]
+	 * There is no write access through operator[]: reading a slice
+	 * must not invalidate the tree of slices. The tree is updated
+	 * in logarithmic time (if built).
 	 *
-	 * \pre t0<=t<=tf.
+	 * \pre 0<=i<=size()
 	 */
-    Interval at(const Interval &t) const;
-//
-//	/**
-//	 * \brief Return f(t_i)
-//	 *
-//	 * \return a const reference to the value of the function at the i^th time step.
-//	 *
-//	 * \pre 0<=i<=size()
-//	 */
-//	const Interval& operator[](int i) const;
-//
-//	/**
-//	 * \brief Return f(t_i)
-//	 *
-//	 * \return a const reference to the value of the function at the i^th time step.
-//	 *
-//	 * \pre 0<=i<=size()
-//	 */
-//
-//	Interval& operator[](int i);
+	void set(int i, const Interval& x);
 
 	/* \brief Return the maximal value of the tube (thus part of the upper bound).
+	 *
+	 *  Constant time once the tree of slices is built.
 	 *
 	 *  \throws InvalidVectorOp if the tube is empty.
 	 */
@@ -292,6 +357,8 @@ public:
 	/**
 	 * \brief Return the minimal value of the tube (thus part of the lower bound).
 	 *
+	 * Constant time once the tree of slices is built.
+	 *
 	 * \throws InvalidVectorOp if the tube is empty.
 	 */
 	double min() const;
@@ -326,11 +393,28 @@ public:
 	/**
      * \brief Contract *this forward and/or backward according to the state equation \a xpoint=f(x) using an euler method.
      * Notice that we loose the interval guarantee. Please use VNODE for guaranted results.
+     *
+     * The derivative is evaluated on all the slices in one pass, on the first call only:
+     * the values are stored and reused by the next calls with the same function
+     * (identified by its address) as long as the time discretization is unchanged.
+     * The propagation is then the same as #ctcFwd(const Tube&).
 	 */
     Tube& ctcFwd(const Function &f);
     Tube& ctcBwd(const Function &f);
     Tube& ctcFwdBwd(const Function &f);
 
+	/**
+     * \brief Contract *this forward and/or backward according to the derivative \a v (a tube over the same time domain).
+     *
+     * The propagation starts from the slices modified since the last call to ctcFwdBwd and
+     * stops as soon as a slice is left unchanged (the other slices are assumed to be consistent
+     * with \a v). In a fixpoint loop, the derivative should therefore be the same from one call
+     * to the other and evaluated once, e.g., with #Tube(double, double, double, const Function&).
+	 */
+    Tube& ctcFwd(const Tube &v);
+    Tube& ctcBwd(const Tube &v);
+    Tube& ctcFwdBwd(const Tube &v);
+
 	/**
      *\brief Contract a periodic tube with a \a period
 	 */
@@ -358,12 +442,14 @@ public:
     Tube& scale(double coef);
 
     /**
-     * \brief Return the integral of the  tube
+     * \brief Return the integral of the tube from slice \a kmin to slice \a kmax (included)
+     *
+     * Logarithmic time once the tree of slices is built.
      */
-    Interval integral(const int kmin, const int kmax);
+    Interval integral(const int kmin, const int kmax) const;
 
     /**
-     * \brief Return the integral of the  tube
+     * \brief Replace the tube by its primitive (computed in one pass)
      */
     Tube& integral();
 };
@@ -529,11 +615,17 @@ inline double Tube::get_delta_t() const {
 	return _deltaT;
 }
 
-inline const Interval& Tube::at(double t) const {
-	return (*this)[(int)((t-_t0)/_deltaT)];
+inline const Interval& Tube::operator[](int i) const {
+	return IntervalVector::operator[](i);
 }
 
-inline Interval& Tube::at(double t) {
+inline void Tube::modified() {
+	_tree_ok=false;
+	_dirty_lb=0;
+	_dirty_ub=size()-1;
+}
+
+inline const Interval& Tube::at(double t) const {
 	return (*this)[(int)((t-_t0)/_deltaT)];
 }
 
@@ -551,43 +643,51 @@ inline Tube Tube::operator|(const Tube& x) const {
 
 inline Tube& Tube::operator+=(double x2) {
 	((IntervalVector&) (*this))+=x2;
+	modified();
 	return *this;
 }
 
 inline Tube& Tube::operator+=(const Interval& x2) {
-	for (int i=0; i<size();i++) (*this)[i] += x2;
+	for (int i=0; i<size();i++) ((IntervalVector&) (*this))[i] += x2;
+	modified();
 	return *this;
 }
 
 inline Tube& Tube::operator+=(const Tube& x2) {
 	__assert_tube_time_domain__(*this,x2);
 	((IntervalVector&) (*this))+=x2;
+	modified();
 	return *this;
 }
 
 inline Tube& Tube::operator-=(double x2) {
 	((IntervalVector&) (*this))-=x2;
+	modified();
 	return *this;
 }
 
 inline Tube& Tube::operator-=(const Interval& x2) {
-	for (int i=0; i<size();i++) (*this)[i] -= x2;
+	for (int i=0; i<size();i++) ((IntervalVector&) (*this))[i] -= x2;
+	modified();
 	return *this;
 }
 
 inline Tube& Tube::operator-=(const Tube& x2){
 	__assert_tube_time_domain__(*this,x2);
 	((IntervalVector&) (*this))-=x2;
+	modified();
 	return *this;
 }
 
 inline Tube& Tube::operator*=(double x2){
 	((IntervalVector&) (*this))*=x2;
+	modified();
 	return *this;
 }
 
 inline Tube& Tube::operator*=(const Interval& x2){
 	((IntervalVector&) (*this))*=x2;
+	modified();
 	return *this;
 }
 
@@ -598,11 +698,13 @@ inline Tube& Tube::operator*=(const Tube& x2){
 
 inline Tube& Tube::operator/=(double x2){
 	((IntervalVector&) (*this))*=1/x2;
+	modified();
 	return *this;
 }
 
 inline Tube& Tube::operator/=(const Interval& x2){
 	((IntervalVector&) (*this))*=1/x2;
+	modified();
 	return *this;
 }
 
@@ -611,6 +713,7 @@ inline Tube& Tube::operator/=(const Tube& x2) {
 	for (int i = 0; i < size(); i++) {
 		((IntervalVector&) (*this))[i] /= x2[i];
 	}
+	modified();
 	return *this;
 }
 
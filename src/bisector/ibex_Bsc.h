@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : May 8, 2012
-// Last Update : May 8, 2012
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #ifndef __IBEX_BISECTOR_H__
@@ -140,6 +140,10 @@ public:
 		return std::pair<Backtrackable*,Backtrackable*>(new BisectedVar(var),new BisectedVar(var));
 	}
 
+	size_t memory() const {
+		return sizeof(BisectedVar);
+	}
+
 	int var;
 };
 
@@ -26,6 +26,7 @@ JAVA_INC=/usr/lib/jvm/java-6-openjdk-amd64/include
 #===================================================
 
 # To compile in debug mode: "make DEBUG=yes"
+# If Ibex has been configured with "--with-threads": "make THREADS=yes"
 
 ifeq ($(DEBUG), yes)
 CXXFLAGS:=-O0 -g -pg -Wall -Wno-deprecated -Wno-unknown-pragmas -fmessage-length=0 -frounding-math  
@@ -86,3 +87,8 @@ LIB_DIR_OPT := $(IBEX_LIB_DIR_OPT) $(FILIB_LIB_DIR_OPT) $(SIMPLEX_LIB_DIR_OPT)
 LIB_NAME_OPT := $(IBEX_LIB_NAME_OPT) $(FILIB_LIB_NAME_OPT) $(SIMPLEX_LIB_NAME_OPT)
 endif
 endif
+
+# threads (see ParallelFnc)
+ifeq ($(THREADS), yes)
+LIB_NAME_OPT += -lpthread
+endif
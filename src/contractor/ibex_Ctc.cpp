@@ -13,7 +13,7 @@
 
 namespace ibex {
 
-Ctc::Ctc() : input(NULL), output(NULL), _impact(NULL), _output_flags(NULL) {
+Ctc::Ctc() : input(NULL), output(NULL), _impact(NULL), _output_flags(NULL), _changes(NULL) {
 
 }
 
@@ -54,4 +54,52 @@ void Ctc::contract(IntervalVector& box, const BoolMask& impact, BoolMask& flags)
 	_output_flags = NULL;
 }
 
+void Ctc::contract(IntervalVector& box, const BoolMask& impact, BoolMask& flags, CtcChanges& changes) {
+	flags.unset_all();
+	track_changes(box, &impact, &flags, changes);
+}
+
+void Ctc::contract(IntervalVector& box, CtcChanges& changes) {
+	track_changes(box, NULL, NULL, changes);
+}
+
+void Ctc::track_changes(IntervalVector& box, const BoolMask* impact, BoolMask* flags, CtcChanges& changes) {
+	_impact = impact;
+	_output_flags = flags;
+
+	try {
+		if (reports_changes()) {
+			_changes = &changes;
+			contract(box);
+		} else {
+			IntervalVector old_box(box);
+			contract(box);
+			for (int i=0; i<box.size(); i++)
+				if (old_box[i]!=box[i]) changes.add(i,old_box[i]);
+		}
+	}
+	catch(EmptyBoxException& e) {
+		_impact = NULL;
+		_output_flags = NULL;
+		_changes = NULL;
+		throw e;
+	}
+
+	_impact = NULL;
+	_output_flags = NULL;
+	_changes = NULL;
+}
+
+bool Ctc::reports_changes() const {
+	return false;
+}
+
+void Ctc::add_backtrackable(Cell& root) {
+
+}
+
+void Ctc::set_cell(Cell* cell) {
+
+}
+
 } // namespace ibex
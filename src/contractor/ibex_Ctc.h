@@ -15,9 +15,12 @@
 #include "ibex_IntervalVector.h"
 #include "ibex_EmptyBoxException.h"
 #include "ibex_BoolMask.h"
+#include "ibex_CtcChanges.h"
 
 namespace ibex {
 
+class Cell;
+
 /**
  * \defgroup contractor Contractors
  */
@@ -64,6 +67,54 @@ public:
 	 */
 	void contract(IntervalVector& box, const BoolMask& impact, BoolMask& flags);
 
+	/**
+	 * \brief Contraction with specified impact, output flags and modified variables.
+	 *
+	 * The variables modified by the contraction are added to \a changes
+	 * (the set is not emptied before). If this contractor does not report
+	 * its modifications itself (see #reports_changes()), they are calculated
+	 * by comparing the box before and after the contraction.
+	 *
+	 * \see #contract(IntervalVector&, const BoolMask&, BoolMask&).
+	 */
+	void contract(IntervalVector& box, const BoolMask& impact, BoolMask& flags, CtcChanges& changes);
+
+	/**
+	 * \brief Contraction with modified variables (without impact).
+	 *
+	 * \see #contract(IntervalVector&, const BoolMask&, BoolMask&, CtcChanges&).
+	 */
+	void contract(IntervalVector& box, CtcChanges& changes);
+
+	/**
+	 * \brief True if this contractor reports the modified variables.
+	 *
+	 * A contractor that returns true must add to #changes() (if not NULL)
+	 * all the variables it modifies. By default, return false.
+	 */
+	virtual bool reports_changes() const;
+
+	/**
+	 * Allows to add the backtrackable data required
+	 * by this contractor to the root cell before a
+	 * strategy is executed.<br>
+	 * By default: does nothing. The contractors built on
+	 * other contractors (e.g., #ibex::CtcCompo) forward the call.
+	 */
+	virtual void add_backtrackable(Cell& root);
+
+	/**
+	 * \brief Set the cell whose box is contracted.
+	 *
+	 * Called by a strategy before contracting the box of \a cell, so that the
+	 * contractor can use the data added by #add_backtrackable(Cell&) to the
+	 * cells. The cell remains the current one until the next call
+	 * (NULL means no cell: the box may not belong to a cell).<br>
+	 * By default: does nothing. The contractors built on
+	 * other contractors (e.g., #ibex::CtcCompo) forward the call.
+	 */
+	virtual void set_cell(Cell* cell);
+
 	/**
 	 * \brief The input variables (NULL pointer means "unspecified")
 	 */
@@ -102,9 +153,19 @@ protected:
 	 */
 	void set_flag(unsigned int);
 
+	/**
+	 * \brief Return the set of modified variables to fill (NULL pointer if none).
+	 *
+	 * \see #reports_changes().
+	 */
+	CtcChanges* changes();
+
 private:
+	void track_changes(IntervalVector& box, const BoolMask* impact, BoolMask* flags, CtcChanges& changes);
+
 	const BoolMask* _impact;
 	BoolMask* _output_flags;
+	CtcChanges* _changes;
 };
 
 
@@ -116,6 +177,10 @@ inline const BoolMask* Ctc::impact() {
 	return _impact;
 }
 
+inline CtcChanges* Ctc::changes() {
+	return _changes;
+}
+
 inline void Ctc::set_flag(unsigned int f) {
 	assert(f<NB_OUTPUT_FLAGS);
 	if (_output_flags) (*_output_flags)[f]=true;
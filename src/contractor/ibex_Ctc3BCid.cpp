@@ -360,4 +360,12 @@ bool Ctc3BCid::varCID(int var, IntervalVector &varcid_box, IntervalVector &var3B
 }
 
 
+void Ctc3BCid::add_backtrackable(Cell& root) {
+	ctc.add_backtrackable(root);
+}
+
+void Ctc3BCid::set_cell(Cell* cell) {
+	ctc.set_cell(cell);
+}
+
 } // end namespace ibex
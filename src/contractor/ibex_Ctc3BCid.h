@@ -114,6 +114,16 @@ class Ctc3BCid : public Ctc {
 	 */
 	virtual void contract(IntervalVector& box);
 
+	/**
+	 * \brief Add the data required by the sub-contractor to the root cell.
+	 */
+	virtual void add_backtrackable(Cell& root);
+
+	/**
+	 * \brief Set the current cell of the sub-contractor.
+	 */
+	virtual void set_cell(Cell* cell);
+
 	/** The number of variables this contractor works with. */
 	const int nb_var;
 
@@ -0,0 +1,160 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CtcAdaptive.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "ibex_CtcAdaptive.h"
+
+#include <math.h>
+#include <ctime>
+
+using namespace std;
+
+namespace ibex {
+
+const double CtcAdaptive::default_ratio = 0.005;
+const double CtcAdaptive::default_epsilon = 0.05;
+const int CtcAdaptive::default_nb_init_calls = 10;
+const int CtcAdaptive::default_nb_levels = 32;
+const unsigned int CtcAdaptive::default_seed = 1;
+
+namespace {
+
+// after the tuning phase, the gain is averaged
+// over (roughly) the last MEMORY calls.
+const int MEMORY=20;
+
+// average relative reduction of the diameters
+double reduction(const IntervalVector& before, const IntervalVector& after) {
+	double g=0;
+	int n=0;
+	for (int i=0; i<before.size(); i++) {
+		double d=before[i].diam();
+		if (d>0 && d<POS_INFINITY) {
+			g+=1-after[i].diam()/d;
+			n++;
+		}
+	}
+	return n==0 ? 0 : g/n;
+}
+
+vector<bool> positive(const vector<double>& cost) {
+	vector<bool> p(cost.size());
+	for (unsigned int i=0; i<cost.size(); i++)
+		p[i]=cost[i]>0;
+	return p;
+}
+
+}
+
+CtcAdaptive::CtcAdaptive(const Array<Ctc>& list, const vector<bool>& expensive, unsigned int seed) :
+		list(list), expensive(expensive), ratio(default_ratio), epsilon(default_epsilon),
+		nb_init_calls(default_nb_init_calls), nb_levels(default_nb_levels),
+		stat(default_nb_levels, vector<Stat>(list.size())), root_diam(POS_INFINITY), state(seed) {
+
+	assert((int) expensive.size()==list.size());
+}
+
+CtcAdaptive::CtcAdaptive(const Array<Ctc>& list, const vector<double>& cost, unsigned int seed) :
+		list(list), expensive(positive(cost)), supplied_cost(cost), ratio(default_ratio), epsilon(default_epsilon),
+		nb_init_calls(default_nb_init_calls), nb_levels(default_nb_levels),
+		stat(default_nb_levels, vector<Stat>(list.size())), root_diam(POS_INFINITY), state(seed) {
+
+	assert((int) cost.size()==list.size());
+}
+
+double CtcAdaptive::cost(int i, int level) const {
+	if (!supplied_cost.empty()) return supplied_cost[i];
+
+	double total=0;
+	for (int j=0; j<list.size(); j++)
+		total+=stat[level][j].time;
+
+	return total>0 ? stat[level][i].time/total : 0;
+}
+
+double CtcAdaptive::random() {
+	// linear congruential generator (Numerical Recipes)
+	state = 1664525u*state + 1013904223u;
+	return (state >> 8) / 16777216.0;
+}
+
+void CtcAdaptive::reset() {
+	root_diam=POS_INFINITY;
+}
+
+int CtcAdaptive::level(const IntervalVector& box) {
+	double d=box.max_diam();
+
+	if (!(d<POS_INFINITY)) return 0;
+
+	// the first box contracted may be a sub-box of the root
+	// or unbounded: the root is the largest bounded box.
+	if (!(root_diam<POS_INFINITY) || d>root_diam) root_diam=d;
+	if (d>=root_diam) return 0;
+	if (d<=0) return nb_levels-1;
+
+	int l=(int) (::log(root_diam/d)/::log(2.0));
+	return l<nb_levels ? l : nb_levels-1;
+}
+
+void CtcAdaptive::contract(IntervalVector& box) {
+
+	int l=level(box);
+
+	for (int i=0; i<list.size(); i++) {
+		Stat& s=stat[l][i];
+
+		if (expensive[i] && s.n>=nb_init_calls) {
+			// note: random() is called even if the contractor is
+			// efficient, so that the sequence of random numbers
+			// does not depend on the previous decisions.
+			bool explore=random()<epsilon;
+			// a cost too small to be measured means "efficient"
+			if (!explore && s.gain<ratio*cost(i,l)) continue;
+		}
+
+		IntervalVector before(box);
+		bool empty=false;
+
+		clock_t start=clock();
+
+		try {
+			list[i].contract(box);
+		} catch (EmptyBoxException&) {
+			empty=true;
+		}
+
+		double t=((double) (clock()-start))/CLOCKS_PER_SEC;
+
+		// an empty box is the maximal gain
+		double g=empty? 1 : reduction(before,box);
+
+		s.n++;
+		int m=s.n < MEMORY ? s.n : MEMORY;
+		s.gain += (g-s.gain) / m;
+		s.time += (t-s.time) / m;
+
+		if (empty) {
+			box.set_empty();
+			throw EmptyBoxException();
+		}
+	}
+}
+
+void CtcAdaptive::add_backtrackable(Cell& root) {
+	for (int i=0; i<list.size(); i++)
+		list[i].add_backtrackable(root);
+}
+
+void CtcAdaptive::set_cell(Cell* cell) {
+	for (int i=0; i<list.size(); i++)
+		list[i].set_cell(cell);
+}
+
+} // end namespace ibex
@@ -0,0 +1,198 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CtcAdaptive.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_CTC_ADAPTIVE_H__
+#define __IBEX_CTC_ADAPTIVE_H__
+
+#include "ibex_Ctc.h"
+#include "ibex_Array.h"
+
+#include <vector>
+
+namespace ibex {
+
+/** \ingroup contractor
+ * \brief Composition of contractors with adaptive scheduling
+ *
+ * Like #ibex::CtcCompo, this contractor applies c_0, c_1,... in turn.
+ * However, the expensive contractors (e.g., #ibex::CtcPolytopeHull,
+ * #ibex::CtcNewton, #ibex::Ctc3BCid) are only called if they have been
+ * efficient recently. The other ("cheap") contractors are always called.
+ *
+ * The efficiency of a contractor is its average gain (the average relative
+ * reduction of the diameters, as in #ibex::CtcAcid) divided by its cost.
+ * The decision to call a contractor is made by an epsilon-greedy bandit policy:
+ * <ul>
+ * <li> the contractor is called during the first #nb_init_calls calls (tuning),
+ * <li> then it is called if its efficiency is greater than #ratio,
+ * <li> otherwise it is still called with probability #epsilon (exploration).
+ * </ul>
+ * The efficiency depends on the depth of the node in the search tree.
+ * The depth is estimated by the number of times the largest diameter of the
+ * box has been halved since the root box, and separate statistics are kept for
+ * each depth (up to #nb_levels). The root box is the largest bounded box
+ * contracted since the creation of the contractor or the last call to #reset().
+ * Unbounded boxes are at depth 0.
+ *
+ * The CPU time of each call is measured. By default, the cost of a
+ * contractor is its average CPU time per call, divided by the sum of
+ * the average CPU times of all the contractors (at the same depth).
+ * The decisions then depend on the CPU time, and may vary from one
+ * run to another. If the costs are supplied by the caller (e.g., measured
+ * once and for all on a benchmark), the decisions only depend on the boxes
+ * and on the seed of the (internal) random generator.
+ */
+class CtcAdaptive : public Ctc {
+public:
+	/**
+	 * \brief Build the composition (measured costs).
+	 *
+	 * \param list      - the contractors
+	 * \param expensive - whether each contractor is expensive. The cost of an
+	 *                    expensive contractor is measured. The other contractors
+	 *                    are always called.
+	 * \param seed      - seed of the random generator (for exploration)
+	 */
+	CtcAdaptive(const Array<Ctc>& list, const std::vector<bool>& expensive, unsigned int seed=default_seed);
+
+	/**
+	 * \brief Build the composition (supplied costs).
+	 *
+	 * \param list - the contractors
+	 * \param cost - the (relative) cost of each contractor, supplied by the
+	 *               caller. A contractor with a zero cost is cheap and always
+	 *               called.
+	 * \param seed - seed of the random generator (for exploration)
+	 */
+	CtcAdaptive(const Array<Ctc>& list, const std::vector<double>& cost, unsigned int seed=default_seed);
+
+	/**
+	 * \brief Contract a box.
+	 */
+	virtual void contract(IntervalVector& box);
+
+	/**
+	 * \brief Add the data required by the sub-contractors to the root cell.
+	 */
+	virtual void add_backtrackable(Cell& root);
+
+	/**
+	 * \brief Set the current cell of the sub-contractors.
+	 */
+	virtual void set_cell(Cell* cell);
+
+	/**
+	 * \brief Forget the root box.
+	 *
+	 * To be called before a new search with the same contractor.
+	 * The statistics of the contractors are kept.
+	 */
+	void reset();
+
+	/**
+	 * \brief Number of calls of the ith contractor at a given depth.
+	 */
+	int nb_calls(int i, int level) const;
+
+	/**
+	 * \brief Average gain of the ith contractor at a given depth.
+	 */
+	double gain(int i, int level) const;
+
+	/**
+	 * \brief Average CPU time (in seconds) of a call to the ith contractor at a given depth.
+	 */
+	double time(int i, int level) const;
+
+	/**
+	 * \brief Cost of the ith contractor at a given depth.
+	 *
+	 * This is either the supplied cost or the measured one.
+	 */
+	double cost(int i, int level) const;
+
+	/**
+	 * \brief Depth of a box (between 0 and #nb_levels-1).
+	 */
+	int level(const IntervalVector& box);
+
+	/** The list of sub-contractors */
+	Array<Ctc> list;
+
+	/** Whether each sub-contractor is expensive (not always called) */
+	const std::vector<bool> expensive;
+
+	/** The cost of each sub-contractor, supplied by the caller (empty if the costs are measured) */
+	const std::vector<double> supplied_cost;
+
+	/** Minimal efficiency (gain/cost) of an expensive contractor. */
+	double ratio;
+
+	/** Probability of calling an inefficient contractor (exploration). */
+	double epsilon;
+
+	/** Number of calls at each depth before the decisions are made. */
+	int nb_init_calls;
+
+	/** Number of depths distinguished. */
+	const int nb_levels;
+
+	/** Default ratio, set to 0.005. */
+	static const double default_ratio;
+
+	/** Default epsilon, set to 0.05. */
+	static const double default_epsilon;
+
+	/** Default number of tuning calls, set to 10. */
+	static const int default_nb_init_calls;
+
+	/** Default number of depths, set to 32. */
+	static const int default_nb_levels;
+
+	/** Default seed, set to 1. */
+	static const unsigned int default_seed;
+
+protected:
+	// a uniform random number in [0,1[
+	double random();
+
+	// the statistics of each contractor at each level
+	struct Stat {
+		Stat() : n(0), gain(0), time(0) { }
+		int n;
+		double gain;
+		double time;
+	};
+
+	std::vector<std::vector<Stat> > stat;
+
+	// the largest diameter of the root box
+	// (POS_INFINITY if there is no root box yet)
+	double root_diam;
+
+	unsigned int state;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline int CtcAdaptive::nb_calls(int i, int level) const {
+	return stat[level][i].n;
+}
+
+inline double CtcAdaptive::gain(int i, int level) const {
+	return stat[level][i].gain;
+}
+
+inline double CtcAdaptive::time(int i, int level) const {
+	return stat[level][i].time;
+}
+
+} // end namespace ibex
+#endif // __IBEX_CTC_ADAPTIVE_H__
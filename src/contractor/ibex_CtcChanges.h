@@ -0,0 +1,137 @@
+/* ============================================================================
+ * I B E X - Variables modified by a contraction
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __IBEX_CTC_CHANGES_H__
+#define __IBEX_CTC_CHANGES_H__
+
+#include "ibex_IntervalVector.h"
+#include "ibex_BoolMask.h"
+
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \ingroup contractor
+ * \brief Variables modified by a contraction.
+ *
+ * Sparse set of variables, each with its domain before the
+ * modification (the first one, if the variable is modified several times).
+ * All the operations (except the constructor) take a time proportional
+ * to the number of variables in the set, not to the total number of variables.
+ *
+ * \see #ibex::Ctc::contract(IntervalVector&, const BoolMask&, BoolMask&, CtcChanges&).
+ */
+class CtcChanges {
+public:
+	/**
+	 * \brief Create an empty set (n is the total number of variables).
+	 */
+	CtcChanges(int n);
+
+	/**
+	 * \brief Add the ith variable with its domain \a x before the modification.
+	 *
+	 * If the variable is already in the set, nothing is done.
+	 */
+	void add(int i, const Interval& x);
+
+	/**
+	 * \brief True if the ith variable is in the set.
+	 */
+	bool contains(int i) const;
+
+	/**
+	 * \brief Number of variables in the set.
+	 */
+	int size() const;
+
+	/**
+	 * \brief The kth variable of the set (in order of insertion).
+	 */
+	int operator[](int k) const;
+
+	/**
+	 * \brief Domain of the ith variable before the modification.
+	 *
+	 * \pre contains(i).
+	 */
+	const Interval& initial(int i) const;
+
+	/**
+	 * \brief Maximal relative change of the variables.
+	 *
+	 * Relative Hausdorff distance between the initial domains
+	 * and the current domains in \a box of the variables of the set,
+	 * i.e., the same as init_box.rel_distance(box) where init_box
+	 * is the box before the modifications.
+	 */
+	double rel_distance(const IntervalVector& box) const;
+
+	/**
+	 * \brief Empty the set.
+	 */
+	void clear();
+
+private:
+	std::vector<int> vars;
+	BoolMask in;
+	IntervalVector init;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline CtcChanges::CtcChanges(int n) : in(n), init(n) {
+
+}
+
+inline void CtcChanges::add(int i, const Interval& x) {
+	if (!in[i]) {
+		in.set(i);
+		init[i]=x;
+		vars.push_back(i);
+	}
+}
+
+inline bool CtcChanges::contains(int i) const {
+	return in[i];
+}
+
+inline int CtcChanges::size() const {
+	return vars.size();
+}
+
+inline int CtcChanges::operator[](int k) const {
+	return vars[k];
+}
+
+inline const Interval& CtcChanges::initial(int i) const {
+	assert(in[i]);
+	return init[i];
+}
+
+inline double CtcChanges::rel_distance(const IntervalVector& box) const {
+	double max=0;
+	for (std::vector<int>::const_iterator it=vars.begin(); it!=vars.end(); it++) {
+		double d=init[*it].rel_distance(box[*it]);
+		if (d>max) max=d;
+	}
+	return max;
+}
+
+inline void CtcChanges::clear() {
+	for (std::vector<int>::const_iterator it=vars.begin(); it!=vars.end(); it++)
+		in.unset(*it);
+	vars.clear();
+}
+
+} // end namespace ibex
+#endif // __IBEX_CTC_CHANGES_H__
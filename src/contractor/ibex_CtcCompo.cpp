@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Apr 25, 2012
-// Last Update : Apr 25, 2012
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_CtcCompo.h"
@@ -89,9 +89,26 @@ void CtcCompo::contract(IntervalVector& box) {
 //	}
 
 	for (int i=0; i<list.size(); i++) {
-		list[i].contract(box);
+		if (changes())
+			list[i].contract(box, *changes());
+		else
+			list[i].contract(box);
 	}
 
 }
 
+bool CtcCompo::reports_changes() const {
+	return true;
+}
+
+void CtcCompo::add_backtrackable(Cell& root) {
+	for (int i=0; i<list.size(); i++)
+		list[i].add_backtrackable(root);
+}
+
+void CtcCompo::set_cell(Cell* cell) {
+	for (int i=0; i<list.size(); i++)
+		list[i].set_cell(cell);
+}
+
 } // end namespace ibex
@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Apr 25, 2012
-// Last Update : Apr 25, 2012
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #ifndef __IBEX_CTC_COMPO_H__
@@ -68,6 +68,21 @@ public:
 	 */
 	virtual void contract(IntervalVector& box);
 
+	/**
+	 * \brief Return true (the modified variables are reported).
+	 */
+	virtual bool reports_changes() const;
+
+	/**
+	 * \brief Add the data required by the sub-contractors to the root cell.
+	 */
+	virtual void add_backtrackable(Cell& root);
+
+	/**
+	 * \brief Set the current cell of the sub-contractors.
+	 */
+	virtual void set_cell(Cell* cell);
+
 	/** The list of sub-contractors */
 	Array<Ctc> list;
 
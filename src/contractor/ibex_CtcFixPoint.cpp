@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : May 01, 2012
-// Last Update : May 01, 2012
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_CtcFixPoint.h"
@@ -20,11 +20,57 @@ CtcFixPoint::CtcFixPoint(Ctc& ctc, double ratio) : ctc(ctc), ratio(ratio) {
 
 void CtcFixPoint::contract(IntervalVector& box) {
 
-	IntervalVector old_box(box);
-	do {
-		old_box=box;
-		ctc.contract(box);
-	} while (old_box.rel_distance(box)>ratio);
+	int n=box.size();
+
+	// variables modified by the current and the previous iteration
+	CtcChanges changes1(n);
+	CtcChanges changes2(n);
+	CtcChanges* cur=&changes1;
+	CtcChanges* prev=&changes2;
+
+	// the first iteration is impacted by the same variables
+	// as *this, the next ones by the variables modified by
+	// the previous iteration only.
+	BoolMask mask(n);
+	if (impact()) mask=*impact();
+	else mask.set_all();
+
+	BoolMask flags(NB_OUTPUT_FLAGS);
+
+	ctc.contract(box, mask, flags, *cur);
+	mask.unset_all();
+
+	while (true) {
+		if (changes())
+			for (int k=0; k<cur->size(); k++)
+				changes()->add((*cur)[k], cur->initial((*cur)[k]));
+
+		// only the modified variables are compared (instead of
+		// the whole box before and after the iteration)
+		if (cur->rel_distance(box)<=ratio) break;
+
+		for (int k=0; k<prev->size(); k++)
+			mask.unset((*prev)[k]);
+		for (int k=0; k<cur->size(); k++)
+			mask.set((*cur)[k]);
+
+		CtcChanges* tmp=prev; prev=cur; cur=tmp;
+		cur->clear();
+
+		ctc.contract(box, mask, flags, *cur);
+	}
+}
+
+bool CtcFixPoint::reports_changes() const {
+	return true;
+}
+
+void CtcFixPoint::add_backtrackable(Cell& root) {
+	ctc.add_backtrackable(root);
+}
+
+void CtcFixPoint::set_cell(Cell* cell) {
+	ctc.set_cell(cell);
 }
 
 } // end namespace ibex
@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : May 01, 2012
-// Last Update : May 01, 2012
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #ifndef __IBEX_CTC_FIX_POINT_H__
@@ -19,6 +19,11 @@ namespace ibex {
  * \ingroup contractor
  * \brief FixPoint of a contractor
  *
+ * The sub-contractor reports the variables it modifies (see
+ * #ibex::Ctc::reports_changes()). Only these variables are compared to
+ * decide termination and they form the impact of the next iteration.
+ * So, if the sub-contractor reports its changes, an iteration does not
+ * cost O(n) when only a few variables are modified.
  */
 class CtcFixPoint : public Ctc {
 public:
@@ -36,6 +41,21 @@ public:
 	 */
 	virtual void contract(IntervalVector& box);
 
+	/**
+	 * \brief Return true (the modified variables are reported).
+	 */
+	virtual bool reports_changes() const;
+
+	/**
+	 * \brief Add the data required by the sub-contractor to the root cell.
+	 */
+	virtual void add_backtrackable(Cell& root);
+
+	/**
+	 * \brief Set the current cell of the sub-contractor.
+	 */
+	virtual void set_cell(Cell* cell);
+
 	/** The sub-contractor */
 	Ctc& ctc;
 
@@ -70,6 +70,13 @@ void CtcFwdBwd::contract(IntervalVector& box) {
 	case Dim::MATRIX_ARRAY: assert(false); /* impossible */ break;
 	}
 
+	// only the variables used by f can be modified
+	CtcChanges* ch=changes();
+	std::vector<Interval> old;
+	if (ch)
+		for (int i=0; i<ctr.f.nb_used_vars(); i++)
+			old.push_back(box[ctr.f.used_var(i)]);
+
 	try {
 		if (hc4r.proj(ctr.f,root_label,box)) {
 			set_flag(INACTIVE); // TODO: incorrect in general
@@ -79,6 +86,16 @@ void CtcFwdBwd::contract(IntervalVector& box) {
 		box.set_empty();
 		throw e;
 	}
+
+	if (ch)
+		for (int i=0; i<ctr.f.nb_used_vars(); i++) {
+			int v=ctr.f.used_var(i);
+			if (old[i]!=box[v]) ch->add(v,old[i]);
+		}
+}
+
+bool CtcFwdBwd::reports_changes() const {
+	return true;
 }
 
 } // namespace ibex
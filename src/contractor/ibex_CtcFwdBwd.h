@@ -50,6 +50,11 @@ public:
 	 */
 	virtual void contract(IntervalVector& box);
 
+	/**
+	 * \brief Return true (the modified variables are reported).
+	 */
+	virtual bool reports_changes() const;
+
 	/*
 	 * \brief Whether this contractor is idempotent (optional)
 	 */
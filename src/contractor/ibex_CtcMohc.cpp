@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Ene 8, 2013
-// Last Update : Ene 8, 2013
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_CtcMohc.h"
@@ -19,6 +19,7 @@ namespace ibex {
   const double CtcMohc::default_tau_mohc=0.9;
   const double CtcMohc::default_epsilon=0.1;
   const double CtcMohc::default_univ_newton_min_width=1e-8;
+  const double Function_OG::default_memo_ratio=0.9;
 
 
   /*********** amohc ******/
@@ -856,6 +857,10 @@ void Function_OG::OG_case3(list<int>& X_m, list<int>& X_nm, Interval& G_m){
 
 
 bool Function_OG::occurrence_grouping(IntervalVector& box, bool y_set, bool _og){
+    //the last grouping is reused if the box has not shrunk too much (see memo)
+    if(memo && og_memo && y_set==og_y_set && _og==og_og && og_reusable(box))
+        return og_worked;
+
     if(!gradient(box)) return false;
 
     bool worked=false;
@@ -869,9 +874,25 @@ bool Function_OG::occurrence_grouping(IntervalVector& box, bool y_set, bool _og)
            worked |= occurrence_grouping(i,_og);
 
     }
+    if(memo){
+        og_memo=true;
+        og_box=box;
+        og_y_set=y_set;
+        og_og=_og;
+        og_worked=worked;
+    }
     return worked;
 }
 
+bool Function_OG::og_reusable(const IntervalVector& box) const {
+    //the gradient (and so the grouping) computed in og_box is valid in any sub-box
+    for(int i=0; i<box.size(); i++){
+        if(!box[i].is_subset(og_box[i]) || box[i].diam() < memo_ratio*og_box[i].diam())
+            return false;
+    }
+    return true;
+}
+
 bool Function_OG::occurrence_grouping(int i, bool _og){
    //only variables with multiple occurrences are treated
 
@@ -1011,7 +1032,8 @@ Interval Function_OG::revise(IntervalVector& box, bool minrevise){
    return ev;
 }
 
-   Function_OG::Function_OG(const Function& ff) : _f(eso.get_x(),eso.get_y()), eso(ff.args(),ff.expr()){
+   Function_OG::Function_OG(const Function& ff) : memo(true), memo_ratio(default_memo_ratio),
+		   _f(eso.get_x(),eso.get_y()), eso(ff.args(),ff.expr()), og_memo(false), og_box(ff.nb_var()) {
 
 
        r_a.resize(_f.nb_var());
@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Ene 8, 2013
-// Last Update : Ene 8, 2013
+// Last Update : Oct 19, 2026
 //============================================================================
 
 
@@ -79,6 +79,22 @@ public:
 	/** performs a call to the MinRevise/MaxRevise algorithm using fog (see \link CtcHC4Revise \endlink, \link CtcMohc \endlink, <a href="http://www-sop.inria.fr/coprin/trombe/publis/mohc_aaai_2010.pdf">[ara10]</a>)**/
 	Interval revise(IntervalVector& box, bool minrevise);
 
+	/**
+	 * \brief Memoization of the grouping (true by default).
+	 *
+	 * If true, #occurrence_grouping(IntervalVector& , bool, bool) does nothing (the last
+	 * grouping is kept) if the box is a subset of the box of the last grouping, with a diameter
+	 * at least #memo_ratio times larger for each variable. The gradient of the last grouping is
+	 * valid in any sub-box, so the grouping is sound (but it may be less tight than a new one).
+	 */
+	bool memo;
+
+	/** Minimal shrinking ratio of the domains for reusing the grouping (see #memo) */
+	double memo_ratio;
+
+	/** Default memo_ratio, set to 0.9 */
+	static const double default_memo_ratio;
+
 
 private:
 
@@ -100,6 +116,9 @@ private:
 	void OG_case2(int i, Interval inf_G_Xa, Interval inf_G_Xb, Interval sup_G_Xa, Interval sup_G_Xb);
 	void OG_case3(list<int>& X_m, list<int>& X_nm, Interval& G_m);
 
+	/* true if the last grouping can be reused in the box (see #memo) */
+	bool og_reusable(const IntervalVector& box) const;
+
 	IntervalVector r_a;
 	IntervalVector r_b;
 	IntervalVector r_c;
@@ -124,6 +143,18 @@ private:
 	/*partial derivatives w.r.t. x_b*/
 	IntervalVector gb;
 
+	/* memo (see #memo): true if og_box, og_y_set, og_og
+	 * and og_worked describe the last grouping */
+	bool og_memo;
+
+	/* the box of the last grouping */
+	IntervalVector og_box;
+
+	/* the arguments of the last grouping and its result */
+	bool og_y_set;
+	bool og_og;
+	bool og_worked;
+
 	/*used for performing minrevise (resp. maxrevise),
 	 * it saves the constant: r_a * lb(xk) + r_b * ub(xk) for each occurrence xk */
 	IntervalVector aux;
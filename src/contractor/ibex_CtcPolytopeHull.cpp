@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Oct 31, 2013
-// Last Update : Oct 31, 2013
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_CtcPolytopeHull.h"
@@ -46,16 +46,26 @@ void CtcPolytopeHull::contract(IntervalVector& box) {
 		//	mylinearsolver->writeFile("LP.lp");
 		//		system ("cat LP.lp");
 		//cout << "[polytope-hull] box after LR: " << box << endl;
-		mylinearsolver->cleanConst();
+
+		// the rows kept by the relaxation are updated by the next linearization
+		if (!lr.keeps_rows(mylinearsolver)) mylinearsolver->cleanConst();
 	}
 	catch(EmptyBoxException&) {
 		box.set_empty(); // empty the box before exiting in case of EmptyBoxException
-		mylinearsolver->cleanConst();
+		if (!lr.keeps_rows(mylinearsolver)) mylinearsolver->cleanConst();
 		throw EmptyBoxException();
 	}
 
 }
 
+void CtcPolytopeHull::add_backtrackable(Cell& root) {
+	lr.add_backtrackable(root);
+}
+
+void CtcPolytopeHull::set_cell(Cell* cell) {
+	lr.set_cell(cell);
+}
+
 void CtcPolytopeHull::optimizer(IntervalVector& box) {
 
 	Interval opt(0.0);
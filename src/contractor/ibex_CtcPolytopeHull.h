@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Oct 31, 2013
-// Last Update : Oct 31, 2013
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #ifndef __IBEX_CTC_POLYTOPE_HULL_H__
@@ -52,6 +52,16 @@ public:
 
 	virtual void contract(IntervalVector& box);
 
+	/**
+	 * \brief Add the data required by the linear relaxation to the root cell.
+	 */
+	virtual void add_backtrackable(Cell& root);
+
+	/**
+	 * \brief Set the current cell of the linear relaxation.
+	 */
+	virtual void set_cell(Cell* cell);
+
 	virtual ~CtcPolytopeHull();
 
 protected:
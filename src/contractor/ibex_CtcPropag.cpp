@@ -129,6 +129,9 @@ void  CtcPropag::contract(IntervalVector& box) {
 
 		for (set<int>::iterator it=vars.begin(); it!=vars.end(); it++) {
 			int v=*it;
+			// old_box[v] is the initial domain if v is modified for the first time
+			if (changes() && old_box[v]!=box[v])
+				changes()->add(v,old_box[v]);
 			//cout << "   " << old_box[v] << " % " << box[v] << "   " << old_box[v].ratiodelta(box[v]) << endl;
 			//if (old_box[v].rel_distance(box[v])>=ratio) {
 			if (old_box[v].ratiodelta(box[v])>=ratio) {
@@ -155,6 +158,20 @@ void  CtcPropag::contract(IntervalVector& box) {
 
 }
 
+bool CtcPropag::reports_changes() const {
+	return true;
+}
+
 const double CtcPropag::default_ratio = __IBEX_DEFAULT_RATIO_PROPAG;
 
+void CtcPropag::add_backtrackable(Cell& root) {
+	for (int i=0; i<list.size(); i++)
+		list[i].add_backtrackable(root);
+}
+
+void CtcPropag::set_cell(Cell* cell) {
+	for (int i=0; i<list.size(); i++)
+		list[i].set_cell(cell);
+}
+
 } // namespace ibex
@@ -59,6 +59,21 @@ public:
 	 */
 	virtual void contract(IntervalVector& box);
 
+	/**
+	 * \brief Return true (the modified variables are reported).
+	 */
+	virtual bool reports_changes() const;
+
+	/**
+	 * \brief Add the data required by the sub-contractors to the root cell.
+	 */
+	virtual void add_backtrackable(Cell& root);
+
+	/**
+	 * \brief Set the current cell of the sub-contractors.
+	 */
+	virtual void set_cell(Cell* cell);
+
 	/** The list of contractors to propagate */
 	Array<Ctc> list;
 
@@ -41,6 +41,16 @@ void CtcUnion::contract(IntervalVector& box) {
 	}
 	box = result;
 	if (box.is_empty()) throw EmptyBoxException();
-} // end namespace ibex
+}
+
+void CtcUnion::add_backtrackable(Cell& root) {
+	for (int i=0; i<list.size(); i++)
+		list[i].add_backtrackable(root);
+}
 
+void CtcUnion::set_cell(Cell* cell) {
+	for (int i=0; i<list.size(); i++)
+		list[i].set_cell(cell);
 }
+
+} // end namespace ibex
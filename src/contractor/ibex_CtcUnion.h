@@ -60,6 +60,16 @@ public:
 	 */
 	virtual void contract(IntervalVector& box);
 
+	/**
+	 * \brief Add the data required by the sub-contractors to the root cell.
+	 */
+	virtual void add_backtrackable(Cell& root);
+
+	/**
+	 * \brief Set the current cell of the sub-contractors.
+	 */
+	virtual void set_cell(Cell* cell);
+
 	/**
 	 * \brief The list of sub-contractors.
 	 */
@@ -5,13 +5,14 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Apr 5, 2012
-// Last Update : Apr 5, 2012
+// Last Update : Oct 19, 2026
 //============================================================================
 
 
 #include "ibex_CompiledFunction.h"
 #include "ibex_Function.h"
 #include <algorithm>
+#include <math.h>
 
 using std::cout;
 using std::endl;
@@ -24,7 +25,10 @@ bool compare(const ExprNode* x, const ExprNode* y) { return (x->height>y->height
 
 }
 
-CompiledFunction::CompiledFunction() : 	n(0), code(NULL), nb_args(NULL), args(NULL) {
+const int CompiledFunction::jac_block = 8;
+
+CompiledFunction::CompiledFunction() : 	point_ok(false), vec_jac_ok(false), n(0), code(NULL), nb_args(NULL), args(NULL),
+		point_args(NULL), point_val(NULL), point_subnodes_ok(false), jac_adj(NULL), jac_active(NULL) {
 
 }
 
@@ -53,6 +57,189 @@ CompiledFunction::~CompiledFunction() {
 	for (int i=0; i<n; i++) delete[] args[i];
 	delete[] args;
 	delete[] nb_args;
+
+	if (point_args) {
+		delete[] point_args;
+		delete[] point_val;
+	}
+
+	if (jac_adj) {
+		delete[] jac_adj;
+		delete[] jac_active;
+	}
+}
+
+namespace {
+
+/*
+ * Index of a variable in the input vector, if e is
+ * a symbol or an index of a symbol (like x[i] or A[i][j]).
+ * Return -1 otherwise.
+ */
+int var_index(const ExprNode& e, const int* symbol_index) {
+	const ExprSymbol* x=dynamic_cast<const ExprSymbol*>(&e);
+	if (x) return symbol_index[x->key];
+
+	const ExprIndex* idx=dynamic_cast<const ExprIndex*>(&e);
+	if (!idx) return -1;
+
+	int i=var_index(idx->expr, symbol_index);
+	return i==-1? -1 : i+idx->index*idx->dim.size();
+}
+
+inline double point_max(double x, double y) {
+	if (x!=x || y!=y) return x+y; // NaN
+	return x>y? x : y;
+}
+
+inline double point_min(double x, double y) {
+	if (x!=x || y!=y) return x+y; // NaN
+	return x<y? x : y;
+}
+
+inline double point_sign(double x) {
+	return x>0? 1.0 : (x<0? -1.0 : x); // note: sign(NaN)=NaN
+}
+
+inline double point_pow(double x, int p) {
+	if (p<0) return 1.0/point_pow(x,-p);
+	double y=1.0;
+	while (p>0) {
+		if (p&1) y*=x;
+		p>>=1;
+		if (p>0) x*=x;
+	}
+	return y;
+}
+
+}
+
+bool CompiledFunction::compile_point_node(int i, const int* symbol_index) {
+	const ExprNode& e=nodes[i];
+	point_args[2*i]=point_args[2*i+1]=-1;
+
+	switch(code[i]) {
+	case SYM:
+	case IDX:
+		// a non-scalar symbol/index can only be used by
+		// an index (any other operation is rejected below)
+		if (e.dim.is_scalar()) {
+			point_args[2*i]=var_index(e, symbol_index);
+			return point_args[2*i]!=-1;
+		}
+		return true;
+	case CST:
+		if (e.dim.is_scalar())
+			point_val[i]=((const ExprConstant&) e).get_value().mid();
+		return true;
+	case ADD: case MUL: case SUB: case DIV:
+	case MAX: case MIN: case ATAN2:
+		point_args[2*i]  =nodes.rank(((const ExprBinaryOp&) e).left);
+		point_args[2*i+1]=nodes.rank(((const ExprBinaryOp&) e).right);
+		return e.dim.is_scalar();
+	case MINUS: case SIGN: case ABS: case POWER:
+	case SQR: case SQRT: case EXP: case LOG:
+	case COS: case SIN: case TAN: case ACOS: case ASIN: case ATAN:
+	case COSH: case SINH: case TANH: case ACOSH: case ASINH: case ATANH:
+		point_args[2*i]=nodes.rank(((const ExprUnaryOp&) e).expr);
+		return e.dim.is_scalar();
+	default:
+		// VEC, APPLY, CHI, and vector/matrix operations
+		return false;
+	}
+}
+
+void CompiledFunction::compile_point(const Array<const ExprSymbol>& x) {
+
+	if (point_args) { // already compiled
+		delete[] point_args;
+		delete[] point_val;
+	}
+
+	point_args=new int[2*n];
+	point_val=new double[n];
+
+	int* symbol_index=new int[x.size()];
+	int index=0;
+	for (int i=0; i<x.size(); i++) {
+		symbol_index[i]=index;
+		index+=x[i].dim.size();
+	}
+
+	point_args[0]=point_args[1]=-1;
+
+	// the root node is compiled last (see #compile_vec_jac)
+	point_subnodes_ok=true;
+	for (int i=1; point_subnodes_ok && i<n; i++)
+		point_subnodes_ok=compile_point_node(i, symbol_index);
+
+	point_ok = point_subnodes_ok && nodes[0].dim.is_scalar() && compile_point_node(0, symbol_index);
+
+	delete[] symbol_index;
+}
+
+void CompiledFunction::compile_vec_jac() {
+
+	if (jac_adj) { // already compiled
+		delete[] jac_adj;
+		delete[] jac_active;
+		jac_adj=NULL;
+		jac_active=NULL;
+	}
+
+	// the root node is a vector of scalar expressions
+	vec_jac_ok = code[0]==VEC && nodes[0].dim.is_vector() && point_subnodes_ok;
+
+	if (vec_jac_ok) {
+		jac_adj=new Interval[n*jac_block];
+		jac_active=new bool[n];
+	}
+}
+
+double CompiledFunction::point_eval(const Vector& x) const {
+	assert(point_ok);
+
+	double* v=point_val;
+	const int* a=point_args;
+
+	for (int i=n-1; i>=0; i--) {
+		const int i1=a[2*i];
+		const int i2=a[2*i+1];
+		switch(code[i]) {
+		case SYM:
+		case IDX:    if (i1!=-1) v[i]=x[i1]; break;
+		case CST:    break;
+		case ADD:    v[i]=v[i1]+v[i2]; break;
+		case MUL:    v[i]=v[i1]*v[i2]; break;
+		case SUB:    v[i]=v[i1]-v[i2]; break;
+		case DIV:    v[i]=v[i1]/v[i2]; break;
+		case MAX:    v[i]=point_max(v[i1],v[i2]); break;
+		case MIN:    v[i]=point_min(v[i1],v[i2]); break;
+		case ATAN2:  v[i]=::atan2(v[i1],v[i2]); break;
+		case MINUS:  v[i]=-v[i1]; break;
+		case SIGN:   v[i]=point_sign(v[i1]); break;
+		case ABS:    v[i]=::fabs(v[i1]); break;
+		case POWER:  v[i]=point_pow(v[i1],((const ExprPower&) nodes[i]).expon); break;
+		case SQR:    v[i]=v[i1]*v[i1]; break;
+		case SQRT:   v[i]=::sqrt(v[i1]); break;
+		case EXP:    v[i]=::exp(v[i1]); break;
+		case LOG:    v[i]=::log(v[i1]); break;
+		case COS:    v[i]=::cos(v[i1]); break;
+		case SIN:    v[i]=::sin(v[i1]); break;
+		case TAN:    v[i]=::tan(v[i1]); break;
+		case COSH:   v[i]=::cosh(v[i1]); break;
+		case SINH:   v[i]=::sinh(v[i1]); break;
+		case TANH:   v[i]=::tanh(v[i1]); break;
+		case ACOS:   v[i]=::acos(v[i1]); break;
+		case ASIN:   v[i]=::asin(v[i1]); break;
+		case ATAN:   v[i]=::atan(v[i1]); break;
+		case ACOSH:  v[i]=::acosh(v[i1]); break;
+		case ASINH:  v[i]=::asinh(v[i1]); break;
+		case ATANH:  v[i]=::atanh(v[i1]); break;
+		default: 	 assert(false);
+		}
+	}
+	return v[0];
 }
 
 void CompiledFunction::visit(const ExprNode& e) {
@@ -60,12 +60,64 @@ public:
 	template<class V>
 	void backward(const V& algo) const;
 
+	/**
+	 * Build the floating-point version of the code (see #point_eval).
+	 *
+	 * \param x - the arguments of the function (gives the index
+	 *             of each variable in the input vector).
+	 * \pre #compile must have been called before.
+	 */
+	void compile_point(const Array<const ExprSymbol>& x);
+
+	/**
+	 * Prepare the calculation of the Jacobian matrix in
+	 * a single backward sweep (see #vec_jac_ok).
+	 *
+	 * \pre #compile_point must have been called before.
+	 */
+	void compile_vec_jac();
+
+	/**
+	 * Evaluate the function at a point with floating-point arithmetic.
+	 *
+	 * This evaluation runs the same code as the forward algorithms
+	 * but with doubles instead of interval domains: there is no
+	 * rounding control, so the result is only an approximation.
+	 * The result is NaN if x is outside the definition domain.
+	 *
+	 * \pre #point_ok must be true.
+	 */
+	double point_eval(const Vector& x) const;
+
+	/**
+	 * True if the function can be evaluated with #point_eval, i.e., if
+	 * the function is real-valued and all the operations are
+	 * between scalars (no vector/matrix operation, apply or chi).
+	 */
+	bool point_ok;
+
+	/**
+	 * True if the function is a vector of real-valued expressions
+	 * that only contain operations between scalars (same condition
+	 * as #point_ok, except for the root node). The Jacobian matrix can
+	 * then be calculated in a single backward sweep (see Gradient).
+	 */
+	bool vec_jac_ok;
+
+	/**
+	 * Number of rows of the Jacobian matrix calculated in
+	 * the same backward sweep (see Gradient::jacobian).
+	 */
+	static const int jac_block;
+
 	/**
 	 * Print the structure to the standard output.
 	 */
 	void print() const;
 
 	friend class Function;
+	friend class Gradient;
+	friend class MultiBoxHC4Revise;
 
 protected:
 	typedef enum {
@@ -139,6 +191,23 @@ protected:
 	mutable ExprLabel*** args;
 
 	mutable int ptr;
+
+	// floating-point version of the code (see #point_eval):
+	// for each node i, the index of the arguments in "point_val" (pos. 2i and 2i+1)
+	// or, for a symbol (or an index of a symbol), the index of the variable in x.
+	int* point_args;
+	mutable double* point_val;
+	// true if all the nodes except the root have a floating-point version
+	bool point_subnodes_ok;
+
+	// floating-point version of the ith node (return false if impossible)
+	bool compile_point_node(int i, const int* symbol_index);
+
+	// adjoints of the nodes for a block of rows of the Jacobian
+	// (see #vec_jac_ok). Lanes of the same node are contiguous.
+	mutable Interval* jac_adj;
+	// whether the adjoints of a node have been set in the current block
+	mutable bool* jac_active;
 };
 
 template<class V>
@@ -18,6 +18,8 @@
 #include "ibex_Gradient.h"
 #include "ibex_FunctionBuild.cpp_"
 
+#include <limits>
+
 using namespace std;
 
 namespace ibex {
@@ -55,6 +57,17 @@ Domain& Function::eval_domain(const IntervalVector& box) const {
 	return Eval().eval(*this,box);
 }
 
+double Function::eval_point(const Vector& x) const {
+	assert(expr().dim.is_scalar());
+
+	if (cf.point_ok)
+		return cf.point_eval(x);
+	else {
+		Interval y=eval(x);
+		return y.is_empty()? std::numeric_limits<double>::quiet_NaN() : y.mid();
+	}
+}
+
 
 Domain& Function::eval_affine2_domain(const IntervalVector& box) const {
 	return Affine2Eval().eval(*this,box);
@@ -149,6 +162,12 @@ void Function::jacobian(const IntervalVector& x, IntervalMatrix& J) const {
 	assert(expr().deco.d);
 	assert(expr().deco.g);
 
+	if (cf.vec_jac_ok) {
+		// all the rows in one backward sweep
+		Gradient().jacobian(*this,x,J);
+		return;
+	}
+
 	// calculate the gradient of each component of f
 	for (int i=0; i<image_dim(); i++) {
 		(*this)[i].gradient(x,J[i]);
@@ -24,6 +24,7 @@
 namespace ibex {
 
 class System;
+class SystemCache;
 
 /**
  * \ingroup function
@@ -621,6 +622,23 @@ public:
 	 */
 	Domain& eval_domain(const IntervalVector& box) const;
 
+	/**
+	 * \brief Calculate f(x) with floating-point arithmetic.
+	 *
+	 * This evaluation is not rigorous (there is no rounding control)
+	 * but it is much cheaper than the interval evaluation of the
+	 * degenerated box [x,x]. It is meant for heuristics, like the
+	 * search of candidate points in the optimizer; the interval
+	 * evaluation should be used to validate the final result.
+	 *
+	 * Return NaN if x is outside the definition domain of f.
+	 *
+	 * \pre f must be real-valued.
+	 * \note If f contains vector/matrix operations, the function is
+	 * evaluated with interval arithmetic instead (and the midpoint is returned).
+	 */
+	double eval_point(const Vector& x) const;
+
 	/**
 	 * \brief Calculate f(box) using affine arithmetic.
 	 */
@@ -771,6 +789,8 @@ protected:
 	void print_expr(std::ostream& os) const;
 
 private:
+	friend class SystemCache;
+
 	/**
 	 * \brief True if all the arguments are scalar
 	 *
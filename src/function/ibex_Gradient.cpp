@@ -82,6 +82,170 @@ void Gradient::jacobian(const Function& f, const Array<Domain>& d, IntervalMatri
 	}
 }
 
+namespace {
+
+/*
+ * Return the adjoints of the jth node (initialized
+ * to zero if the node is met for the first time).
+ */
+inline Interval* lanes(Interval* adj, bool* active, int j) {
+	Interval* x=adj+j*CompiledFunction::jac_block;
+	if (!active[j]) {
+		active[j]=true;
+		for (int k=0; k<CompiledFunction::jac_block; k++) x[k]=Interval::ZERO;
+	}
+	return x;
+}
+
+/*
+ * Add y*c to the adjoints of the jth node.
+ * Zero adjoints (components that do not depend on
+ * the current node) are skipped.
+ */
+inline void acc(Interval* adj, bool* active, int j, const Interval* y, int b, const Interval& c) {
+	Interval* x=lanes(adj,active,j);
+	for (int k=0; k<b; k++)
+		if (y[k]!=Interval::ZERO) x[k] += y[k]*c;
+}
+
+/*
+ * Add (or subtract) y to the adjoints of the jth node.
+ */
+inline void acc(Interval* adj, bool* active, int j, const Interval* y, int b, bool minus=false) {
+	Interval* x=lanes(adj,active,j);
+	if (minus)
+		for (int k=0; k<b; k++) x[k] -= y[k];
+	else
+		for (int k=0; k<b; k++) x[k] += y[k];
+}
+
+}
+
+void Gradient::jacobian(const Function& f, const IntervalVector& box, IntervalMatrix& J) const {
+	const CompiledFunction& cf=f.cf;
+	assert(cf.vec_jac_ok);
+
+	f.eval_domain(box);
+
+	J.clear();
+
+	const ExprVector& root=(const ExprVector&) cf.nodes[0];
+	const int m=root.length();
+	const int* a=cf.point_args;
+	Interval* adj=cf.jac_adj;
+	bool* active=cf.jac_active;
+
+	for (int k0=0; k0<m; k0+=CompiledFunction::jac_block) {
+
+		const int b = m-k0 < CompiledFunction::jac_block ? m-k0 : CompiledFunction::jac_block;
+
+		for (int i=1; i<cf.n; i++) active[i]=false;
+
+		for (int k=0; k<b; k++)
+			lanes(adj,active,cf.nodes.rank(root.arg(k0+k)))[k] += 1.0;
+
+		// nodes are sorted by decreasing height so all the adjoints
+		// of a node are known when the node is reached.
+		for (int i=1; i<cf.n; i++) {
+			if (!active[i]) continue; // no component depends on this node
+
+			const Interval* y=adj+i*CompiledFunction::jac_block;
+			const int i1=a[2*i];
+			const int i2=a[2*i+1];
+			// domains of the arguments (only read for operators)
+			const bool op=cf.code[i]!=CompiledFunction::IDX;
+			const Interval& x1=op && cf.nb_args[i]>0? cf.args[i][1]->d->i() : Interval::EMPTY_SET;
+			const Interval& x2=op && cf.nb_args[i]>1? cf.args[i][2]->d->i() : Interval::EMPTY_SET;
+
+			switch(cf.code[i]) {
+			case CompiledFunction::SYM:
+			case CompiledFunction::IDX:
+				if (i1!=-1)
+					for (int k=0; k<b; k++) J[k0+k][i1] += y[k];
+				break;
+			case CompiledFunction::CST:
+				break;
+			case CompiledFunction::ADD:
+				acc(adj,active,i1,y,b);
+				acc(adj,active,i2,y,b);
+				break;
+			case CompiledFunction::SUB:
+				acc(adj,active,i1,y,b);
+				acc(adj,active,i2,y,b,true);
+				break;
+			case CompiledFunction::MUL:
+				acc(adj,active,i1,y,b,x2);
+				acc(adj,active,i2,y,b,x1);
+				break;
+			case CompiledFunction::DIV:
+				acc(adj,active,i1,y,b,1.0/x2);
+				acc(adj,active,i2,y,b,-x1/sqr(x2));
+				break;
+			case CompiledFunction::MAX:
+			case CompiledFunction::MIN:
+			{
+				Interval gx1,gx2;
+				bool is_max=cf.code[i]==CompiledFunction::MAX;
+				if (is_max? x1.lb() > x2.ub() : x1.lb() < x2.ub()) {
+					gx1=Interval::ONE;
+					gx2=Interval::ZERO;
+				}
+				else if (is_max? x2.lb() > x1.ub() : x2.lb() < x1.ub()) {
+					gx1=Interval::ZERO;
+					gx2=Interval::ONE;
+				} else {
+					gx1=Interval(0,1);
+					gx2=Interval(0,1);
+				}
+				acc(adj,active,i1,y,b,gx1);
+				acc(adj,active,i2,y,b,gx2);
+				break;
+			}
+			case CompiledFunction::ATAN2:
+			{
+				Interval r=sqr(x1)+sqr(x2);
+				acc(adj,active,i1,y,b,x2/r);
+				acc(adj,active,i2,y,b,-x1/r);
+				break;
+			}
+			case CompiledFunction::MINUS: acc(adj,active,i1,y,b,true); break;
+			case CompiledFunction::SIGN:
+				if (x1.contains(0)) acc(adj,active,i1,y,b,Interval::POS_REALS);
+				else lanes(adj,active,i1); // derivative is zero
+				break;
+			case CompiledFunction::ABS:
+				if (x1.lb()>=0) acc(adj,active,i1,y,b);
+				else if (x1.ub()<=0) acc(adj,active,i1,y,b,true);
+				else acc(adj,active,i1,y,b,Interval(-1,1));
+				break;
+			case CompiledFunction::POWER:
+			{
+				int p=((const ExprPower&) cf.nodes[i]).expon;
+				acc(adj,active,i1,y,b,p*pow(x1,p-1));
+				break;
+			}
+			case CompiledFunction::SQR:   acc(adj,active,i1,y,b,2.0*x1); break;
+			case CompiledFunction::SQRT:  acc(adj,active,i1,y,b,0.5/sqrt(x1)); break;
+			case CompiledFunction::EXP:   acc(adj,active,i1,y,b,exp(x1)); break;
+			case CompiledFunction::LOG:   acc(adj,active,i1,y,b,1.0/x1); break;
+			case CompiledFunction::COS:   acc(adj,active,i1,y,b,-sin(x1)); break;
+			case CompiledFunction::SIN:   acc(adj,active,i1,y,b,cos(x1)); break;
+			case CompiledFunction::TAN:   acc(adj,active,i1,y,b,1.0+sqr(tan(x1))); break;
+			case CompiledFunction::COSH:  acc(adj,active,i1,y,b,sinh(x1)); break;
+			case CompiledFunction::SINH:  acc(adj,active,i1,y,b,cosh(x1)); break;
+			case CompiledFunction::TANH:  acc(adj,active,i1,y,b,1.0-sqr(tanh(x1))); break;
+			case CompiledFunction::ACOS:  acc(adj,active,i1,y,b,-1.0/sqrt(1.0-sqr(x1))); break;
+			case CompiledFunction::ASIN:  acc(adj,active,i1,y,b,1.0/sqrt(1.0-sqr(x1))); break;
+			case CompiledFunction::ATAN:  acc(adj,active,i1,y,b,1.0/(1.0+sqr(x1))); break;
+			case CompiledFunction::ACOSH: acc(adj,active,i1,y,b,1.0/sqrt(sqr(x1)-1.0)); break;
+			case CompiledFunction::ASINH: acc(adj,active,i1,y,b,1.0/sqrt(1.0+sqr(x1))); break;
+			case CompiledFunction::ATANH: acc(adj,active,i1,y,b,1.0/(1.0-sqr(x1))); break;
+			default: assert(false);
+			}
+		}
+	}
+}
+
 void Gradient::vector_fwd(const ExprVector& v, const ExprLabel** x, ExprLabel& y) {
 	if (v.dim.is_vector())
 		y.g->v().clear();
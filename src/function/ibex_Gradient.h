@@ -39,6 +39,17 @@ public:
 	 */
 	void jacobian(const Function& f, const Array<Domain>& d, IntervalMatrix& J) const;
 
+	/**
+	 * \brief Calculate the Jacobian on the box \a box and store the result in \a J.
+	 *
+	 * Vector mode: the function is evaluated once and the adjoints of
+	 * all the components (by blocks of CompiledFunction::jac_block rows)
+	 * are propagated in the same backward sweep.
+	 *
+	 * \pre f.cf.vec_jac_ok must be true.
+	 */
+	void jacobian(const Function& f, const IntervalVector& box, IntervalMatrix& J) const;
+
 	inline void index_fwd(const ExprIndex& , const ExprLabel& , ExprLabel& ) { /* nothing to do */ }
 	       void vector_fwd(const ExprVector& v, const ExprLabel** s, ExprLabel& y);
 	       void cst_fwd(const ExprConstant&, ExprLabel& y)                                  { y.g->clear(); }
@@ -0,0 +1,229 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_MultiBoxHC4Revise.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "ibex_MultiBoxHC4Revise.h"
+#include "ibex_HC4Revise.h"
+
+namespace ibex {
+
+const int MultiBoxHC4Revise::default_block_size = 16;
+
+namespace {
+
+// status of a box of the block
+enum { ACTIVE, INACTIVE, EMPTY };
+
+}
+
+// apply "e" to all the active boxes
+#define FWD(e)   for (int k=0; k<b; k++) if (status[k]==ACTIVE) y[k]=(e);
+// apply the projection "e" to all the active boxes
+#define BWD(e)   for (int k=0; k<b; k++) if (status[k]==ACTIVE && !(e)) status[k]=EMPTY;
+
+MultiBoxHC4Revise::MultiBoxHC4Revise(const Function& f, int block_size) : f(f), block_size(block_size), val(NULL), status(NULL) {
+	assert(block_size>0);
+
+	if (f.cf.point_ok) {
+		val=new Interval[f.cf.n*block_size];
+		status=new int[block_size];
+	}
+}
+
+MultiBoxHC4Revise::~MultiBoxHC4Revise() {
+	if (val) {
+		delete[] val;
+		delete[] status;
+	}
+}
+
+int MultiBoxHC4Revise::proj(const Interval& y, IntervalVector* boxes, int K, bool* inactive) {
+	IntervalVector** p=new IntervalVector*[K];
+	for (int k=0; k<K; k++) p[k]=&boxes[k];
+	int nb_nonempty=proj_all(y,p,K,inactive);
+	delete[] p;
+	return nb_nonempty;
+}
+
+int MultiBoxHC4Revise::proj(const Interval& y, Array<IntervalVector>& boxes, bool* inactive) {
+	IntervalVector** p=new IntervalVector*[boxes.size()];
+	for (int k=0; k<boxes.size(); k++) p[k]=&boxes[k];
+	int nb_nonempty=proj_all(y,p,boxes.size(),inactive);
+	delete[] p;
+	return nb_nonempty;
+}
+
+int MultiBoxHC4Revise::proj_all(const Interval& y, IntervalVector** boxes, int K, bool* inactive) {
+	int nb_nonempty=0;
+
+	for (int k0=0; k0<K; k0+=block_size) {
+		const int b = K-k0 < block_size ? K-k0 : block_size;
+		proj_block(y, boxes+k0, b, inactive? inactive+k0 : NULL);
+		for (int k=k0; k<k0+b; k++)
+			if (!boxes[k]->is_empty()) nb_nonempty++;
+	}
+
+	return nb_nonempty;
+}
+
+Interval* MultiBoxHC4Revise::block(const CompiledFunction& cf, int i, int j) {
+	switch(cf.code[i]) {
+	case CompiledFunction::SYM:
+	case CompiledFunction::IDX:
+	case CompiledFunction::CST:
+		return NULL; // (point_args is not a node for a symbol)
+	default:
+		int arg=cf.point_args[2*i+j];
+		return arg==-1 ? NULL : val+arg*block_size;
+	}
+}
+
+void MultiBoxHC4Revise::proj_block(const Interval& yy, IntervalVector** boxes, int b, bool* inactive) {
+
+	if (!val) {
+		// no batch possible: one box at a time
+		Domain d(Dim::scalar());
+		d.i()=yy;
+		for (int k=0; k<b; k++) {
+			bool in=false;
+			if (!boxes[k]->is_empty()) {
+				try {
+					in=HC4Revise().proj(f,d,*boxes[k]);
+				} catch(EmptyBoxException&) {
+					boxes[k]->set_empty();
+				}
+			}
+			if (inactive) inactive[k]=in;
+		}
+		return;
+	}
+
+	const CompiledFunction& cf=f.cf;
+	const int* a=cf.point_args;
+	const int L=block_size;
+
+	for (int k=0; k<b; k++)
+		status[k]=boxes[k]->is_empty()? EMPTY : ACTIVE;
+
+	// ============================ forward ============================
+	for (int i=cf.n-1; i>=0; i--) {
+		Interval* y=val+i*L;
+		const Interval* x1=block(cf,i,0);
+		const Interval* x2=block(cf,i,1);
+
+		switch(cf.code[i]) {
+		case CompiledFunction::SYM:
+		case CompiledFunction::IDX:
+			// a non-scalar symbol is only used through indices
+			if (a[2*i]!=-1) FWD((*boxes[k])[a[2*i]]);
+			break;
+		case CompiledFunction::CST:
+			// (the domain of a constant may be contracted by the backward phase)
+			if (cf.nodes[i].dim.is_scalar()) FWD(((const ExprConstant&) cf.nodes[i]).get_value());
+			break;
+		case CompiledFunction::ADD:    FWD(x1[k]+x2[k]); break;
+		case CompiledFunction::MUL:    FWD(x1[k]*x2[k]); break;
+		case CompiledFunction::SUB:    FWD(x1[k]-x2[k]); break;
+		case CompiledFunction::DIV:    FWD(x1[k]/x2[k]); break;
+		case CompiledFunction::MAX:    FWD(max(x1[k],x2[k])); break;
+		case CompiledFunction::MIN:    FWD(min(x1[k],x2[k])); break;
+		case CompiledFunction::ATAN2:  FWD(atan2(x1[k],x2[k])); break;
+		case CompiledFunction::MINUS:  FWD(-x1[k]); break;
+		case CompiledFunction::SIGN:   FWD(sign(x1[k])); break;
+		case CompiledFunction::ABS:    FWD(abs(x1[k])); break;
+		case CompiledFunction::POWER:  FWD(pow(x1[k],((const ExprPower&) cf.nodes[i]).expon)); break;
+		case CompiledFunction::SQR:    FWD(sqr(x1[k])); break;
+		case CompiledFunction::SQRT:   FWD(sqrt(x1[k])); break;
+		case CompiledFunction::EXP:    FWD(exp(x1[k])); break;
+		case CompiledFunction::LOG:    FWD(log(x1[k])); break;
+		case CompiledFunction::COS:    FWD(cos(x1[k])); break;
+		case CompiledFunction::SIN:    FWD(sin(x1[k])); break;
+		case CompiledFunction::TAN:    FWD(tan(x1[k])); break;
+		case CompiledFunction::COSH:   FWD(cosh(x1[k])); break;
+		case CompiledFunction::SINH:   FWD(sinh(x1[k])); break;
+		case CompiledFunction::TANH:   FWD(tanh(x1[k])); break;
+		case CompiledFunction::ACOS:   FWD(acos(x1[k])); break;
+		case CompiledFunction::ASIN:   FWD(asin(x1[k])); break;
+		case CompiledFunction::ATAN:   FWD(atan(x1[k])); break;
+		case CompiledFunction::ACOSH:  FWD(acosh(x1[k])); break;
+		case CompiledFunction::ASINH:  FWD(asinh(x1[k])); break;
+		case CompiledFunction::ATANH:  FWD(atanh(x1[k])); break;
+		default: assert(false);
+		}
+	}
+
+	// ============================= root ==============================
+	for (int k=0; k<b; k++) {
+		if (inactive) inactive[k]=false;
+		if (status[k]!=ACTIVE) continue;
+		Interval& root=val[k];
+		if (root.is_subset(yy)) {
+			status[k]=INACTIVE;
+			if (inactive) inactive[k]=true;
+		}
+		else if ((root &= yy).is_empty())
+			status[k]=EMPTY;
+	}
+
+	// =========================== backward ============================
+	for (int i=0; i<cf.n; i++) {
+		const Interval* y=val+i*L;
+		Interval* x1=block(cf,i,0);
+		Interval* x2=block(cf,i,1);
+
+		switch(cf.code[i]) {
+		case CompiledFunction::SYM:
+		case CompiledFunction::IDX:
+		case CompiledFunction::CST:    break;
+		case CompiledFunction::ADD:    BWD(bwd_add(y[k],x1[k],x2[k])); break;
+		case CompiledFunction::MUL:    BWD(bwd_mul(y[k],x1[k],x2[k])); break;
+		case CompiledFunction::SUB:    BWD(bwd_sub(y[k],x1[k],x2[k])); break;
+		case CompiledFunction::DIV:    BWD(bwd_div(y[k],x1[k],x2[k])); break;
+		case CompiledFunction::MAX:    BWD(bwd_max(y[k],x1[k],x2[k])); break;
+		case CompiledFunction::MIN:    BWD(bwd_min(y[k],x1[k],x2[k])); break;
+		case CompiledFunction::ATAN2:  BWD(bwd_atan2(y[k],x1[k],x2[k])); break;
+		case CompiledFunction::MINUS:  BWD(!(x1[k] &= -y[k]).is_empty()); break;
+		case CompiledFunction::SIGN:   BWD(bwd_sign(y[k],x1[k])); break;
+		case CompiledFunction::ABS:    BWD(bwd_abs(y[k],x1[k])); break;
+		case CompiledFunction::POWER:  BWD(bwd_pow(y[k],((const ExprPower&) cf.nodes[i]).expon,x1[k])); break;
+		case CompiledFunction::SQR:    BWD(bwd_sqr(y[k],x1[k])); break;
+		case CompiledFunction::SQRT:   BWD(bwd_sqrt(y[k],x1[k])); break;
+		case CompiledFunction::EXP:    BWD(bwd_exp(y[k],x1[k])); break;
+		case CompiledFunction::LOG:    BWD(bwd_log(y[k],x1[k])); break;
+		case CompiledFunction::COS:    BWD(bwd_cos(y[k],x1[k])); break;
+		case CompiledFunction::SIN:    BWD(bwd_sin(y[k],x1[k])); break;
+		case CompiledFunction::TAN:    BWD(bwd_tan(y[k],x1[k])); break;
+		case CompiledFunction::COSH:   BWD(bwd_cosh(y[k],x1[k])); break;
+		case CompiledFunction::SINH:   BWD(bwd_sinh(y[k],x1[k])); break;
+		case CompiledFunction::TANH:   BWD(bwd_tanh(y[k],x1[k])); break;
+		case CompiledFunction::ACOS:   BWD(bwd_acos(y[k],x1[k])); break;
+		case CompiledFunction::ASIN:   BWD(bwd_asin(y[k],x1[k])); break;
+		case CompiledFunction::ATAN:   BWD(bwd_atan(y[k],x1[k])); break;
+		case CompiledFunction::ACOSH:  BWD(bwd_acosh(y[k],x1[k])); break;
+		case CompiledFunction::ASINH:  BWD(bwd_asinh(y[k],x1[k])); break;
+		case CompiledFunction::ATANH:  BWD(bwd_atanh(y[k],x1[k])); break;
+		default: assert(false);
+		}
+	}
+
+	// ========================= read the boxes ========================
+	for (int i=0; i<cf.n; i++) {
+		if ((cf.code[i]!=CompiledFunction::SYM && cf.code[i]!=CompiledFunction::IDX) || a[2*i]==-1) continue;
+		const Interval* x=val+i*L;
+		const int v=a[2*i];
+		for (int k=0; k<b; k++)
+			if (status[k]==ACTIVE && ((*boxes[k])[v] &= x[k]).is_empty())
+				status[k]=EMPTY;
+	}
+
+	for (int k=0; k<b; k++)
+		if (status[k]==EMPTY) boxes[k]->set_empty();
+}
+
+} // namespace ibex
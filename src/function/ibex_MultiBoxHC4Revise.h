@@ -0,0 +1,110 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_MultiBoxHC4Revise.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_MULTI_BOX_HC4_REVISE_H__
+#define __IBEX_MULTI_BOX_HC4_REVISE_H__
+
+#include "ibex_Function.h"
+
+namespace ibex {
+
+/**
+ * \ingroup symbolic
+ * \brief HC4Revise on several boxes at once.
+ *
+ * Projects f(x)=y onto a set of (typically small and similar) boxes,
+ * e.g., the cells of a paving. This is only a batching API: the boxes
+ * are contracted by blocks of #block_size boxes, so that the forward and
+ * backward phases walk through the code of the function once per block
+ * instead of once per box. At each node, the interval operations are the
+ * usual (scalar) ones of the library, applied to each box of the block
+ * in turn. There is no SIMD arithmetic.
+ *
+ * The result is the same as calling #ibex::HC4Revise (in interval mode)
+ * on each box separately.
+ *
+ * The batch is only possible for real-valued functions with operations
+ * between scalars (see #ibex::CompiledFunction::point_ok). For the other
+ * functions, #ibex::HC4Revise is called on each box.
+ */
+class MultiBoxHC4Revise {
+public:
+	/**
+	 * \brief Create the batch projection of f.
+	 *
+	 * \param f        - the function
+	 * \param block_size - the number of boxes contracted together.
+	 */
+	MultiBoxHC4Revise(const Function& f, int block_size=default_block_size);
+
+	/**
+	 * \brief Delete this.
+	 */
+	~MultiBoxHC4Revise();
+
+	/**
+	 * \brief Project f(x)=y onto each box.
+	 *
+	 * A box is set to the empty box if it does not contain any
+	 * solution of f(x)=y (no exception is thrown).
+	 *
+	 * \param inactive - if not NULL, inactive[k] is set to true
+	 *                   if f(boxes[k]) is included in y (inactive constraint
+	 *                   in the kth box). The array must have K elements.
+	 * \return the number of boxes that are not empty.
+	 */
+	int proj(const Interval& y, IntervalVector* boxes, int K, bool* inactive=NULL);
+
+	/**
+	 * \brief Project f(x)=y onto each box of an array.
+	 *
+	 * \see #proj(const Interval&, IntervalVector*, int, bool*).
+	 */
+	int proj(const Interval& y, Array<IntervalVector>& boxes, bool* inactive=NULL);
+
+	/**
+	 * \brief The function.
+	 */
+	const Function& f;
+
+	/**
+	 * \brief Number of boxes contracted together.
+	 */
+	const int block_size;
+
+	/**
+	 * \brief Default block size, set to 16.
+	 */
+	static const int default_block_size;
+
+private:
+	MultiBoxHC4Revise(const MultiBoxHC4Revise&); // forbidden
+
+	// contract boxes[0],...,boxes[K-1], block by block
+	int proj_all(const Interval& y, IntervalVector** boxes, int K, bool* inactive);
+
+	// contract boxes[0],...,boxes[b-1] with b<=block_size
+	void proj_block(const Interval& y, IntervalVector** boxes, int b, bool* inactive);
+
+	// domains in the block of the jth argument (j=0 or 1) of the ith node
+	// (NULL if the node has no such argument)
+	Interval* block(const CompiledFunction& cf, int i, int j);
+
+	// domains of the nodes: the domain of the ith node
+	// for the kth box of the block is val[i*block_size+k].
+	Interval* val;
+
+	// status of each box of the block (see the .cpp)
+	int* status;
+};
+
+} // namespace ibex
+
+#endif // __IBEX_MULTI_BOX_HC4_REVISE_H__
@@ -156,6 +156,7 @@ public:
 	std::pair<const ExprNode*, const Interval*> is_thick_equality() const;
 
 protected:
+	friend class SystemCache;
 	bool own_f;
 };
 
@@ -0,0 +1,304 @@
+/* ============================================================================
+ * I B E X - Parallel evaluation of the components of a function
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_ParallelFnc.h"
+#include "ibex_Setting.h"
+
+#ifdef _IBEX_WITH_THREADS_
+#include <pthread.h>
+#include <unistd.h>
+#endif
+#include <map>
+
+using namespace std;
+
+namespace ibex {
+
+const int ParallelFnc::default_min_nodes = 1000;
+
+#ifdef _IBEX_WITH_THREADS_
+
+namespace {
+
+// number of chunks per thread (for load balancing)
+const int CHUNKS_PER_THREAD = 4;
+
+int nb_processors() {
+#ifdef _SC_NPROCESSORS_ONLN
+	long n=sysconf(_SC_NPROCESSORS_ONLN);
+	return n<1 ? 1 : (int) n;
+#else
+	return 1;
+#endif
+}
+
+}
+
+struct ParallelFnc::Pool {
+	pthread_t* threads;
+	int nb;               // number of threads in the pool
+	pthread_mutex_t mutex;
+	pthread_cond_t start; // a new task is available
+	pthread_cond_t done;  // all the threads have finished the task
+	int round;            // number of tasks posted so far
+	int next;             // next chunk to process
+	int active;           // number of threads working on the current task
+	bool failed;          // an exception has been raised
+};
+
+#endif
+
+ParallelFnc::ParallelFnc(const Function& f, int nb_threads, int min_nodes) : Fnc(f.nb_var(), f.image_dim()), f(f),
+		_nb_threads(1), pool(NULL), job(EVAL), in(NULL), out_vec(NULL), out_mat(NULL) {
+#ifdef _IBEX_WITH_THREADS_
+	if (nb_threads<0) nb_threads=nb_processors();
+	if (min_nodes<1) min_nodes=1;
+
+	int m=image_dim();
+
+	// the components (and their used variables) are
+	// generated before any thread is started
+	map<const Function*,int> count;
+	for (int i=0; i<m; i++) {
+		const Function& fi=f[i];
+		fi.nb_used_vars();
+		count[&fi]++;
+	}
+
+	int total=0;
+	for (int i=0; i<m; i++) {
+		const Function& fi=f[i];
+		if (count[&fi]>1 || &fi==&f)
+			shared.push_back(i);
+		else {
+			comp.push_back(i);
+			total+=fi.nb_nodes();
+		}
+	}
+
+	int nb=total/min_nodes;
+	if (nb>CHUNKS_PER_THREAD*nb_threads) nb=CHUNKS_PER_THREAD*nb_threads;
+
+	if (nb_threads<2 || nb<2) {
+		// not enough work: f is evaluated sequentially
+		comp.clear();
+		shared.clear();
+		return;
+	}
+
+	// chunks of consecutive components with about total/nb nodes
+	chunk.push_back(0);
+	double nodes=0;
+	for (unsigned int j=0; j+1<comp.size(); j++) {
+		nodes+=f[comp[j]].nb_nodes();
+		if (nodes*nb >= ((double) total)*chunk.size())
+			chunk.push_back(j+1);
+	}
+	chunk.push_back(comp.size());
+
+	int n=chunk.size()-1;
+	_nb_threads = nb_threads < n ? nb_threads : n;
+
+	pool=new Pool();
+	pool->nb=_nb_threads-1; // the calling thread also works
+	pool->round=0;
+	pool->next=0;
+	pool->active=0;
+	pool->failed=false;
+	pthread_mutex_init(&pool->mutex,NULL);
+	pthread_cond_init(&pool->start,NULL);
+	pthread_cond_init(&pool->done,NULL);
+	pool->threads=new pthread_t[pool->nb];
+
+	// if a thread cannot be created, the pool is
+	// reduced to the threads started so far
+	int nb_created=0;
+	while (nb_created<pool->nb && pthread_create(&pool->threads[nb_created], NULL, work, (void*) this)==0)
+		nb_created++;
+
+	pool->nb=nb_created;
+	_nb_threads=nb_created+1;
+
+	if (nb_created==0) {
+		// no thread at all: f is evaluated sequentially
+		pthread_cond_destroy(&pool->done);
+		pthread_cond_destroy(&pool->start);
+		pthread_mutex_destroy(&pool->mutex);
+		delete[] pool->threads;
+		delete pool;
+		pool=NULL;
+		comp.clear();
+		chunk.clear();
+		shared.clear();
+	}
+#endif
+}
+
+ParallelFnc::~ParallelFnc() {
+#ifdef _IBEX_WITH_THREADS_
+	if (pool) {
+		pthread_mutex_lock(&pool->mutex);
+		job=STOP;
+		pool->round++;
+		pthread_cond_broadcast(&pool->start);
+		pthread_mutex_unlock(&pool->mutex);
+
+		for (int t=0; t<pool->nb; t++)
+			pthread_join(pool->threads[t], NULL);
+
+		pthread_cond_destroy(&pool->done);
+		pthread_cond_destroy(&pool->start);
+		pthread_mutex_destroy(&pool->mutex);
+		delete[] pool->threads;
+		delete pool;
+	}
+#endif
+}
+
+#ifdef _IBEX_WITH_THREADS_
+
+void* ParallelFnc::work(void* arg) {
+	const ParallelFnc& pf=*((const ParallelFnc*) arg);
+	Pool& p=*pf.pool;
+	int round=0;
+
+	while (true) {
+		pthread_mutex_lock(&p.mutex);
+		while (p.round==round)
+			pthread_cond_wait(&p.start, &p.mutex);
+		round=p.round;
+		bool stop=pf.job==STOP;
+		pthread_mutex_unlock(&p.mutex);
+
+		if (stop) return NULL;
+
+		pf.run();
+
+		pthread_mutex_lock(&p.mutex);
+		if (--p.active==0) pthread_cond_signal(&p.done);
+		pthread_mutex_unlock(&p.mutex);
+	}
+}
+
+void ParallelFnc::run() const {
+	Pool& p=*pool;
+	int nb=chunk.size()-1;
+
+	while (true) {
+		pthread_mutex_lock(&p.mutex);
+		int k=p.next++;
+		pthread_mutex_unlock(&p.mutex);
+
+		if (k>=nb) return;
+
+		try {
+			for (int j=chunk[k]; j<chunk[k+1]; j++)
+				run(comp[j]);
+		} catch(...) {
+			pthread_mutex_lock(&p.mutex);
+			p.failed=true;
+			pthread_mutex_unlock(&p.mutex);
+		}
+	}
+}
+
+#endif
+
+void ParallelFnc::run(int i) const {
+	switch (job) {
+	case EVAL:     (*out_vec)[i]=f[i].eval(*in); break;
+	case JACOBIAN: f[i].gradient(*in,(*out_mat)[i]); break;
+	default:       assert(false);
+	}
+}
+
+#ifdef _IBEX_WITH_THREADS_
+
+bool ParallelFnc::run_all() const {
+	Pool& p=*pool;
+
+	pthread_mutex_lock(&p.mutex);
+	p.next=0;
+	p.failed=false;
+	p.active=p.nb;
+	p.round++;
+	pthread_cond_broadcast(&p.start);
+	pthread_mutex_unlock(&p.mutex);
+
+	run();
+
+	pthread_mutex_lock(&p.mutex);
+	while (p.active>0)
+		pthread_cond_wait(&p.done, &p.mutex);
+	bool ok=!p.failed;
+	pthread_mutex_unlock(&p.mutex);
+
+	return ok;
+}
+
+#else
+
+// without threads, the pool is never created (see the constructor)
+bool ParallelFnc::run_all() const {
+	return false;
+}
+
+#endif
+
+IntervalVector ParallelFnc::eval_vector(const IntervalVector& box) const {
+	if (!pool) return f.eval_vector(box);
+
+	IntervalVector y(image_dim());
+	job=EVAL;
+	in=&box;
+	out_vec=&y;
+
+	// in case of exception, the evaluation is
+	// done again by the calling thread (that will throw it)
+	if (!run_all()) return f.eval_vector(box);
+
+	for (vector<int>::const_iterator it=shared.begin(); it!=shared.end(); it++)
+		run(*it);
+
+	return y;
+}
+
+void ParallelFnc::jacobian(const IntervalVector& x, IntervalMatrix& J) const {
+	if (!pool) {
+		f.jacobian(x,J);
+		return;
+	}
+
+	job=JACOBIAN;
+	in=&x;
+	out_mat=&J;
+
+	if (!run_all()) {
+		f.jacobian(x,J);
+		return;
+	}
+
+	for (vector<int>::const_iterator it=shared.begin(); it!=shared.end(); it++)
+		run(*it);
+}
+
+void ParallelFnc::generate_used_vars() const {
+	_nb_used_vars=f.nb_used_vars();
+	_used_var=new int[_nb_used_vars];
+	for (int i=0; i<_nb_used_vars; i++)
+		_used_var[i]=f.used_var(i);
+}
+
+void ParallelFnc::print(std::ostream& os) const {
+	os << f;
+}
+
+} // end namespace ibex
@@ -0,0 +1,150 @@
+/* ============================================================================
+ * I B E X - Parallel evaluation of the components of a function
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __IBEX_PARALLEL_FNC_H__
+#define __IBEX_PARALLEL_FNC_H__
+
+#include "ibex_Function.h"
+
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \ingroup function
+ * \brief Vector-valued function with components evaluated in parallel
+ *
+ * The components f[0], f[1], ... of a vector-valued function (e.g., the
+ * function "f" of a system with thousands of loosely coupled constraints)
+ * are independent DAGs (see Function::operator[]). This class evaluates
+ * them (#eval_vector, #jacobian and so #hansen_matrix) on a pool of threads.
+ *
+ * The components are split into chunks of consecutive components. The
+ * size of a chunk is adapted to the size of the DAGs so that the work of
+ * a chunk (at least \a min_nodes nodes) outweighs the synchronization cost.
+ * If there is not enough work for two chunks (small systems), no thread is
+ * created and f is evaluated sequentially as usual.
+ *
+ * Components shared by several indices (e.g., the zero function) are
+ * evaluated by the calling thread, after the other ones.
+ *
+ * Threads are only available if Ibex is configured with "--with-threads".
+ * Otherwise, f is always evaluated sequentially (and #nb_threads() is 1).
+ *
+ * \warning An instance must not be used by two threads simultaneously.
+ * The function f must not be evaluated elsewhere during a call either.
+ */
+class ParallelFnc : public Fnc {
+public:
+
+	/** Default minimal number of nodes per chunk, set to 1000. */
+	static const int default_min_nodes;
+
+	/**
+	 * \brief Build the parallel version of f.
+	 *
+	 * \param f          - a vector-valued function.
+	 * \param nb_threads - maximal number of threads (including the
+	 *                     calling thread). By default, the number of
+	 *                     processors online. If the system cannot create
+	 *                     them all, only the threads created are used (see
+	 *                     #nb_threads()) and, if none, f is evaluated
+	 *                     sequentially.
+	 * \param min_nodes  - minimal number of nodes (of the DAGs) per chunk.
+	 */
+	ParallelFnc(const Function& f, int nb_threads=-1, int min_nodes=default_min_nodes);
+
+	/**
+	 * \brief Delete this (and stop the threads).
+	 */
+	~ParallelFnc();
+
+	/**
+	 * \brief Calculate f(box) using interval arithmetic.
+	 */
+	virtual IntervalVector eval_vector(const IntervalVector& box) const;
+
+	/**
+	 * \brief Calculate the Jacobian matrix of f.
+	 */
+	virtual void jacobian(const IntervalVector& x, IntervalMatrix& J) const;
+
+	/**
+	 * \brief Number of chunks (0 if f is evaluated sequentially).
+	 */
+	int nb_chunks() const;
+
+	/**
+	 * \brief Number of threads (including the calling thread).
+	 */
+	int nb_threads() const;
+
+	/**
+	 * \brief The function.
+	 */
+	const Function& f;
+
+protected:
+	virtual void generate_used_vars() const;
+
+	virtual void print(std::ostream& os) const;
+
+private:
+	typedef enum { EVAL, JACOBIAN, STOP } task;
+
+	ParallelFnc(const ParallelFnc&); // forbidden
+
+	// run the current task on all the remaining chunks
+	void run() const;
+
+	// run the current task on the ith component
+	void run(int i) const;
+
+	// run the current task on all the chunks
+	// return false if an exception was raised
+	bool run_all() const;
+
+	// main loop of the threads of the pool
+	static void* work(void* pf);
+
+	// components evaluated in parallel, chunk by chunk:
+	// the kth chunk is comp[chunk[k]],...,comp[chunk[k+1]-1].
+	std::vector<int> comp;
+	std::vector<int> chunk;
+
+	// components evaluated by the calling thread
+	std::vector<int> shared;
+
+	int _nb_threads;
+
+	// thread pool (NULL if f is evaluated sequentially)
+	struct Pool;
+	Pool* pool;
+
+	// current task
+	mutable task job;
+	mutable const IntervalVector* in;
+	mutable IntervalVector* out_vec;
+	mutable IntervalMatrix* out_mat;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline int ParallelFnc::nb_chunks() const {
+	return pool? chunk.size()-1 : 0;
+}
+
+inline int ParallelFnc::nb_threads() const {
+	return _nb_threads;
+}
+
+} // end namespace ibex
+#endif // __IBEX_PARALLEL_FNC_H__
@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Oct 30, 2013
-// Last Update : Oct 30, 2013
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_LinearRelax.h"
@@ -13,18 +13,35 @@
 
 namespace ibex {
 
-LinearRelax::LinearRelax(const System& sys) : _nb_ctr(sys.nb_ctr), _nb_var(sys.nb_var), _goal_var(-1)/* by default */ {
+LinearRelax::LinearRelax(const System& sys) : _nb_ctr(sys.nb_ctr), _nb_var(sys.nb_var), _goal_var(-1)/* by default */,
+		sink(NULL), lp(NULL), lp_nb_rows(0) {
 	if (dynamic_cast<const ExtendedSystem*>(&sys)) {
 		_goal_var=((const ExtendedSystem&) sys).goal_var();
 	}
+}
 
+LinearRelax::LinearRelax(int nb_ctr, int nb_var, int goal_var) : _nb_ctr(nb_ctr), _nb_var(nb_var), _goal_var(goal_var),
+		sink(NULL), lp(NULL), lp_nb_rows(0) {
 }
 
-LinearRelax::LinearRelax(int nb_ctr, int nb_var, int goal_var) : _nb_ctr(nb_ctr), _nb_var(nb_var), _goal_var(goal_var) {
+LinearRelax::~LinearRelax() { }
 
+void LinearRelax::send_rows_to(LinearRelax& r) {
+	sink=&r;
+	lp=NULL;
 }
 
-LinearRelax::~LinearRelax() { }
+bool LinearRelax::keeps_rows(const LinearSolver* mysolver) const {
+	return lp!=NULL && lp==mysolver;
+}
+
+void LinearRelax::add_backtrackable(Cell& root) {
+
+}
+
+void LinearRelax::set_cell(Cell* cell) {
+
+}
 
 bool LinearRelax::isInner(IntervalVector & box, const System& sys, int j) {
 	Interval eval=sys.ctrs[j].f.eval(box);
@@ -35,4 +52,110 @@ bool LinearRelax::isInner(IntervalVector & box, const System& sys, int j) {
 	else
 		return true;
 }
+
+void LinearRelax::add_row(int nnz, const int* ind, const double* val, CmpOp op, double rhs) {
+	rows.add(nnz, ind, val, op, rhs);
+}
+
+int LinearRelax::flush_rows(LinearSolver* mysolver) {
+	int nb=rows.size();
+
+	if (sink!=NULL) {
+		for (int i=0; i<nb; i++) {
+			int k=rows.beg[i];
+			sink->add_row(rows.beg[i+1]-k, &rows.ind[0]+k, &rows.val[0]+k, rows.op[i], rows.rhs[i]);
+		}
+		clear_rows();
+		return nb;
+	}
+
+	int nb_rows=mysolver->getNbRows();
+	int kept=0; // number of rows of the last linearization reused
+
+	if (lp==mysolver && nb_rows==lp_nb_rows) {
+		int first=nb_rows-lp_rows.size();
+
+		// the rows with the same coefficients (in the same order) are kept
+		while (kept<nb && kept<lp_rows.size() && lp_rows.same_lhs(kept,rows)) {
+			if (lp_rows.rhs[kept]!=rows.rhs[kept] &&
+					mysolver->setRowRhs(first+kept, rows.op[kept], rows.rhs[kept])!=LinearSolver::OK)
+				break;
+			kept++;
+		}
+
+		// the other ones are removed
+		if (first+kept<nb_rows && mysolver->removeRows(first+kept)!=LinearSolver::OK) {
+			mysolver->cleanConst();
+			kept=0;
+		}
+		nb_rows=mysolver->getNbRows()-kept;
+	}
+
+	// the solver may add only part of the rows (e.g., ILOCPLEX adds them
+	// one by one), so the number of rows is counted on the solver side.
+	if (nb>kept) {
+		std::vector<int> beg(rows.beg.begin()+kept, rows.beg.end());
+		int k=beg[0];
+		for (unsigned int i=0; i<beg.size(); i++) beg[i]-=k;
+		mysolver->addConstraints(nb-kept, &beg[0], rows.ind.empty()? NULL : &rows.ind[0]+k,
+			rows.val.empty()? NULL : &rows.val[0]+k, &rows.op[0]+kept, &rows.rhs[0]+kept);
+	}
+
+	int added=mysolver->getNbRows()-nb_rows;
+
+	if (added==nb) {
+		// the rows are kept for the next linearization
+		lp=mysolver;
+		lp_nb_rows=mysolver->getNbRows();
+		lp_rows.swap(rows);
+	} else
+		lp=NULL;
+
+	clear_rows();
+	return added;
+}
+
+void LinearRelax::clear_rows() {
+	rows.clear();
+}
+
+LinearRelax::Rows::Rows() {
+	beg.push_back(0);
+}
+
+int LinearRelax::Rows::size() const {
+	return op.size();
+}
+
+void LinearRelax::Rows::add(int nnz, const int* ind1, const double* val1, CmpOp op1, double rhs1) {
+	ind.insert(ind.end(), ind1, ind1+nnz);
+	val.insert(val.end(), val1, val1+nnz);
+	beg.push_back(ind.size());
+	op.push_back(op1);
+	rhs.push_back(rhs1);
+}
+
+bool LinearRelax::Rows::same_lhs(int i, const Rows& r) const {
+	if (op[i]!=r.op[i] || beg[i+1]-beg[i]!=r.beg[i+1]-r.beg[i]) return false;
+	for (int k=beg[i], l=r.beg[i]; k<beg[i+1]; k++, l++)
+		if (ind[k]!=r.ind[l] || val[k]!=r.val[l]) return false;
+	return true;
+}
+
+void LinearRelax::Rows::swap(Rows& r) {
+	beg.swap(r.beg);
+	ind.swap(r.ind);
+	val.swap(r.val);
+	op.swap(r.op);
+	rhs.swap(r.rhs);
+}
+
+void LinearRelax::Rows::clear() {
+	beg.resize(1);
+	ind.clear();
+	val.clear();
+	op.clear();
+	rhs.clear();
+}
+
 } // end namespace ibex
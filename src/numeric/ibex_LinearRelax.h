@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Oct 30, 2013
-// Last Update : Oct 30, 2013
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #ifndef __IBEX_LINEAR_RELAXATION_H__
@@ -14,8 +14,12 @@
 #include "ibex_System.h"
 #include "ibex_LinearSolver.h"
 
+#include <vector>
+
 namespace ibex {
 
+class Cell;
+
 /**
  * \brief Linear relaxation
  *
@@ -65,10 +69,102 @@ public:
 	 */
 	int goal_var() const;
 
+	/**
+	 * \brief Send the rows to another relaxation.
+	 *
+	 * The rows generated by this relaxation are not added to the linear solver but
+	 * appended to the ones of \a r (which is typically a combination of relaxations).
+	 */
+	void send_rows_to(LinearRelax& r);
+
+	/**
+	 * \brief True if the rows of the last linearization are kept in the linear solver.
+	 *
+	 * In this case, the next linearization with the same solver only updates the rows
+	 * that have changed, so the caller must not remove them (see #flush_rows).
+	 */
+	bool keeps_rows(const LinearSolver* mysolver) const;
+
+	/**
+	 * \brief Add the data required by the relaxation to the root cell.
+	 *
+	 * By default: does nothing.
+	 */
+	virtual void add_backtrackable(Cell& root);
+
+	/**
+	 * \brief Set the current cell (NULL means no cell).
+	 *
+	 * By default: does nothing.
+	 */
+	virtual void set_cell(Cell* cell);
+
+protected:
+	/**
+	 * \brief Append the row sum_k val[k]*x[ind[k]] (op) rhs to the pending rows.
+	 *
+	 * The pending rows are added to the linear solver by #flush_rows.
+	 */
+	void add_row(int nnz, const int* ind, const double* val, CmpOp op, double rhs);
+
+	/**
+	 * \brief Add all the pending rows to the linear solver.
+	 *
+	 * The rows added by the previous call are kept in the solver (as long as its
+	 * number of rows has not changed in-between) and compared to the pending ones:
+	 * the rows with the same coefficients are reused (only their right-hand
+	 * side is updated) and the other ones are replaced, in one call.
+	 *
+	 * If the rows are sent to another relaxation (see #send_rows_to),
+	 * they are only appended to its pending rows.
+	 *
+	 * \return the number of rows of the relaxation in the solver (some rows
+	 *         may be rejected by the solver).
+	 */
+	int flush_rows(LinearSolver* mysolver);
+
+	/**
+	 * \brief Remove the pending rows.
+	 */
+	void clear_rows();
+
 private:
 	int _nb_ctr;
 	int _nb_var;
 	int _goal_var;
+
+	/**
+	 * Rows in compressed row format.
+	 */
+	struct Rows {
+		Rows();
+		int size() const;
+		void add(int nnz, const int* ind, const double* val, CmpOp op, double rhs);
+		bool same_lhs(int i, const Rows& r) const;
+		void swap(Rows& r);
+		void clear();
+
+		std::vector<int> beg;
+		std::vector<int> ind;
+		std::vector<double> val;
+		std::vector<CmpOp> op;
+		std::vector<double> rhs;
+	};
+
+	// pending rows
+	Rows rows;
+
+	// where the pending rows are sent (NULL if they are added to the solver)
+	LinearRelax* sink;
+
+	// the solver that contains the rows of the last linearization (NULL if none)
+	LinearSolver* lp;
+
+	// number of rows of #lp after the last linearization
+	int lp_nb_rows;
+
+	// the rows of the last linearization (the last rows of #lp)
+	Rows lp_rows;
 };
 
 
@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Jul 1, 2012
-// Last Update : Nov 15, 2012
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_LinearRelaxAffine2.h"
@@ -15,12 +15,13 @@ namespace ibex {
 
 // the constructor
 LinearRelaxAffine2::LinearRelaxAffine2(const System& sys1) :
-				LinearRelax(sys1), sys(sys1) {
+				LinearRelax(sys1), sys(sys1), row_ind(new int[sys1.nb_var]), row_val(new double[sys1.nb_var]) {
 
 }
 
 LinearRelaxAffine2::~LinearRelaxAffine2() {
-
+	delete[] row_ind;
+	delete[] row_val;
 }
 
 
@@ -28,16 +29,15 @@ LinearRelaxAffine2::~LinearRelaxAffine2() {
 int LinearRelaxAffine2::linearization(IntervalVector & box, LinearSolver *mysolver) {
 
 	Affine2 af2;
-	Vector rowconst(sys.nb_var);
 	Interval ev(0.0);
 	Interval center(0.0);
 	Interval err(0.0);
 	CmpOp op;
-	int cont = 0;
-	LinearSolver::Status stat = LinearSolver::FAIL;
 
+	clear_rows();
 
 	// Create the linear relaxation of each constraint
+	// (the rows are added to the solver at the end)
 	for (int ctr = 0; ctr < sys.nb_ctr; ctr++) {
 
 		af2 = 0.0;
@@ -47,17 +47,22 @@ int LinearRelaxAffine2::linearization(IntervalVector & box, LinearSolver *mysolv
 		if (af2.size() == sys.nb_var) { // if the affine2 form is valid
 
 			// convert the epsilon variables to the original box
+			// (the coefficients of the variables not used by the constraint are zero)
+			const Function& f=sys.ctrs[ctr].f;
+			int nnz=f.nb_used_vars();
 			double tmp=0;
 			center =0;
 			err =0;
-			for (int i =0; i <sys.nb_var; i++) {
+			for (int k =0; k <nnz; k++) {
+				int i=f.used_var(k);
 				tmp = box[i].rad();
 				//		if (tmp> mysolver->getEpsilon()) {
-				rowconst[i] =af2.val(i+1) / tmp;
-				center += rowconst[i]*box[i].mid();
-				err += fabs(rowconst[i])*  pow(2,-50); // TODO to check
+				row_ind[k] = i;
+				row_val[k] =af2.val(i+1) / tmp;
+				center += row_val[k]*box[i].mid();
+				err += fabs(row_val[k])*  pow(2,-50); // TODO to check
 				//		} else {
-				//			rowconst[i] = 0;
+				//			row_val[k] = 0;
 				//			err += tmp;
 				//		}
 			}
@@ -70,8 +75,7 @@ int LinearRelaxAffine2::linearization(IntervalVector & box, LinearSolver *mysolv
 				if (0.0 < ev.lb())
 					throw EmptyBoxException();
 				else if (0.0 < ev.ub()) {
-					stat = mysolver->addConstraint(rowconst, LEQ,	((af2.err()+err) - (af2.val(0)-center)).ub());
-					if (stat == LinearSolver::OK)	cont++;
+					add_row(nnz, row_ind, row_val, LEQ,	((af2.err()+err) - (af2.val(0)-center)).ub());
 				}
 				break;
 			}
@@ -83,8 +87,7 @@ int LinearRelaxAffine2::linearization(IntervalVector & box, LinearSolver *mysolv
 				if (ev.ub() < 0.0)
 					throw EmptyBoxException();
 				else if (ev.lb() < 0.0) {
-					stat = mysolver->addConstraint(rowconst, GEQ,	(-(af2.err()+err) - (af2.val(0)-center)).lb());
-					if (stat == LinearSolver::OK)	cont++;
+					add_row(nnz, row_ind, row_val, GEQ,	(-(af2.err()+err) - (af2.val(0)-center)).lb());
 				}
 				break;
 			}
@@ -94,10 +97,8 @@ int LinearRelaxAffine2::linearization(IntervalVector & box, LinearSolver *mysolv
 				}
 				else {
 					if (ev.diam()>2*mysolver->getEpsilon()) {
-						stat = mysolver->addConstraint(rowconst, GEQ,	(-(af2.err()+err) - (af2.val(0)-center)).lb());
-						if (stat == LinearSolver::OK)	cont++;
-						stat = mysolver->addConstraint(rowconst, LEQ,	((af2.err()+err) - (af2.val(0)-center)).ub());
-						if (stat == LinearSolver::OK)	cont++;
+						add_row(nnz, row_ind, row_val, GEQ,	(-(af2.err()+err) - (af2.val(0)-center)).lb());
+						add_row(nnz, row_ind, row_val, LEQ,	((af2.err()+err) - (af2.val(0)-center)).ub());
 					}
 				}
 				break;
@@ -106,7 +107,7 @@ int LinearRelaxAffine2::linearization(IntervalVector & box, LinearSolver *mysolv
 		}
 
 	}
-	return cont;
+	return flush_rows(mysolver);
 
 }
 
@@ -4,7 +4,7 @@
 // Author      : Jordan Ninin
 // License     : See the LICENSE file
 // Created     : May 19, 2013
-// Last Update : May 19, 2013
+// Last Update : Oct 19, 2026
 //============================================================================
 
 
@@ -44,6 +44,13 @@ public:
 	 * \brief The system
 	 */
 	const System& sys;
+
+private:
+	/* Variables of the current (sparse) row */
+	int* row_ind;
+
+	/* Coefficients of the current (sparse) row */
+	double* row_val;
 };
 
 } // end namespace ibex
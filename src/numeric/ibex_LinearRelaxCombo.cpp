@@ -64,6 +64,9 @@ LinearRelaxCombo::LinearRelaxCombo(const System& sys1, linear_mode lmode1) :
 	}
 	}
 
+	// the rows are added to the solver at once by this relaxation
+	if (myart!=NULL) myart->send_rows_to(*this);
+	if (myxnewton!=NULL) myxnewton->send_rows_to(*this);
 }
 
 LinearRelaxCombo::~LinearRelaxCombo() {
@@ -77,29 +80,40 @@ LinearRelaxCombo::~LinearRelaxCombo() {
 /*********generation of the linearized system*********/
 int LinearRelaxCombo::linearization(IntervalVector & box, LinearSolver *mysolver) {
 
-	int cont = 0;
 	// Update the bounds the variables
 	mysolver->initBoundVar(box);
 
+	clear_rows();
+
 	switch (lmode) {
 	case ART:
 	case AFFINE2: {
-		cont = myart->linearization(box,mysolver);
+		myart->linearization(box,mysolver);
 		break;
 	}
 	case XNEWTON:
 	case TAYLOR:
 	case HANSEN: {
-		cont = myxnewton->linearization(box,mysolver);
+		myxnewton->linearization(box,mysolver);
 		break;
 	}
 	case COMPO: {
-		cont  = myxnewton->linearization(box,mysolver);
-		cont += myart->linearization(box,mysolver);
+		myxnewton->linearization(box,mysolver);
+		myart->linearization(box,mysolver);
 		break;
 	}
 	}
-	return cont;
+	return flush_rows(mysolver);
+}
+
+void LinearRelaxCombo::add_backtrackable(Cell& root) {
+	if (myart!=NULL) myart->add_backtrackable(root);
+	if (myxnewton!=NULL) myxnewton->add_backtrackable(root);
+}
+
+void LinearRelaxCombo::set_cell(Cell* cell) {
+	if (myart!=NULL) myart->set_cell(cell);
+	if (myxnewton!=NULL) myxnewton->set_cell(cell);
 }
 
 
@@ -56,6 +56,16 @@ public:
   	 */
 	int linearization( IntervalVector & box, LinearSolver *mysolver);
 
+	/**
+	 * \brief Add the data required by the sub-relaxation(s) to the root cell.
+	 */
+	void add_backtrackable(Cell& root);
+
+	/**
+	 * \brief Set the current cell of the sub-relaxation(s).
+	 */
+	void set_cell(Cell* cell);
+
 private:
 
 	/**  AFFINE2 | TAYLOR | HANSEN | COMPO : the linear relaxation method */
@@ -5,25 +5,35 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Jul 1, 2012
-// Last Update : Jul 02, 2013 (Gilles Chabert)
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_LinearRelaxXTaylor.h"
 #include "ibex_ExtendedSystem.h"
 #include "ibex_EmptyBoxException.h"
+#include "ibex_Cell.h"
 
 using namespace std;
 
 namespace ibex {
 
 const double LinearRelaxXTaylor::default_max_diam_deriv =1e6;
+const double LinearRelaxXTaylor::default_reuse_ratio =0.9;
 
 LinearRelaxXTaylor::LinearRelaxXTaylor(const System& sys1, std::vector<corner_point>& cpoints1,
-		linear_mode lmode1, double max_diam_deriv1):
+		linear_mode lmode1, double max_diam_deriv1, double reuse_ratio1):
 			LinearRelax(sys1), sys(sys1), cpoints(cpoints1), goal_ctr(-1),
 			max_diam_deriv(max_diam_deriv1),
+			reuse_ratio(reuse_ratio1),
 			lmode(lmode1),
 			linear_coef(sys1.nb_ctr, sys1.nb_var),
+			grad(&own_grad),
+			grad_beg(new int[sys1.nb_ctr+1]),
+			jac(sys1.nb_ctr, sys1.nb_var),
+			jac_stale(new bool[sys1.nb_ctr]),
+			savebox(sys1.nb_var),
+			row_ind(new int[sys1.nb_var]),
+			row_val(new double[sys1.nb_var]),
 			df(sys1.f,Function::DIFF) {
 
 	if (dynamic_cast<const ExtendedSystem*>(&sys)) {
@@ -40,8 +50,12 @@ void LinearRelaxXTaylor::init_linear_coeffs() {
 	linear = new bool*[sys.nb_ctr];
 	linear_ctr = new bool[sys.nb_ctr];
 
+	grad_beg[0]=0;
+
 	for(int ctr=0; ctr<sys.nb_ctr; ctr++) {
 
+		grad_beg[ctr+1] = grad_beg[ctr] + sys.ctrs[ctr].f.nb_used_vars();
+
 		linear[ctr] = new bool[sys.nb_var];
 
 		IntervalVector G(sys.nb_var);
@@ -59,6 +73,9 @@ void LinearRelaxXTaylor::init_linear_coeffs() {
 		linear_coef.row(ctr) = G;  // in case of a linear function, the coefficients are already computed.
 	}
 
+	own_grad.val.resize(grad_beg[sys.nb_ctr]);
+	own_grad.dom.resize(grad_beg[sys.nb_ctr]);
+	own_grad.ok.resize(sys.nb_ctr, false);
 }
 
 LinearRelaxXTaylor::~LinearRelaxXTaylor() {
@@ -67,35 +84,101 @@ LinearRelaxXTaylor::~LinearRelaxXTaylor() {
 	for(int ctr=0; ctr<sys.nb_ctr; ctr++) delete[] linear[ctr];
 	delete[] linear;
 	delete[] linear_ctr;
+	delete[] grad_beg;
+	delete[] jac_stale;
+	delete[] row_ind;
+	delete[] row_val;
+}
+
+void LinearRelaxXTaylor::add_backtrackable(Cell& root) {
+	if (lmode!=TAYLOR) return;
+
+	root.add<XTaylorGradients>();
+	XTaylorGradients& g=root.get<XTaylorGradients>();
+	if (!g.find(this)) g.add(this, sys.nb_ctr, grad_beg[sys.nb_ctr]);
+}
+
+void LinearRelaxXTaylor::set_cell(Cell* cell) {
+	grad=NULL;
+	if (lmode==TAYLOR && cell!=NULL && cell->data.used(typeid(XTaylorGradients).name()))
+		grad=cell->get<XTaylorGradients>().find(this);
+	if (grad==NULL) grad=&own_grad;
+}
+
+bool LinearRelaxXTaylor::jac_reusable(const IntervalVector& box, int ctr) const {
+	if (!grad->ok[ctr]) return false;
+
+	const Function& f=sys.ctrs[ctr].f;
+	for (int i=0; i<f.nb_used_vars(); i++) {
+		int j=f.used_var(i);
+		const Interval& x=grad->dom[grad_beg[ctr]+i];
+		if (!box[j].is_subset(x) || box[j].diam() < reuse_ratio*x.diam()) return false;
+	}
+	return true;
+}
+
+void LinearRelaxXTaylor::update_jacobian(const IntervalVector& box) {
+	int nb_stale=0;
+	for(int ctr=0; ctr<sys.nb_ctr; ctr++) {
+		jac_stale[ctr] = !jac_reusable(box,ctr);
+		if (jac_stale[ctr]) nb_stale++;
+	}
+
+	// if all the constraints are scalar, the derivatives
+	// are computed at once with the Jacobian of the system
+	bool all_rows = nb_stale==sys.nb_ctr && sys.f.image_dim()==sys.nb_ctr;
+
+	if (all_rows) sys.f.jacobian(box,jac);
+
+	for(int ctr=0; ctr<sys.nb_ctr; ctr++) {
+		if (!jac_stale[ctr]) continue;
+
+		if (!all_rows) sys.ctrs[ctr].f.gradient(box,jac[ctr]);
+
+		// only the derivatives w.r.t. the used variables are relevant
+		const Function& f=sys.ctrs[ctr].f;
+		for (int i=0; i<f.nb_used_vars(); i++) {
+			int j=f.used_var(i);
+			grad->val[grad_beg[ctr]+i]=jac[ctr][j];
+			grad->dom[grad_beg[ctr]+i]=box[j];
+		}
+		grad->ok[ctr]=true;
+	}
 }
 
 int LinearRelaxXTaylor::linearization( IntervalVector & box, LinearSolver *mysolver)  {
 
-	int cont =0;
+	// derivatives are computed once (Taylor) and
+	// reused as long as the box does not shrink too much
+	if (lmode==TAYLOR) update_jacobian(box);
+
+	clear_rows();
 
 	// Create the linear relaxation of each constraint
+	// (the rows are added to the solver at the end)
 	for(int ctr=0; ctr<sys.nb_ctr; ctr++) {
 		//cout << "[LinearRelaxXTaylor] ctr n°" << ctr << endl;
-		IntervalVector G(sys.nb_var);
 
-		if(lmode==TAYLOR) {                 // derivatives are computed once (Taylor)
-			sys.ctrs[ctr].f.gradient(box,G);
-		}
-		else {
-			// to set all the constant derivatives that have been already computed
-			// (the other will be overwritten)
-			G=linear_coef.row(ctr);
+		// in HANSEN mode, the constant derivatives have been already
+		// computed (the other ones are computed by X_Linearization)
+		IntervalVector& G = lmode==TAYLOR ? jac[ctr] : linear_coef[ctr];
+
+		if (lmode==TAYLOR) {
+			const Function& f=sys.ctrs[ctr].f;
+			for (int i=0; i<f.nb_used_vars(); i++)
+				G[f.used_var(i)]=grad->val[grad_beg[ctr]+i];
 		}
+
 		int nb_nonlinear_vars;
 		if(cpoints[0]==K4) {
 			for(int j=0; j<4; j++)
-				cont += X_Linearization(box, ctr, K4, G, j, nb_nonlinear_vars,mysolver);
+				X_Linearization(box, ctr, K4, G, j, nb_nonlinear_vars,mysolver);
 		} else  //  linearizations k corners per constraint
 			for(int k=0; k<(cpoints.size()); k++) {
-				cont += X_Linearization(box, ctr, cpoints[k],  G, k, nb_nonlinear_vars,mysolver);
+				X_Linearization(box, ctr, cpoints[k],  G, k, nb_nonlinear_vars,mysolver);
 			}
 	}
-	return cont;
+	return flush_rows(mysolver);
 }
 
 
@@ -120,9 +203,9 @@ int LinearRelaxXTaylor::X_Linearization(IntervalVector& box, int ctr, corner_poi
 
 int LinearRelaxXTaylor::X_Linearization(IntervalVector& box,
 		int ctr, corner_point cpoint, CmpOp op, 
-		IntervalVector& G2, int id_point, int& nb_nonlinear_vars, LinearSolver *mysolver) {
+		IntervalVector& G, int id_point, int& nb_nonlinear_vars, LinearSolver *mysolver) {
 
-	IntervalVector G = G2;
+	const Function& f = sys.ctrs[ctr].f;
 	int n = sys.nb_var;
 	int nonlinear_var = 0;
 
@@ -141,31 +224,34 @@ int LinearRelaxXTaylor::X_Linearization(IntervalVector& box,
 
 	 }
 	 */
-	IntervalVector savebox(box);
+	// only the variables used by the constraint are considered
+	// (the row is sparse)
+	int nnz = f.nb_used_vars();
+	for (int i=0; i<nnz; i++) {
+		int j=f.used_var(i);
+		savebox[j]=box[j];
+	}
+
 	Interval ev(0.0);
 	Interval tot_ev(0.0);
-	Vector row1(n);
-
 
-	for (int j=0; j< n; j++) {
+	for (int i=0; i<nnz; i++) {
+	  int j=f.used_var(i);
 		//cout << "[LinearRelaxXTaylor] variable n°" << j << endl;
-	  if (sys.ctrs[ctr].f.used(j)) {
-		  if (lmode == HANSEN && !linear[ctr][j])
-			  // get the partial derivative of ctr w.r.t. var n°j
-	    	  G[j]=df[ctr*n+j].eval(box);
-	  }
-	  else
-		  continue;
-	  //cout << "[LinearRelaxXTaylor] coeffs=" << G[j] << endl;
-
-	  if (G[j].diam() > max_diam_deriv) {
-	    box = savebox; // [gch] where box has been modified?  at the end of the loop (for Hansen computation) [bne]
+	  Interval gj = G[j];
+	  if (lmode == HANSEN && !linear[ctr][j])
+		  // get the partial derivative of ctr w.r.t. var n°j
+		  gj=df[ctr*n+j].eval(box);
+	  //cout << "[LinearRelaxXTaylor] coeffs=" << gj << endl;
+
+	  if (gj.diam() > max_diam_deriv) {
+	    restore_box(box, f); // [gch] where box has been modified?  at the end of the loop (for Hansen computation) [bne]
 	    return 0;      // To avoid problems with SoPleX
 	  }
 
 	  if (linear[ctr][j])
 	    cpoint = INF_X;
-	  else if (G[j].diam() > 1e-10)
+	  else if (gj.diam() > 1e-10)
 	    nonlinear_var++;
 
 	  bool inf_x;
@@ -201,7 +287,7 @@ int LinearRelaxXTaylor::X_Linearization(IntervalVector& box,
 					inf_x = !base_coin[j];
 				else
 					return 0;
-			} else if (G[j].diam() <= 1e-10) {
+			} else if (gj.diam() <= 1e-10) {
 				inf_x = (rand() % 2 == 0);
 			} else if (id_point == 1) {
 				if (((double) nonlinear_var) <= (((double) nb_nonlinear_vars)/ 3.0))
@@ -317,8 +403,9 @@ int LinearRelaxXTaylor::X_Linearization(IntervalVector& box,
 		//      cout << " j " << j <<  " " << savebox[j] << G[j] << endl;
 	  box[j]=inf_x? savebox[j].lb():savebox[j].ub();
 	  Interval a = ((inf_x && (op == LEQ || op== LT)) ||
-			(!inf_x && (op == GEQ || op== GT)))	? G[j].lb() : G[j].ub();
-	  row1[j] =  a.mid();
+			(!inf_x && (op == GEQ || op== GT)))	? gj.lb() : gj.ub();
+	  row_ind[i] = j;
+	  row_val[i] = a.mid();
 	  ev -= a*box[j];
 
 	}
@@ -332,8 +419,8 @@ int LinearRelaxXTaylor::X_Linearization(IntervalVector& box,
 
 	if(id_point==0) nb_nonlinear_vars=nonlinear_var;
 
-	for(int j=0;j<n;j++)
-		tot_ev+=row1[j]*savebox[j]; //natural evaluation of the left side of the linear constraint
+	for(int i=0;i<nnz;i++)
+		tot_ev+=row_val[i]*savebox[row_ind[i]]; //natural evaluation of the left side of the linear constraint
 
 
 
@@ -343,24 +430,66 @@ int LinearRelaxXTaylor::X_Linearization(IntervalVector& box,
 		if(tot_ev.lb()>(-ev).ub())
 			throw EmptyBoxException();  // the constraint is not satisfied
 		if((-ev).ub()<tot_ev.ub()) {    // otherwise the constraint is satisfied for any point in the box
-			mysolver->addConstraint( row1, LEQ, (-ev).ub());
+			add_row(nnz, row_ind, row_val, LEQ, (-ev).ub());
 			added=true;
 		}
 	} else {
 		if(tot_ev.ub()<(-ev).lb())
 			throw EmptyBoxException();
 		if ((-ev).lb()>tot_ev.lb()) {
-			mysolver->addConstraint( row1, GEQ, (-ev).lb() );
+			add_row(nnz, row_ind, row_val, GEQ, (-ev).lb() );
 			added=true;
 		}
 	}
 
-	box=savebox;
+	restore_box(box, f);
 
 	return (added)? 1:0;
 
 }
 
+void LinearRelaxXTaylor::restore_box(IntervalVector& box, const Function& f) {
+	for (int i=0; i<f.nb_used_vars(); i++) {
+		int j=f.used_var(i);
+		box[j]=savebox[j];
+	}
+}
+
+XTaylorGradients::XTaylorGradients() {
+
+}
+
+XTaylorGradients::XTaylorGradients(const XTaylorGradients& g) : grads(g.grads) {
+
+}
+
+XTaylorGradients::Grad* XTaylorGradients::find(const LinearRelaxXTaylor* r) {
+	for (unsigned int i=0; i<grads.size(); i++)
+		if (grads[i].first==r) return &grads[i].second;
+	return NULL;
+}
+
+void XTaylorGradients::add(const LinearRelaxXTaylor* r, int nb_ctr, int size) {
+	grads.push_back(std::pair<const LinearRelaxXTaylor*,Grad>(r,Grad()));
+	Grad& g=grads.back().second;
+	g.val.resize(size);
+	g.dom.resize(size);
+	g.ok.resize(nb_ctr, false);
+}
+
+std::pair<Backtrackable*,Backtrackable*> XTaylorGradients::down() {
+	return std::pair<Backtrackable*,Backtrackable*>(new XTaylorGradients(*this),new XTaylorGradients(*this));
+}
+
+size_t XTaylorGradients::memory() const {
+	size_t m=sizeof(XTaylorGradients);
+	for (unsigned int i=0; i<grads.size(); i++) {
+		const Grad& g=grads[i].second;
+		m+=sizeof(grads[i])+(g.val.size()+g.dom.size())*sizeof(Interval)+g.ok.size()/8;
+	}
+	return m;
+}
+
 /* not implemented in version 2
 
 void CtcXNewton::best_corner(int ctr, int op, INTERVAL_VECTOR& G, bool* corner){
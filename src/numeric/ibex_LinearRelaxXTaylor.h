@@ -6,7 +6,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Jul 20, 2012
-// Last Update : Jul 02, 2013 (Gilles Chabert)
+// Last Update : Oct 19, 2026
 //============================================================================
 
 
@@ -15,11 +15,75 @@
 
 #include "ibex_System.h"
 #include "ibex_LinearRelax.h"
+#include "ibex_Backtrackable.h"
 
 #include <vector>
 
 namespace ibex {
 
+class LinearRelaxXTaylor;
+
+/**
+ * \ingroup numeric
+ * \brief Gradients of X-Taylor relaxations (backtrackable data).
+ *
+ * In TAYLOR mode, the gradients of the constraints and the domains used for their
+ * computation are stored in the cells, so that a node reuses the gradients computed
+ * for its ancestors, whatever the order in which the nodes are explored.
+ */
+class XTaylorGradients : public Backtrackable {
+public:
+	/**
+	 * \brief Gradients of one relaxation.
+	 *
+	 * Only the partial derivatives w.r.t. the variables used by
+	 * each constraint are stored (in the order of Function::used_var).
+	 */
+	struct Grad {
+		/** Partial derivatives */
+		std::vector<Interval> val;
+		/** Domains used for their computation */
+		std::vector<Interval> dom;
+		/** Indicates if the gradient of each constraint has been computed */
+		std::vector<bool> ok;
+	};
+
+	/**
+	 * \brief Constructor for the root node.
+	 */
+	XTaylorGradients();
+
+	/**
+	 * \brief The gradients of the relaxation \a r (NULL if none).
+	 */
+	Grad* find(const LinearRelaxXTaylor* r);
+
+	/**
+	 * \brief Add the gradients of the relaxation \a r (none computed).
+	 *
+	 * \param nb_ctr - the number of constraints
+	 * \param size   - the number of partial derivatives
+	 */
+	void add(const LinearRelaxXTaylor* r, int nb_ctr, int size);
+
+	/**
+	 * \brief Duplicate the structure into the left/right nodes
+	 */
+	std::pair<Backtrackable*,Backtrackable*> down();
+
+	/**
+	 * \brief Memory used by *this.
+	 */
+	size_t memory() const;
+
+protected:
+
+	XTaylorGradients(const XTaylorGradients&);
+
+	/** The gradients of each relaxation */
+	std::vector<std::pair<const LinearRelaxXTaylor*,Grad> > grads;
+};
+
 /**
  * \ingroup numeric
  * \brief X_Taylor contractor
@@ -44,6 +108,9 @@ public:
 	/** Default max_diam_deriv value, set to 1e6  **/
 	static const double default_max_diam_deriv;
 
+	/** Default reuse_ratio value, set to 0.9  **/
+	static const double default_reuse_ratio;
+
 	/**
 	 * \brief Creates the X_Taylor contractor.
 	 *
@@ -52,9 +119,14 @@ public:
 	 * \param lmode           - TAYLOR | HANSEN : linear relaxation method.
 	 * \param max_diam_deriv  - The maximum diameter of the box for for the linear solver (default value 1.e6).
 	 * 	  				        Soplex may lose solutions when it is called with "big" domains.
+	 * \param reuse_ratio     - In TAYLOR mode, the gradient of a constraint is not recomputed as long as
+	 *                          the domain of each of its variables is a subset of the domain used for the
+	 *                          last computation, with a diameter at least reuse_ratio times larger
+	 *                          (default value 0.9). A ratio greater than 1 disables the reuse.
 	 */
 	LinearRelaxXTaylor(const System& sys, std::vector<corner_point>& cpoints,
-			linear_mode lmode=HANSEN, double max_diam_deriv=default_max_diam_deriv);
+			linear_mode lmode=HANSEN, double max_diam_deriv=default_max_diam_deriv,
+			double reuse_ratio=default_reuse_ratio);
 
 	/**
 	 * \brief Deletes this instance.
@@ -76,6 +148,20 @@ public:
 	 */
 	int linearization( IntervalVector & box, LinearSolver *mysolver);
 
+	/**
+	 * \brief Add the gradients to the root cell (TAYLOR mode).
+	 *
+	 * See #ibex::XTaylorGradients.
+	 */
+	void add_backtrackable(Cell& root);
+
+	/**
+	 * \brief Use the gradients of the cell (TAYLOR mode).
+	 *
+	 * If the cell has no gradients (or if \a cell is NULL),
+	 * the gradients are stored by this object.
+	 */
+	void set_cell(Cell* cell);
 
 private:
 
@@ -92,12 +178,39 @@ private:
 	/** Maximum diameter of the derivatives for calling linear solver (default value 1.e5) */
 	double max_diam_deriv;
 
+	/** Minimal shrinking ratio of the domains for reusing the gradients (TAYLOR mode) */
+	double reuse_ratio;
+
 	/** TAYLOR | HANSEN : the linear relaxation method */
 	linear_mode lmode;
 
 	/** Stores the coefficients of linear constraints */
 	IntervalMatrix linear_coef;
 
+	/** Gradients of the constraints (TAYLOR mode): the current ones */
+	XTaylorGradients::Grad* grad;
+
+	/** Gradients of the constraints (TAYLOR mode) when there is no cell */
+	XTaylorGradients::Grad own_grad;
+
+	/** Index of the first partial derivative of each constraint in #grad */
+	int* grad_beg;
+
+	/** Jacobian matrix (TAYLOR mode), the gradients of #grad are copied in */
+	IntervalMatrix jac;
+
+	/** Indicates if the gradient of each constraint must be recomputed (see #update_jacobian) */
+	bool* jac_stale;
+
+	/** Domains of the variables before moving to a corner */
+	IntervalVector savebox;
+
+	/** Variables of the current (sparse) row */
+	int* row_ind;
+
+	/** Coefficients of the current (sparse) row */
+	double* row_val;
+
 	/* For implementing RANDOM_INV one needs to store the last random corners */
 	int* last_rnd;
 
@@ -125,6 +238,21 @@ private:
 	int X_Linearization(IntervalVector& box, int ctr, corner_point cpoint, CmpOp op,
 			IntervalVector &G, int id_point, int& non_linear_vars, LinearSolver *mysolver);
 
+	/**
+	 * \brief True if the gradient of the constraint can be reused in the box.
+	 */
+	bool jac_reusable(const IntervalVector& box, int ctr) const;
+
+	/**
+	 * \brief Recompute the gradients that cannot be reused in the box.
+	 */
+	void update_jacobian(const IntervalVector& box);
+
+	/**
+	 * \brief Restore the domains of the variables used by f (see #savebox).
+	 */
+	void restore_box(IntervalVector& box, const Function& f);
+
 	/**
 	 * \brief Symbolic Jacobian
 	 */
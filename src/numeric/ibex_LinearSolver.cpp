@@ -5,7 +5,7 @@
 // Author      : Jordan Ninin
 // License     : See the LICENSE file
 // Created     : May 15, 2013
-// Last Update : May 15, 2013
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_LinearSolver.h"
@@ -54,6 +54,11 @@ std::ostream& operator<<(std::ostream& os, const LinearSolver::Status_Sol x){
 
 }
 
+LinearSolver::Status LinearSolver::addConstraint(int nnz, const int* ind, const double* val, CmpOp sign, double rhs) {
+	int beg[2]={0,nnz};
+	return addConstraints(1, beg, ind, val, &sign, &rhs);
+}
+
 
 
 
@@ -309,6 +314,24 @@ LinearSolver::Status LinearSolver::cleanConst() {
 	return res;
 
 }
+LinearSolver::Status LinearSolver::removeRows(int first) {
+	LinearSolver::Status res= FAIL;
+	try {
+		if (dual_solution!=NULL) delete[] dual_solution;
+		dual_solution=NULL;
+		status_prim = soplex::SPxSolver::UNKNOWN;
+		status_dual = soplex::SPxSolver::UNKNOWN;
+		if (first<nb_rows) mysoplex->removeRowRange(first, nb_rows-1);
+		nb_rows = first;
+		obj_value = POS_INFINITY;
+		res= OK;
+	}
+	catch(soplex::SPxException&) {
+		res = FAIL;
+	}
+	return res;
+}
+
 LinearSolver::Status LinearSolver::cleanAll() {
 	LinearSolver::Status res= FAIL;
 	try {
@@ -417,6 +440,24 @@ LinearSolver::Status LinearSolver::setBoundVar(int var, Interval bound) {
 	return res;
 }
 
+LinearSolver::Status LinearSolver::setRowRhs(int row, CmpOp sign, double rhs) {
+	LinearSolver::Status res= FAIL;
+	try {
+		if (sign==LEQ || sign==LT) {
+			mysoplex->changeRhs(row, rhs);
+			res = OK;
+		}
+		else if (sign==GEQ || sign==GT) {
+			mysoplex->changeLhs(row, rhs);
+			res = OK;
+		}
+	}
+	catch(soplex::SPxException&) {
+		res = FAIL;
+	}
+	return res;
+}
+
 LinearSolver::Status LinearSolver::setEpsilon(double eps) {
 	LinearSolver::Status res= FAIL;
 	try {
@@ -459,6 +500,35 @@ LinearSolver::Status LinearSolver::addConstraint(ibex::Vector& row, CmpOp sign,
 	return res;
 }
 
+LinearSolver::Status LinearSolver::addConstraints(int nb, const int* beg, const int* ind, const double* val, const CmpOp* sign, const double* rhs) {
+	LinearSolver::Status res= FAIL;
+	for (int i=0; i<nb; i++)
+		if (sign[i]==EQ) return res;
+
+	try {
+		soplex::LPRowSet rows(nb, beg[nb]);
+		soplex::DSVector row1(nb_vars);
+		for (int i=0; i<nb; i++) {
+			for (int k=beg[i]; k<beg[i+1]; k++) {
+				row1.add(ind[k], val[k]);
+			}
+			if (sign[i]==LEQ || sign[i]==LT)
+				rows.add(-soplex::infinity, row1, rhs[i]);
+			else
+				rows.add(rhs[i], row1, soplex::infinity);
+			row1.clear();
+		}
+		mysoplex->addRows(rows);
+		nb_rows+=nb;
+		res = OK;
+	}
+	catch(soplex::SPxException& ) {
+		res = FAIL;
+	}
+
+	return res;
+}
+
 
 
 
@@ -944,6 +1014,24 @@ LinearSolver::Status LinearSolver::cleanConst() {
 	return res;
 
 }
+LinearSolver::Status LinearSolver::removeRows(int first) {
+	LinearSolver::Status res= FAIL;
+	try {
+		if (dual_solution!=NULL) delete[] dual_solution;
+		dual_solution=NULL;
+		int status = first<nb_rows ? CPXdelrows (envcplex, lpcplex, first,  nb_rows - 1) : 0;
+		if (status==0) {
+			nb_rows = first;
+			obj_value = POS_INFINITY;
+			res = OK;
+		}
+	}
+	catch(Exception&) {
+		res = FAIL;
+	}
+	return res;
+}
+
 LinearSolver::Status LinearSolver::cleanAll() {
 	LinearSolver::Status res = FAIL;
 	try {
@@ -1081,6 +1169,24 @@ LinearSolver::Status LinearSolver::setBoundVar(int var, Interval bound) {
 	return res;
 }
 
+LinearSolver::Status LinearSolver::setRowRhs(int row, CmpOp sign, double rhs) {
+	LinearSolver::Status res= FAIL;
+	try {
+		// the ">=" constraints are negated
+		double val;
+		if (sign == LEQ || sign == LT) val = rhs;
+		else if (sign == GEQ || sign == GT) val = -rhs;
+		else return res;
+
+		int status = CPXchgrhs(envcplex, lpcplex, 1, &row, &val);
+		if (status==0) res = OK;
+	}
+	catch(Exception&) {
+		res = FAIL;
+	}
+	return res;
+}
+
 LinearSolver::Status LinearSolver::setEpsilon(double eps) {
 	LinearSolver::Status res = FAIL;
 	try {
@@ -1138,6 +1244,45 @@ LinearSolver::Status LinearSolver::addConstraint(ibex::Vector& row, CmpOp sign,
 	return res;
 }
 
+LinearSolver::Status LinearSolver::addConstraints(int nb, const int* beg, const int* ind, const double* val, const CmpOp* sign, const double* rhs) {
+	LinearSolver::Status res = FAIL;
+	for (int i=0; i<nb; i++)
+		if (sign[i]==EQ) return res;
+
+	try {
+		// all the constraints are "<=" (the other ones are negated)
+		double* pt_rhs = new double[nb];
+		char* cc = new char[nb];
+		double* pt_val = new double[beg[nb]];
+		for (int i=0; i<nb; i++) {
+			cc[i] = 'L';
+			if (sign[i] == LEQ || sign[i] == LT) {
+				pt_rhs[i] = rhs[i];
+				for (int k=beg[i]; k<beg[i+1]; k++)
+					pt_val[k] = val[k];
+			} else {
+				pt_rhs[i] = -rhs[i];
+				for (int k=beg[i]; k<beg[i+1]; k++)
+					pt_val[k] = -val[k];
+			}
+		}
+
+		int status = CPXaddrows(envcplex, lpcplex, 0, nb, beg[nb], pt_rhs, cc, (int*) beg,
+				(int*) ind, pt_val, NULL, NULL);
+		if (status==0) {
+			nb_rows+=nb;
+			res = OK;
+		}
+
+		delete[] pt_val;
+		delete[] cc;
+		delete[] pt_rhs;
+	} catch (Exception&) {
+		res = FAIL;
+	}
+	return res;
+}
+
 #endif  // END DEF with CPLEX
 
 
@@ -1458,6 +1603,24 @@ LinearSolver::Status LinearSolver::cleanConst() {
 	return res;
 
 }
+LinearSolver::Status LinearSolver::removeRows(int first) {
+	LinearSolver::Status res= FAIL;
+	try {
+		if (dual_solution!=NULL) delete[] dual_solution;
+		dual_solution=NULL;
+		status_prim = LinearSolver::FAIL;
+		status_dual = LinearSolver::FAIL;
+		if (first<nb_rows) myclp->deleteRows(nb_rows-first,&_which[first-nb_vars]);
+		nb_rows = first;
+		obj_value = POS_INFINITY;
+		res= OK;
+	}
+	catch(Exception& ) {
+		res = FAIL;
+	}
+	return res;
+}
+
 LinearSolver::Status LinearSolver::cleanAll() {
 	LinearSolver::Status res= FAIL;
 	try {
@@ -1567,6 +1730,24 @@ LinearSolver::Status LinearSolver::setBoundVar(int var, Interval bound) {
 	return res;
 }
 
+LinearSolver::Status LinearSolver::setRowRhs(int row, CmpOp sign, double rhs) {
+	LinearSolver::Status res= FAIL;
+	try {
+		if (sign==LEQ || sign==LT) {
+			myclp->setRowBounds(row,NEG_INFINITY,rhs);
+			res = OK;
+		}
+		else if (sign==GEQ || sign==GT) {
+			myclp->setRowBounds(row,rhs,POS_INFINITY);
+			res = OK;
+		}
+	}
+	catch(Exception& ) {
+		res = FAIL;
+	}
+	return res;
+}
+
 LinearSolver::Status LinearSolver::setEpsilon(double eps) {
 	LinearSolver::Status res= FAIL;
 	try {
@@ -1604,6 +1785,37 @@ LinearSolver::Status LinearSolver::addConstraint(ibex::Vector& row, CmpOp sign,
 	return res;
 }
 
+LinearSolver::Status LinearSolver::addConstraints(int nb, const int* beg, const int* ind, const double* val, const CmpOp* sign, const double* rhs) {
+	LinearSolver::Status res= FAIL;
+	for (int i=0; i<nb; i++)
+		if (sign[i]==EQ) return res;
+
+	try {
+		double* lower = new double[nb];
+		double* upper = new double[nb];
+		for (int i=0; i<nb; i++) {
+			if (sign[i]==LEQ || sign[i]==LT) {
+				lower[i] = NEG_INFINITY;
+				upper[i] = rhs[i];
+			} else {
+				lower[i] = rhs[i];
+				upper[i] = POS_INFINITY;
+			}
+		}
+		myclp->addRows(nb, lower, upper, beg, ind, val);
+		nb_rows+=nb;
+		res = OK;
+
+		delete[] upper;
+		delete[] lower;
+	}
+	catch(Exception& ) {
+		res = FAIL;
+	}
+
+	return res;
+}
+
 
 
 
@@ -1922,6 +2134,23 @@ LinearSolver::Status LinearSolver::cleanConst() {
 	return res;
 
 }
+LinearSolver::Status LinearSolver::removeRows(int first) {
+	LinearSolver::Status res= FAIL;
+	try {
+		// the constraints are the columns of the dual formulation
+		int status = first<nb_rows ? CPXdelcols (envcplex, lpcplex, first,  nb_rows - 1) : 0;
+		if (status==0) {
+			nb_rows = first;
+			obj_value = POS_INFINITY;
+			res = OK;
+		}
+	}
+	catch(Exception&) {
+		res = FAIL;
+	}
+	return res;
+}
+
 LinearSolver::Status LinearSolver::cleanAll() {
 	LinearSolver::Status res = FAIL;
 	try {
@@ -2060,6 +2289,11 @@ LinearSolver::Status LinearSolver::setBoundVar(int var, Interval bound) {
 	return res;
 }
 
+LinearSolver::Status LinearSolver::setRowRhs(int row, CmpOp sign, double rhs) {
+	// not supported by the dual formulation: the row must be added again
+	return FAIL;
+}
+
 LinearSolver::Status LinearSolver::setEpsilon(double eps) {
 	LinearSolver::Status res = FAIL;
 	try {
@@ -2112,6 +2346,20 @@ LinearSolver::Status LinearSolver::addConstraint(ibex::Vector& row, CmpOp sign,
 	return res;
 }
 
+LinearSolver::Status LinearSolver::addConstraints(int nb, const int* beg, const int* ind, const double* val, const CmpOp* sign, const double* rhs) {
+	LinearSolver::Status res = OK;
+	// no bulk insertion: the rows are added one by one
+	// (a row that fails does not prevent the next ones to be added)
+	for (int i=0; i<nb; i++) {
+		Vector row(nb_vars,0.0);
+		for (int k=beg[i]; k<beg[i+1]; k++)
+			row[ind[k]] = val[k];
+		if (addConstraint(row, sign[i], rhs[i])!=OK)
+			res = FAIL;
+	}
+	return res;
+}
+
 #endif  // END DEF with ILOCPLEX
 
 
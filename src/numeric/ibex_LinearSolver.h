@@ -5,7 +5,7 @@
 // Author      : Jordan Ninin
 // License     : See the LICENSE file
 // Created     : May 15, 2013
-// Last Update : May 15, 2013
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #ifndef IBEX_LINEARSOLVER_H_
@@ -149,6 +149,14 @@ public:
 
 	Status cleanConst();
 
+	/**
+	 * \brief Remove the last rows, from the row n°first.
+	 *
+	 * The rows of the bounds of the variables cannot be removed
+	 * (\a first must be greater than or equal to their number).
+	 */
+	Status removeRows(int first);
+
 	Status cleanAll();
 
 	Status setMaxIter(int max);
@@ -163,10 +171,39 @@ public:
 
 	Status setBoundVar(int var, Interval bound);
 
+	/**
+	 * \brief Set the right-hand side of a constraint.
+	 *
+	 * The row n°\a row must have been added by #addConstraint or #addConstraints
+	 * with the comparison operator \a sign, which is not modified.
+	 * Return FAIL if the solver does not support this operation.
+	 */
+	Status setRowRhs(int row, CmpOp sign, double rhs);
+
 	Status setEpsilon(double eps);
 
 	Status addConstraint(Vector & row, CmpOp sign, double rhs );
 
+	/**
+	 * \brief Add a sparse constraint.
+	 *
+	 * The constraint is  sum_k val[k]*x[ind[k]] (sign) rhs
+	 * where k ranges over 0...nnz-1.
+	 */
+	Status addConstraint(int nnz, const int* ind, const double* val, CmpOp sign, double rhs);
+
+	/**
+	 * \brief Add nb sparse constraints at once.
+	 *
+	 * The coefficients of the ith constraint are val[beg[i]]...val[beg[i+1]-1],
+	 * on the variables ind[beg[i]]...ind[beg[i+1]-1] (\a beg has nb+1 entries).
+	 * Its comparison operator is sign[i] and its right-hand side rhs[i].
+	 *
+	 * Return FAIL if one of the constraints could not be added. Depending
+	 * on the solver, the other ones may have been added: see #getNbRows().
+	 */
+	Status addConstraints(int nb, const int* beg, const int* ind, const double* val, const CmpOp* sign, const double* rhs);
+
 
 
 };
@@ -0,0 +1,96 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ParserContext.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_PARSER_CONTEXT_H__
+#define __IBEX_PARSER_CONTEXT_H__
+
+#include <stdio.h>
+#include <stack>
+#include "ibex_Scope.h"
+#include "ibex_ParserSource.h"
+
+namespace ibex {
+
+class System;
+class Function;
+
+namespace parser {
+
+/**
+ * \brief Context of the parser.
+ *
+ * Gathers all the data used by the parser and the lexer
+ * during the loading of a system or a function.
+ *
+ * The parser has no global state: two contexts can be used
+ * simultaneously (e.g., by two threads).
+ */
+class P_Context {
+public:
+	/**
+	 * \brief Context for loading a system.
+	 *
+	 * \param choco - true if the input is a stand-alone conjunction
+	 *                of constraints (CHOCO syntax). In this case,
+	 *                system.nb_var must be set before parsing.
+	 */
+	P_Context(System& system, bool choco=false);
+
+	/**
+	 * \brief Context for loading a function.
+	 */
+	P_Context(Function& function);
+
+	/**
+	 * \brief Parse a file.
+	 *
+	 * The file is not closed.
+	 *
+	 * \throws SyntaxError
+	 */
+	void parse(FILE* fd);
+
+	/**
+	 * \brief Parse a memory buffer of \a size characters.
+	 *
+	 * The buffer needs not be null-terminated.
+	 *
+	 * \throws SyntaxError
+	 */
+	void parse(const char* buffer, int size);
+
+	/** System to be loaded (NULL if a function is loaded). */
+	System* system;
+
+	/** Function to be loaded (NULL if a system is loaded). */
+	Function* function;
+
+	/** Generate the pseudo-start token of CHOCO constraints. */
+	bool choco_start;
+
+	/** Current line number. */
+	int lineno;
+
+	/** The scopes. */
+	std::stack<Scope> scopes;
+
+	/** The source. */
+	P_Source source;
+
+private:
+	/* Run the parser on an initialized lexer. */
+	void parse(void* scanner);
+};
+
+} // end namespace parser
+
+} // end namespace ibex
+
+#endif // __IBEX_PARSER_CONTEXT_H__
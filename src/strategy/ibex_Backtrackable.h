@@ -5,13 +5,14 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : May 11, 2012
-// Last Update : May 11, 2012
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #ifndef __IBEX_BACKTRACKABLE_H__
 #define __IBEX_BACKTRACKABLE_H__
 
 #include <utility>
+#include <cstddef>
 
 namespace ibex {
 
@@ -45,6 +46,15 @@ public:
 	 */
 	virtual std::pair<Backtrackable*,Backtrackable*> down()=0;
 
+	/**
+	 * \brief Memory (in bytes) used by *this.
+	 *
+	 * Used to estimate the memory of a cell (see #ibex::Cell::memory()).
+	 * The default implementation only counts the base class: a subclass
+	 * should return its own size plus the memory it allocates.
+	 */
+	virtual size_t memory() const { return sizeof(Backtrackable); }
+
 	/**
 	 * \brief Delete *this.
 	 */
@@ -0,0 +1,108 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_BlockSolver.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "ibex_BlockSolver.h"
+
+using namespace std;
+
+namespace ibex {
+
+BlockSolver::BlockSolver(const System& sys, double prec) : blocks(sys), current(sys.nb_var), over(true) {
+	for (int k=0; k<blocks.nb_blocks(); k++)
+		solvers.push_back(new DefaultSolver(blocks[k], prec));
+	sols.resize(blocks.nb_blocks());
+	index.resize(blocks.nb_blocks());
+}
+
+BlockSolver::~BlockSolver() {
+	for (vector<DefaultSolver*>::iterator it=solvers.begin(); it!=solvers.end(); it++)
+		delete *it;
+}
+
+void BlockSolver::start(const IntervalVector& init_box) {
+	for (int k=0; k<blocks.nb_blocks(); k++)
+		sols[k].clear();
+
+	over=false;
+
+	// the blocks are solved one after the other (note: the
+	// solvers share the timer so they cannot run in parallel).
+	for (int k=0; k<blocks.nb_blocks(); k++) {
+		sols[k]=solvers[k]->solve(blocks.project(k,init_box));
+		// no solution for this block => no solution at all
+		if (sols[k].empty()) {
+			over=true;
+			return;
+		}
+	}
+
+	current=init_box;
+	for (int k=0; k<blocks.nb_blocks(); k++) {
+		index[k]=0;
+		blocks.lift(k,sols[k][0],current);
+	}
+}
+
+bool BlockSolver::next(IntervalVector& sol) {
+	if (over) return false;
+
+	sol=current;
+
+	// next combination (the last block varies first)
+	int k=blocks.nb_blocks()-1;
+	for (; k>=0; k--) {
+		if (++index[k]<sols[k].size()) {
+			blocks.lift(k,sols[k][index[k]],current);
+			break;
+		}
+		index[k]=0;
+		blocks.lift(k,sols[k][0],current);
+	}
+	if (k<0) over=true;
+
+	return true;
+}
+
+bool BlockSolver::next(SolverOutput& out) {
+	IntervalVector sol(current.size());
+	while (next(sol))
+		if (!out.push(sol)) return true;
+	return false;
+}
+
+bool BlockSolver::solve(const IntervalVector& init_box, SolverOutput& out) {
+	start(init_box);
+	return next(out);
+}
+
+vector<IntervalVector> BlockSolver::solve(const IntervalVector& init_box) {
+	vector<IntervalVector> all;
+	IntervalVector sol(init_box.size());
+	start(init_box);
+	while (next(sol))
+		all.push_back(sol);
+	return all;
+}
+
+double BlockSolver::nb_sols() const {
+	double n=1;
+	for (int k=0; k<blocks.nb_blocks(); k++)
+		n*=sols[k].size();
+	return n;
+}
+
+int BlockSolver::nb_cells() const {
+	int n=0;
+	for (int k=0; k<blocks.nb_blocks(); k++)
+		n+=solvers[k]->nb_cells;
+	return n;
+}
+
+} // end namespace ibex
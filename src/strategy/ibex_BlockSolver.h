@@ -0,0 +1,145 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_BlockSolver.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_BLOCK_SOLVER_H__
+#define __IBEX_BLOCK_SOLVER_H__
+
+#include "ibex_DefaultSolver.h"
+#include "ibex_SystemDecomposition.h"
+#include "ibex_SolverOutput.h"
+
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \ingroup strategy
+ *
+ * \brief Solver for decomposable systems.
+ *
+ * The system is decomposed into independent blocks (see
+ * #ibex::SystemDecomposition) and each block is solved separately
+ * by a default solver. Instead of bisecting the Cartesian product
+ * of all the blocks (the number of nodes of the search tree is then
+ * the product of the numbers of nodes of the blocks), the number
+ * of nodes is the sum of the numbers of nodes of the blocks.
+ *
+ * The solutions of the system are the combinations of the solutions
+ * of the blocks. They are generated lazily, one at a time (see
+ * #next(IntervalVector&)), so that the product is never stored.
+ * The variables that appear in no constraint keep their initial domain.
+ */
+class BlockSolver {
+public:
+	/**
+	 * \brief Create a block solver.
+	 *
+	 * \param sys  - The system to solve
+	 * \param prec - Stopping criterion for box splitting (absolute precision)
+	 */
+	BlockSolver(const System& sys, double prec);
+
+	/**
+	 * \brief Delete *this.
+	 */
+	~BlockSolver();
+
+	/**
+	 * \brief Solve the system (non-interactive mode).
+	 *
+	 * Return all the solutions (all the combinations of the solutions of the blocks).
+	 */
+	std::vector<IntervalVector> solve(const IntervalVector& init_box);
+
+	/**
+	 * \brief Solve all the blocks.
+	 *
+	 * The solutions of the system can then be enumerated
+	 * with #next(IntervalVector&).
+	 */
+	void start(const IntervalVector& init_box);
+
+	/**
+	 * \brief Next solution of the system.
+	 *
+	 * \return false if all the solutions have been enumerated.
+	 */
+	bool next(IntervalVector& sol);
+
+	/**
+	 * \brief Solve the system (streaming mode).
+	 *
+	 * \return true if the enumeration has been paused by \a out (call
+	 *         #next(SolverOutput&) to resume), false if it is over.
+	 */
+	bool solve(const IntervalVector& init_box, SolverOutput& out);
+
+	/**
+	 * \brief Continue the enumeration (streaming mode).
+	 *
+	 * \pre #start(const IntervalVector&) has been called.
+	 */
+	bool next(SolverOutput& out);
+
+	/**
+	 * \brief Number of solutions of the system.
+	 *
+	 * This is the product of the numbers of solutions of the blocks
+	 * (it is a double because it may overflow any integer type).
+	 */
+	double nb_sols() const;
+
+	/**
+	 * \brief The solutions of the kth block.
+	 */
+	const std::vector<IntervalVector>& block_sols(int k) const;
+
+	/**
+	 * \brief The solver of the kth block.
+	 */
+	DefaultSolver& solver(int k);
+
+	/**
+	 * \brief Total number of nodes of the search trees of the blocks.
+	 */
+	int nb_cells() const;
+
+	/** The blocks. */
+	SystemDecomposition blocks;
+
+private:
+	BlockSolver(const BlockSolver&); // forbidden
+
+	std::vector<DefaultSolver*> solvers;
+
+	std::vector<std::vector<IntervalVector> > sols;
+
+	// index of the current solution of each block
+	std::vector<unsigned int> index;
+
+	// current solution (combination)
+	IntervalVector current;
+
+	// true if all the solutions have been enumerated
+	bool over;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline const std::vector<IntervalVector>& BlockSolver::block_sols(int k) const {
+	return sols[k];
+}
+
+inline DefaultSolver& BlockSolver::solver(int k) {
+	return *solvers[k];
+}
+
+} // end namespace ibex
+#endif // __IBEX_BLOCK_SOLVER_H__
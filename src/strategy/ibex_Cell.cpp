@@ -5,11 +5,13 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : May 10, 2012
-// Last Update : May 10, 2012
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_Cell.h"
 
+#include <string.h>
+
 namespace ibex {
  Cell::Cell(const IntervalVector& box) : box(box){
 
@@ -26,6 +28,14 @@ std::pair<Cell*,Cell*> Cell::bisect(const IntervalVector& left, const IntervalVe
 	return std::pair<Cell*,Cell*>(cleft,cright);
 }
 
+size_t Cell::memory() const {
+	size_t m=sizeof(Cell)+box.size()*sizeof(Interval);
+	for (IBEXMAP(Backtrackable*)::const_iterator it=data.begin(); it!=data.end(); it++)
+		// the node of the map, the copy of the key and the data
+		m+=4*sizeof(void*)+strlen(it->first)+1+it->second->memory();
+	return m;
+}
+
 Cell::~Cell() {
 	for (IBEXMAP(Backtrackable*)::iterator it=data.begin(); it!=data.end(); it++)
 		delete it->second;
@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : May 10, 2012
-// Last Update : May 10, 2012
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #ifndef __IBEX_CELL_H__
@@ -66,6 +66,13 @@ public:
 	 */
 	~Cell();
 
+	/**
+	 * \brief Estimated memory (in bytes) used by this cell.
+	 *
+	 * Includes the box and the data (see #ibex::Backtrackable::memory()).
+	 */
+	size_t memory() const;
+
 	/**
 	 * \brief Return true if this cell is the root cell.
 	 */
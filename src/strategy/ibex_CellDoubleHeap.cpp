@@ -0,0 +1,243 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CellDoubleHeap.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "ibex_CellDoubleHeap.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// heap indices
+enum { FIRST, SECOND, PRUNE };
+
+// bound for the loup in the criteria (the loup can be infinite)
+const double MAX_LOUP=1.e8;
+
+// the second heap is rebuilt after size/REBUILD_RATIO pops
+const int REBUILD_RATIO=8;
+
+// The criteria of Markot & Casado are undefined (NaN) in some cases, e.g.,
+// if pf is degenerate and loup=pf.lb(). The comparison of NaN is always false, which
+// breaks the order of the heaps: an undefined criterion is replaced by the worst value.
+
+// criterion C3 (cf Markot Casado), to maximize
+double c3(const OptimCell* c, double loup) {
+	double v=(loup - c->pf.lb()) / c->pf.diam();
+	return v!=v? NEG_INFINITY : v;
+}
+
+// criterion C5 (cf Markot Casado), to maximize
+double c5(const OptimCell* c, double loup) {
+	double v=c->pu * c3(c,loup);
+	return v!=v? NEG_INFINITY : v;
+}
+
+// criterion C7 (cf Markot Casado), to minimize
+double c7(const OptimCell* c, double y_lb, double loup) {
+	double d=c5(c,loup);
+	double v=y_lb / d;
+	return (v!=v || d==NEG_INFINITY)? POS_INFINITY : v;
+}
+
+// estimated memory of a cell
+double cell_memory(const OptimCell* c) {
+	return c->memory()+sizeof(OptimCell)-sizeof(Cell);
+}
+
+}
+
+CellDoubleHeap::CellDoubleHeap(int y, criterion crit) : y(y), crit(crit), dive_threshold(POS_INFINITY),
+		_diving(false), mem(0), loup(MAX_LOUP), new_loup(MAX_LOUP), nb_pops(0) {
+
+}
+
+int CellDoubleHeap::order(int k) const {
+	return k==SECOND ? crit : (k==FIRST ? LB : -1);
+}
+
+bool CellDoubleHeap::better(int ord, const OptimCell* c1, const OptimCell* c2) const {
+	const Interval& y1=c1->box[y];
+	const Interval& y2=c2->box[y];
+
+	switch (ord) {
+	case LB:
+		// the classical best first search comparator, based on minimizing the lower bound
+		// of the cost estimate of the cell with the upper bound of the cost for breaking the ties.
+		if (y1.lb()!=y2.lb()) return y1.lb() < y2.lb();
+		else return y1.ub() < y2.ub();
+	case UB:
+		if (y1.ub()!=y2.ub()) return y1.ub() < y2.ub();
+		else return y1.lb() < y2.lb();
+	case C3:
+		return c3(c1,loup) > c3(c2,loup);
+	case C5:
+		return c5(c1,loup) > c5(c2,loup);
+	case C7:
+		return c7(c1,y1.lb(),loup) < c7(c2,y2.lb(),loup);
+	case PU:
+		// feasibility measure of a box
+		return c1->pu > c2->pu;
+	default:
+		// the PRUNE heap: maximal lower bound first
+		return y1.lb() > y2.lb();
+	}
+}
+
+void CellDoubleHeap::sift_up(int k, int i) {
+	vector<OptimCell*>& h=heap[k];
+	OptimCell* c=h[i];
+	while (i>0) {
+		int parent=(i-1)/2;
+		if (!better(order(k),c,h[parent])) break;
+		h[i]=h[parent];
+		h[i]->heap_pos[k]=i;
+		i=parent;
+	}
+	h[i]=c;
+	c->heap_pos[k]=i;
+}
+
+void CellDoubleHeap::sift_down(int k, int i, int ord) {
+	vector<OptimCell*>& h=heap[k];
+	int size=h.size();
+	OptimCell* c=h[i];
+	while (2*i+1<size) {
+		int child=2*i+1;
+		if (child+1<size && better(ord,h[child+1],h[child])) child++;
+		if (!better(ord,h[child],c)) break;
+		h[i]=h[child];
+		h[i]->heap_pos[k]=i;
+		i=child;
+	}
+	h[i]=c;
+	c->heap_pos[k]=i;
+}
+
+void CellDoubleHeap::insert(int k, OptimCell* c) {
+	heap[k].push_back(c);
+	sift_up(k,heap[k].size()-1);
+}
+
+void CellDoubleHeap::erase(int k, OptimCell* c) {
+	vector<OptimCell*>& h=heap[k];
+	int i=c->heap_pos[k];
+	assert(h[i]==c);
+	OptimCell* last=h.back();
+	h.pop_back();
+	if (last!=c) {
+		h[i]=last;
+		last->heap_pos[k]=i;
+		if (i>0 && better(order(k),last,h[(i-1)/2])) sift_up(k,i);
+		else sift_down(k,i,order(k));
+	}
+	c->heap_pos[k]=-1;
+}
+
+void CellDoubleHeap::make_heap(int k, int ord) {
+	vector<OptimCell*>& h=heap[k];
+	for (unsigned int i=0; i<h.size(); i++)
+		h[i]->heap_pos[k]=i;
+	for (int i=h.size()/2-1; i>=0; i--)
+		sift_down(k,i,ord);
+}
+
+OptimCell* CellDoubleHeap::remove(OptimCell* c) {
+	for (int k=0; k<3; k++) erase(k,c);
+	return c;
+}
+
+void CellDoubleHeap::update_keys() {
+	if (new_loup!=loup && REBUILD_RATIO*(++nb_pops)>=size()) {
+		loup=new_loup;
+		make_heap(SECOND,crit);
+		nb_pops=0;
+	}
+}
+
+OptimCell* CellDoubleHeap::pop(int k) {
+	OptimCell* c;
+	if (!dive.empty()) {
+		c=remove(dive.back());
+		dive.pop_back();
+	} else {
+		c=remove(heap[k].front());
+		// start a new dive (from this cell) if the memory is high
+		_diving = mem>dive_threshold;
+	}
+	mem-=cell_memory(c);
+	update_keys();
+	return c;
+}
+
+OptimCell* CellDoubleHeap::pop() {
+	return pop(FIRST);
+}
+
+OptimCell* CellDoubleHeap::pop2() {
+	return pop(SECOND);
+}
+
+void CellDoubleHeap::push(OptimCell* cell) {
+	if (capacity>0 && size()==capacity) throw CellBufferOverflow();
+	for (int k=0; k<3; k++) insert(k,cell);
+	mem+=cell_memory(cell);
+	if (_diving) dive.push_back(cell);
+}
+
+void CellDoubleHeap::shuffle() {
+	// "heap destruction" made by another comparator and reconstruction
+	// of the heap with its comparator
+	make_heap(FIRST,UB);
+	make_heap(FIRST,LB);
+	make_heap(SECOND,crit==LB? UB : LB);
+	make_heap(SECOND,crit);
+}
+
+void CellDoubleHeap::flush() {
+	for (vector<OptimCell*>::iterator it=heap[0].begin(); it!=heap[0].end(); it++)
+		delete *it;
+	for (int k=0; k<3; k++) heap[k].clear();
+	dive.clear();
+	_diving=false;
+	mem=0;
+	loup=new_loup=MAX_LOUP;
+	nb_pops=0;
+}
+
+// E.g.: called in Optimizer in case of a new upper bound
+// on the objective ("loup"). This function then removes (and deletes) from
+// the heap all the cells with a cost greater than loup.
+void CellDoubleHeap::contract_heap(double loup) {
+	// the cells of the dive removed below
+	unsigned int j=0;
+	for (unsigned int i=0; i<dive.size(); i++)
+		if (dive[i]->box[y].lb() <= loup) dive[j++]=dive[i];
+	dive.resize(j);
+
+	while (!empty() && heap[PRUNE].front()->box[y].lb() > loup) {
+		mem-=cell_memory(heap[PRUNE].front());
+		delete remove(heap[PRUNE].front());
+	}
+
+	// the keys of the second heap are updated lazily
+	if ((crit==C3 || crit==C5 || crit==C7) && loup<new_loup)
+		new_loup=loup;
+}
+
+ostream& operator<<(ostream& os, const CellDoubleHeap& heap) {
+	os << "[ ";
+	for (vector<OptimCell*>::const_iterator it=heap.heap[0].begin(); it!=heap.heap[0].end(); it++)
+		os << (*it)->box << " ";
+	return os << "]";
+}
+
+} // end namespace ibex
@@ -0,0 +1,234 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CellDoubleHeap.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_CELL_DOUBLE_HEAP_H__
+#define __IBEX_CELL_DOUBLE_HEAP_H__
+
+#include "ibex_CellBuffer.h"
+#include "ibex_OptimCell.h"
+
+#include <vector>
+
+namespace ibex {
+
+/** \ingroup strategy
+ *
+ * \brief Cell buffer for optimization with two selection criteria.
+ *
+ * The buffer stores (n+1)-dimensional boxes of the following form: <br>
+ * ([x]_1,...[x]_n,[y]) <br>
+ * where "y" is a specific variable. Typically, [y] is the image of a
+ * function f calculated on the box [x]=([x]_1,...[x]_n). <br>
+ *
+ * Each cell is stored once and indexed by three binary heaps:
+ * <ul>
+ * <li> the first one gives the cell that minimizes the lower bound of [y]
+ *      (ties are broken with the upper bound), see #top() and #pop(),
+ * <li> the second one gives the best cell w.r.t. another criterion
+ *      (see #criterion), see #top2() and #pop2(),
+ * <li> the third one gives the cell that maximizes the lower bound of [y]
+ *      (used by #contract_heap(double)).
+ * </ul>
+ * The position of a cell in each heap is stored in the cell itself
+ * (see #OptimCell::heap_pos) so that a cell popped from one heap is
+ * removed from the other ones in logarithmic time.
+ *
+ * When the memory used by the cells exceeds #dive_threshold, the buffer
+ * "dives" as #ibex::CellHybrid does: the subtree of the cell popped is
+ * explored in depth-first order (#top() and #top2() return the last cell
+ * pushed) until it is exhausted. The cells of the dive remain indexed by the
+ * three heaps, so that #minimum() and #contract_heap(double) are not affected.
+ * Cells are never spilled to a file: the memory used by a dive is bounded
+ * by the depth of the search tree.
+ *
+ * \see #CellBuffer, #Optimizer
+ */
+class CellDoubleHeap : public CellBuffer {
+public:
+	/**
+	 * \brief Criteria for the second heap.
+	 *
+	 * LB: lower bound of [y], UB: upper bound of [y], C3, C5, C7: criteria
+	 * of Markot & Casado, PU: feasibility measure of the box.
+	 */
+	typedef enum {LB,UB,C3,C5,C7,PU} criterion;
+
+	/**
+	 * \brief Build a buffer for optimization.
+	 *
+	 * \param y    - the index of the variable "y" that contains the criterion
+	 *               (typically, f(x)) in each cell's box.
+	 * \param crit - the criterion of the second heap.
+	 */
+	CellDoubleHeap(int y, criterion crit=UB);
+
+	/** Index of the criterion variable. */
+	const int y;
+
+	/** The criterion of the second heap. */
+	const criterion crit;
+
+	/**
+	 * \brief Memory threshold (in bytes) for diving.
+	 *
+	 * By default, POS_INFINITY (no dive).
+	 */
+	double dive_threshold;
+
+	/** True if the buffer is currently diving. */
+	bool diving() const;
+
+	/** Estimated memory (in bytes) used by the cells. */
+	double memory() const;
+
+	/**
+	 * \brief Removes (and deletes) all the cells
+	 * with a lower bound greater than \a loup.
+	 *
+	 * Takes O(k log N) time where k is the number of cells
+	 * removed.
+	 *
+	 * The C3, C5 and C7 criteria depend on the loup. The keys of the
+	 * second heap are not updated immediately: they are evaluated with
+	 * the loup of the last rebuild of the heap and the heap is rebuilt
+	 * with the new loup only after a number of pops proportional to
+	 * its size (so that the cost of rebuilds is amortized).
+	 */
+	void contract_heap(double loup);
+
+	/**
+	 * \brief Break the ties of the first two heaps another way.
+	 *
+	 * Each heap is rebuilt with another criterion, then with its own
+	 * one, so that the cells with the same key are popped in a different
+	 * order (diversification). Takes O(N) time.
+	 */
+	void shuffle();
+
+	/** Flush the buffer.
+	 * All the remaining cells will be *deleted* */
+	void flush();
+
+	/** Return the size of the buffer. */
+	int size() const;
+
+	/** Return true if the buffer is empty. */
+	bool empty() const;
+
+	/** Push a new cell in the buffer. */
+	void push(OptimCell* cell);
+
+	// unused : only for compilation
+	void push(Cell* cell) { assert(false); }
+
+	/** Return the best cell w.r.t. the first criterion (but does not pop it).
+	 * During a dive, return the last cell pushed. */
+	OptimCell* top() const;
+
+	/** Pop the best cell w.r.t. the first criterion and return it.
+	 * During a dive, pop the last cell pushed. */
+	OptimCell* pop();
+
+	/** Return the best cell w.r.t. the second criterion (but does not pop it).
+	 * During a dive, return the last cell pushed. */
+	OptimCell* top2() const;
+
+	/** Pop the best cell w.r.t. the second criterion and return it.
+	 * During a dive, pop the last cell pushed. */
+	OptimCell* pop2();
+
+	/** Return the minimum (the lower bound of [y]
+	 * for the first cell). */
+	double minimum() const;
+
+private:
+	friend std::ostream& operator<<(std::ostream&, const CellDoubleHeap&);
+
+	// the order of the kth heap (a criterion, or -1 for the PRUNE heap)
+	int order(int k) const;
+
+	// true if c1 is strictly better than c2 w.r.t. the order ord
+	bool better(int ord, const OptimCell* c1, const OptimCell* c2) const;
+
+	void insert(int k, OptimCell* c);
+
+	void erase(int k, OptimCell* c);
+
+	void sift_up(int k, int i);
+
+	void sift_down(int k, int i, int ord);
+
+	// rebuild the kth heap with the order ord
+	void make_heap(int k, int ord);
+
+	// rebuild the second heap if its keys are too old
+	void update_keys();
+
+	// remove the cell from all the heaps
+	OptimCell* remove(OptimCell* c);
+
+	// pop the cell of the kth heap, or of the dive
+	OptimCell* pop(int k);
+
+	std::vector<OptimCell*> heap[3];
+
+	// cells pushed during the current dive
+	std::vector<OptimCell*> dive;
+
+	// true if the cells pushed go to the dive
+	bool _diving;
+
+	double mem;
+
+	// the loup used by the keys of the second heap
+	double loup;
+
+	// the last loup given to contract_heap
+	double new_loup;
+
+	// number of pops since the keys of the second heap are stale
+	int nb_pops;
+};
+
+/** Display the buffer */
+std::ostream& operator<<(std::ostream&, const CellDoubleHeap&);
+
+/*================================== inline implementations ========================================*/
+
+inline int CellDoubleHeap::size() const {
+	return heap[0].size();
+}
+
+inline bool CellDoubleHeap::empty() const {
+	return heap[0].empty();
+}
+
+inline OptimCell* CellDoubleHeap::top() const {
+	return dive.empty()? heap[0].front() : dive.back();
+}
+
+inline OptimCell* CellDoubleHeap::top2() const {
+	return dive.empty()? heap[1].front() : dive.back();
+}
+
+inline bool CellDoubleHeap::diving() const {
+	return _diving;
+}
+
+inline double CellDoubleHeap::memory() const {
+	return mem;
+}
+
+inline double CellDoubleHeap::minimum() const {
+	return heap[0].front()->box[y].lb();
+}
+
+} // end namespace ibex
+#endif // __IBEX_CELL_DOUBLE_HEAP_H__
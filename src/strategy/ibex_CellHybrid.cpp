@@ -0,0 +1,299 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CellHybrid.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include <string.h>
+
+#include "ibex_CellHybrid.h"
+#include "ibex_UnknownFileException.h"
+
+#include <algorithm>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// same order as in CellHeap
+struct CellComparator {
+	bool operator()(const pair<Cell*,double>& c1, const pair<Cell*,double>& c2) {
+		return c1.second >= c2.second;
+	}
+};
+
+struct CostLess {
+	bool operator()(const pair<Cell*,double>& c1, const pair<Cell*,double>& c2) {
+		return c1.second < c2.second;
+	}
+};
+
+}
+
+CellHybrid::CellHybrid(double dive_threshold, double max_memory, const char* spill_file) :
+		dive_threshold(dive_threshold), max_memory(max_memory), _diving(false), mem(0), spilled(0),
+		spill_file(spill_file? spill_file : ""), fd(NULL), end(0) {
+
+}
+
+CellHybrid::~CellHybrid() {
+	flush();
+	if (fd) {
+		fclose(fd);
+		if (!spill_file.empty()) remove(spill_file.c_str());
+	}
+}
+
+void CellHybrid::flush() {
+	for (vector<pair<Cell*,double> >::iterator it=heap.begin(); it!=heap.end(); it++)
+		delete it->first;
+	heap.clear();
+
+	for (vector<pair<Cell*,double> >::iterator it=stack.begin(); it!=stack.end(); it++)
+		delete it->first;
+	stack.clear();
+
+	for (int k=0; k<2; k++) {
+		vector<Run*>& r=k==0? runs : stack_runs;
+		for (vector<Run*>::iterator it=r.begin(); it!=r.end(); it++) {
+			for (vector<pair<Cell*,double> >::iterator it2=(*it)->cells.begin(); it2!=(*it)->cells.end(); it2++)
+				if (it2->first) delete it2->first;
+			delete *it;
+		}
+		r.clear();
+	}
+
+	_diving=false;
+	mem=0;
+	spilled=0;
+	end=0;
+	holes.clear();
+}
+
+void CellHybrid::push(Cell* cell) {
+	if (capacity>0 && size()==capacity) throw CellBufferOverflow();
+
+	mem+=cell->memory();
+
+	if (_diving)
+		stack.push_back(pair<Cell*,double>(cell,0));
+	else {
+		heap.push_back(pair<Cell*,double>(cell,cost(*cell)));
+		push_heap(heap.begin(), heap.end(), CellComparator());
+	}
+
+	if (mem>max_memory && heap.size()>=2) spill();
+
+	if (mem>max_memory && stack.size()>=2) spill_stack();
+}
+
+Cell* CellHybrid::pop() {
+	Cell* c;
+	if (!stack.empty()) {
+		c=stack.back().first;
+		stack.pop_back();
+	} else {
+		c=heap.front().first;
+		pop_heap(heap.begin(), heap.end(), CellComparator());
+		heap.pop_back();
+		// start a new dive (from the best cell) if the memory is high
+		// (spilling may not be enough to stay under max_memory)
+		_diving = mem>dive_threshold || mem>max_memory;
+	}
+
+	mem-=c->memory();
+
+	if (stack.empty()) {
+		if (!stack_runs.empty()) {
+			// the dive goes on with the bottom of the stack
+			Run* run=stack_runs.back();
+			stack_runs.pop_back();
+			read(run);
+			stack=run->cells;
+			delete run;
+		} else
+			reload();
+	}
+
+	return c;
+}
+
+Cell* CellHybrid::top() const {
+	if (!stack.empty()) return stack.back().first;
+	else return heap.front().first;
+}
+
+long CellHybrid::allocate(long size) {
+	for (vector<pair<long,long> >::iterator it=holes.begin(); it!=holes.end(); it++) {
+		if (it->second>=size) {
+			long offset=it->first;
+			if (it->second==size) holes.erase(it);
+			else {
+				it->first+=size;
+				it->second-=size;
+			}
+			return offset;
+		}
+	}
+	long offset=end;
+	end+=size;
+	return offset;
+}
+
+void CellHybrid::release(long offset, long size) {
+	vector<pair<long,long> >::iterator it=holes.begin();
+	while (it!=holes.end() && it->first<offset) it++;
+	it=holes.insert(it, pair<long,long>(offset,size));
+
+	// merge with the next and previous holes
+	if (it+1!=holes.end() && it->first+it->second==(it+1)->first) {
+		it->second+=(it+1)->second;
+		holes.erase(it+1);
+	}
+	if (it!=holes.begin() && (it-1)->first+(it-1)->second==it->first) {
+		(it-1)->second+=it->second;
+		it=holes.erase(it)-1;
+	}
+
+	// the space at the end of the file is not a hole
+	if (it->first+it->second==end) {
+		end=it->first;
+		holes.erase(it);
+	}
+}
+
+CellHybrid::Run* CellHybrid::write(vector<pair<Cell*,double> >::iterator first, vector<pair<Cell*,double> >::iterator last) {
+	if (fd==NULL) {
+		if (spill_file.empty()) {
+			fd=tmpfile();
+			if (fd==NULL) throw CellBufferOverflow();
+		} else {
+			fd=fopen(spill_file.c_str(), "w+b");
+			if (fd==NULL) throw UnknownFileException(spill_file.c_str());
+		}
+	}
+
+	int n=first->first->box.size();
+	long size=(last-first)*2*n*sizeof(double);
+	long offset=allocate(size);
+	double* buf=new double[2*n];
+
+	fseek(fd, offset, SEEK_SET);
+	for (vector<pair<Cell*,double> >::iterator it=first; it!=last; it++) {
+		const IntervalVector& box=it->first->box;
+		assert(box.size()==n);
+		for (int i=0; i<n; i++) {
+			buf[2*i]=box[i].lb();
+			buf[2*i+1]=box[i].ub();
+		}
+		if ((int) fwrite(buf, sizeof(double), 2*n, fd)!=2*n) {
+			delete[] buf;
+			release(offset, size);
+			throw CellBufferOverflow();
+		}
+	}
+	delete[] buf;
+
+	Run* run=new Run();
+	run->offset=offset;
+	run->n=n;
+	run->min=POS_INFINITY;
+
+	for (vector<pair<Cell*,double> >::iterator it=first; it!=last; it++) {
+		mem-=it->first->memory();
+		if (it->first->data.size()==0) {
+			// the cell is rebuilt from its box when loaded
+			delete it->first;
+			run->cells.push_back(pair<Cell*,double>(NULL,it->second));
+		} else {
+			// only the data of the cell remain in memory
+			it->first->box.resize(1);
+			mem+=it->first->memory();
+			run->cells.push_back(*it);
+		}
+		if (it->second<run->min) run->min=it->second;
+	}
+
+	spilled+=run->cells.size();
+	return run;
+}
+
+void CellHybrid::read(Run* run) {
+	int n=run->n;
+	double* buf=new double[2*n];
+
+	fseek(fd, run->offset, SEEK_SET);
+	for (vector<pair<Cell*,double> >::iterator it=run->cells.begin(); it!=run->cells.end(); it++) {
+		if ((int) fread(buf, sizeof(double), 2*n, fd)!=2*n) {
+			delete[] buf;
+			throw CellBufferOverflow();
+		}
+		if (it->first==NULL) {
+			it->first=new Cell(IntervalVector(n));
+		} else {
+			mem-=it->first->memory();
+			it->first->box.resize(n);
+		}
+		IntervalVector& box=it->first->box;
+		for (int i=0; i<n; i++)
+			box[i]=Interval(buf[2*i],buf[2*i+1]);
+		mem+=it->first->memory();
+	}
+	delete[] buf;
+
+	int nb=run->cells.size();
+	spilled-=nb;
+	release(run->offset, nb*2*n*sizeof(double));
+}
+
+void CellHybrid::spill() {
+	// the best half remains in the heap
+	int k=heap.size()/2;
+	nth_element(heap.begin(), heap.begin()+k, heap.end(), CostLess());
+
+	runs.push_back(write(heap.begin()+k, heap.end()));
+
+	heap.resize(k);
+	make_heap(heap.begin(), heap.end(), CellComparator());
+}
+
+void CellHybrid::spill_stack() {
+	// the top half remains in the stack
+	int k=stack.size()/2;
+
+	stack_runs.push_back(write(stack.begin(), stack.begin()+k));
+
+	stack.erase(stack.begin(), stack.begin()+k);
+}
+
+void CellHybrid::reload() {
+	while (!runs.empty()) {
+		int r=0;
+		for (unsigned int i=1; i<runs.size(); i++)
+			if (runs[i]->min<runs[r]->min) r=i;
+
+		if (!heap.empty() && heap.front().second<=runs[r]->min) return;
+
+		Run* run=runs[r];
+		runs.erase(runs.begin()+r);
+
+		read(run);
+
+		for (vector<pair<Cell*,double> >::iterator it=run->cells.begin(); it!=run->cells.end(); it++) {
+			heap.push_back(*it);
+			push_heap(heap.begin(), heap.end(), CellComparator());
+		}
+
+		delete run;
+
+		if (mem>max_memory && heap.size()>=2) spill();
+	}
+}
+
+} // end namespace ibex
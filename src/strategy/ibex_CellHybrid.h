@@ -0,0 +1,210 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CellHybrid.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_CELL_HYBRID_H__
+#define __IBEX_CELL_HYBRID_H__
+
+#include "ibex_CellBuffer.h"
+
+#include <stdio.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ibex {
+
+/** \ingroup strategy
+ *
+ * \brief Best-first buffer with depth-first dives and bounded memory.
+ *
+ * The cells are stored in a heap (as in #ibex::CellHeap) so that, by
+ * default, the next cell is the one with the minimal cost (best-first search).
+ *
+ * Best-first search consumes a lot of memory. When the memory used by the
+ * buffer exceeds #dive_threshold, the buffer "dives": the subtree of the best
+ * cell is explored in depth-first order (the cells pushed during a dive are
+ * stored in a stack) and the buffer switches back to best-first selection
+ * once the dive is over, i.e., when this stack is empty.
+ *
+ * When the memory still exceeds #max_memory, the worst half of the heap
+ * (the "cold" cells) is spilled to a binary file. Only the boxes are written:
+ * a cell without data is entirely removed from memory but the data of the other
+ * cells (see #ibex::Backtrackable) remain in memory. The spilled cells are loaded
+ * back as soon as the best of them is better than the top of the heap.
+ * The buffer also dives as long as the memory exceeds #max_memory.
+ * If the heap is too small, the bottom half of the dive stack (the cells
+ * that will be popped last) is spilled as well and loaded back when the
+ * rest of the stack is empty.
+ *
+ * The space of the cells loaded back is reused in the file by the next spills.
+ *
+ * The memory used by a cell is estimated with #ibex::Cell::memory() (box and data).
+ * The memory stays under #max_memory, except for the data of the spilled
+ * cells and the last cell of the stack or the heap.
+ * Note: spilled cells without data are rebuilt as #ibex::Cell objects: this
+ * buffer cannot store objects of a subclass of #ibex::Cell without data.
+ *
+ * #push() and #pop() are in logarithmic time (amortized, with
+ * spilling).
+ *
+ * \see #CellBuffer, #CellHeap
+ */
+class CellHybrid : public CellBuffer {
+public:
+
+	/**
+	 * \brief Create a hybrid buffer.
+	 *
+	 * \param dive_threshold - memory (in bytes) above which the
+	 *                         buffer dives.
+	 * \param max_memory     - memory (in bytes) above which the cells
+	 *                         are spilled to a file.
+	 * \param spill_file     - name of the file (if NULL, an anonymous
+	 *                         temporary file is used).
+	 */
+	CellHybrid(double dive_threshold=POS_INFINITY, double max_memory=POS_INFINITY, const char* spill_file=NULL);
+
+	/** Delete *this (and the spill file). */
+	~CellHybrid();
+
+	/** Flush the buffer.
+	 * All the remaining cells will be *deleted* */
+	void flush();
+
+	/** Return the size of the buffer (including spilled cells). */
+	int size() const;
+
+	/** Return true if the buffer is empty. */
+	bool empty() const;
+
+	/** Push a new cell in the buffer. */
+	void push(Cell* cell);
+
+	/** Pop a cell from the buffer and return it.*/
+	Cell* pop();
+
+	/** Return the next box (but does not pop it).*/
+	Cell* top() const;
+
+	/** True if the buffer is currently diving. */
+	bool diving() const;
+
+	/** Estimated memory (in bytes) used by the cells in memory. */
+	double memory() const;
+
+	/** Number of cells currently spilled to the file. */
+	int nb_spilled() const;
+
+	/** Size (in bytes) of the part of the spill file in use. */
+	long spill_size() const;
+
+	/** Memory threshold for diving. */
+	const double dive_threshold;
+
+	/** Memory threshold for spilling. */
+	const double max_memory;
+
+protected:
+	/** The "cost" of a cell. */
+	virtual double cost(const Cell&) const=0;
+
+private:
+	CellHybrid(const CellHybrid&); // forbidden
+
+	/* A group of cells spilled together. */
+	struct Run {
+		long offset;   // position of the boxes in the file
+		int n;         // size of the boxes
+		double min;    // minimal cost of the cells
+		// the cells (NULL if deleted)
+		std::vector<std::pair<Cell*,double> > cells;
+	};
+
+	// spill the worst half of the heap
+	void spill();
+
+	// spill the bottom half of the stack
+	void spill_stack();
+
+	// write the boxes of the cells in [first,last) into the file
+	Run* write(std::vector<std::pair<Cell*,double> >::iterator first, std::vector<std::pair<Cell*,double> >::iterator last);
+
+	// read the boxes of the cells of a run (and free its space in the file)
+	void read(Run* run);
+
+	// load back the best run if it is better than the top of the heap
+	void reload();
+
+	// position of a free space of the given size in the file
+	long allocate(long size);
+
+	// mark a space in the file as free
+	void release(long offset, long size);
+
+	// cells and associated costs
+	std::vector<std::pair<Cell*,double> > heap;
+
+	// cells pushed during the current dive (costs are not used)
+	std::vector<std::pair<Cell*,double> > stack;
+
+	// true if the cells pushed go to the stack
+	bool _diving;
+
+	double mem;
+
+	// spilled parts of the heap
+	std::vector<Run*> runs;
+
+	// spilled parts of the stack (the last run is the top)
+	std::vector<Run*> stack_runs;
+
+	int spilled;
+
+	// empty if the file is anonymous
+	std::string spill_file;
+
+	FILE* fd;
+
+	// end of the data in the file
+	long end;
+
+	// free spaces in the file before "end" (offset and size)
+	// sorted by offset and not contiguous.
+	std::vector<std::pair<long,long> > holes;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline int CellHybrid::size() const {
+	return heap.size()+stack.size()+spilled;
+}
+
+inline bool CellHybrid::empty() const {
+	return size()==0;
+}
+
+inline bool CellHybrid::diving() const {
+	return _diving;
+}
+
+inline double CellHybrid::memory() const {
+	return mem;
+}
+
+inline int CellHybrid::nb_spilled() const {
+	return spilled;
+}
+
+inline long CellHybrid::spill_size() const {
+	return end;
+}
+
+} // end namespace ibex
+#endif // __IBEX_CELL_HYBRID_H__
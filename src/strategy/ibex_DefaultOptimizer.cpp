@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Aug 27, 2012
-// Last Update : Jul 06, 2014
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_DefaultOptimizer.h"
@@ -13,6 +13,7 @@
 #include "ibex_CtcHC4.h"
 #include "ibex_CtcAcid.h"
 #include "ibex_CtcCompo.h"
+#include "ibex_CtcAdaptive.h"
 #include "ibex_CtcFixPoint.h"
 #include "ibex_CtcPolytopeHull.h"
 #include "ibex_LinearRelaxCombo.h"
@@ -85,7 +86,12 @@ Ctc&  DefaultOptimizer::ctc(System& sys, System& ext_sys, double prec) {
 		index++;
 	}
 	ctc_list.resize(index);
-	return rec(new CtcCompo(ctc_list));
+
+	// the polytope hull is only called if it has been efficient
+	vector<bool> expensive(index,false);
+	if (index>2) expensive[2]=true;
+
+	return rec(new CtcAdaptive(ctc_list, expensive));
 }
 
 
@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Apr 15, 2013
-// Last Update : Apr 15, 2013
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_EntailedCtr.h"
@@ -44,6 +44,13 @@ EntailedCtr::EntailedCtr(const EntailedCtr& e) : orig_sys(e.orig_sys), norm_sys(
 	}
 }
 
+size_t EntailedCtr::memory() const {
+	size_t m=sizeof(EntailedCtr);
+	if (orig_sys) m+=orig_sys->nb_ctr*sizeof(bool);
+	if (norm_sys) m+=norm_sys->nb_ctr*sizeof(bool);
+	return m;
+}
+
 std::pair<Backtrackable*,Backtrackable*> EntailedCtr::down() {
 	return std::pair<Backtrackable*,Backtrackable*>(new EntailedCtr(*this),new EntailedCtr(*this));
 }
@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Apr 15, 2013
-// Last Update : Apr 15, 2013
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #ifndef __IBEX_ENTAILED_CTR_H__
@@ -82,6 +82,11 @@ public:
 	 */
 	std::pair<Backtrackable*,Backtrackable*> down();
 
+	/**
+	 * \brief Memory used by *this.
+	 */
+	size_t memory() const;
+
 	/** number of constraints (normalized system) */
 	//const int n;
 
@@ -41,6 +41,10 @@ std::pair<Backtrackable*,Backtrackable*> Multipliers::down() {
 	return std::pair<Backtrackable*,Backtrackable*>(new Multipliers(*this),new Multipliers(*this));
 }
 
+size_t Multipliers::memory() const {
+	return sizeof(Multipliers)+lambda.size()*sizeof(Interval);
+}
+
 Multipliers::~Multipliers() {
 
 }
@@ -53,6 +53,11 @@ public:
 	 */
 	std::pair<Backtrackable*,Backtrackable*> down();
 
+	/**
+	 * \brief Memory used by *this.
+	 */
+	size_t memory() const;
+
 	IntervalVector lambda;
 protected:
 
@@ -5,14 +5,15 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Apr 7, 2014
-// Last Update : Apr 7, 2014
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_OptimCell.h"
 
 namespace ibex {
 
-  OptimCell::OptimCell(const IntervalVector& box) : Cell(box),heap_present(0),loup(0) {
+  OptimCell::OptimCell(const IntervalVector& box) : Cell(box) {
+	heap_pos[0]=heap_pos[1]=heap_pos[2]=-1;
 
 }
 
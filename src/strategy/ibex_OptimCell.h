@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Apr 7, 2014
-// Last Update : Apr 7, 2014
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #ifndef __IBEX_OPTIM_CELL_H__
@@ -30,15 +30,13 @@ public:
  OptimCell(const IntervalVector& box);
 
  std::pair<OptimCell*,OptimCell*> bisect(const IntervalVector& left, const IntervalVector& right);
-/** for the management of the 2 heaps : a live cell has a value 2 for heap_present */
-	int heap_present;
+/** positions of the cell in the heaps of a #CellDoubleHeap */
+	int heap_pos[3];
 	/** for the Casado criteria */
 	/** the image of the objective on the current box */
 	Interval pf;
 	/** the constraint factor of the current box : between 0 infeasible and 1 for all constraints satisfied */
 	double pu;
-	/** the current loup : updated by contract_heap  */
-	double loup;
 	};
 
   } // end namespace ibex
@@ -4,7 +4,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : May 14, 2012
-// Last Update : December 24, 2012
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_Optimizer.h"
@@ -38,17 +38,19 @@ const double Optimizer::default_equ_eps = 1e-08;
 const double Optimizer::default_loup_tolerance = 0.1;
 
 void Optimizer::write_ext_box(const IntervalVector& box, IntervalVector& ext_box) {
+	const int goal_var=ext_sys.goal_var();
 	int i2=0;
 	for (int i=0; i<n; i++,i2++) {
-		if (i2==ext_sys.goal_var()) i2++; // skip goal variable
+		if (i2==goal_var) i2++; // skip goal variable
 		ext_box[i2]=box[i];
 	}
 }
 
 void Optimizer::read_ext_box(const IntervalVector& ext_box, IntervalVector& box) {
+	const int goal_var=ext_sys.goal_var();
 	int i2=0;
 	for (int i=0; i<n; i++,i2++) {
-		if (i2==ext_sys.goal_var()) i2++; // skip goal variable
+		if (i2==goal_var) i2++; // skip goal variable
 		box[i]=ext_box[i2];
 	}
 }
@@ -56,20 +58,31 @@ void Optimizer::read_ext_box(const IntervalVector& ext_box, IntervalVector& box)
 
 
 
+Optimizer::Workspace::Workspace(int n, int m) :
+		pt_box(n), tmp_box(n), inbox(n), G(n), zero(n,Interval::ZERO),
+		pt(n), pt2(n), seg(n), dist(n), corner(new bool[n]), x_corner(n),
+		g_corner(m>0? m : 1), row(n+1), bound(n+1), prim(n+1) {
+}
+
+Optimizer::Workspace::~Workspace() {
+	delete[] corner;
+}
+
 Optimizer::Optimizer(System& user_sys, Ctc& ctc, Bsc& bsc, double prec,
 					 double goal_rel_prec, double goal_abs_prec, int sample_size, double equ_eps,
-					 bool rigor,  int critpr,CellHeapOptim::criterion crit) :
+					 bool rigor,  int critpr,CellDoubleHeap::criterion crit) :
                 user_sys(user_sys), sys(user_sys,equ_eps),
 				n(user_sys.nb_var), m(sys.nb_ctr) /* (warning: not user_sys.nb_ctr) */,
 				ext_sys(user_sys,equ_eps),
 				bsc(bsc), ctc(ctc),
-				buffer(n),buffer2(n,crit),  // first buffer with LB, second buffer with ct (default UB))
+				buffer(n,crit),  // first criterion LB, second criterion crit (default UB)
 				prec(prec), goal_rel_prec(goal_rel_prec), goal_abs_prec(goal_abs_prec),
 				sample_size(sample_size), mono_analysis_flag(true), in_HC4_flag(true), trace(false),
 				timeout(1e08), loup(POS_INFINITY), uplo(NEG_INFINITY), pseudo_loup(POS_INFINITY),
 				loup_point(n), loup_box(n),
 				df(*user_sys.goal,Function::DIFF), rigor(rigor),
-				uplo_of_epsboxes(POS_INFINITY), nb_cells(0), loup_changed(false), critpr(critpr) {
+				uplo_of_epsboxes(POS_INFINITY), nb_cells(0), loup_changed(false), critpr(critpr),
+				ws(n,m) {
 
 	// ==== build the system of equalities only ====
 	try {
@@ -112,8 +125,7 @@ Optimizer::~Optimizer() {
 		delete is_inside;
 	}
 	buffer.flush();
-	if (critpr > 0) buffer2.flush();
-	
+
 	delete mylp;
 	//	delete &(objshaver->ctc);
 	//	delete objshaver;
@@ -241,7 +253,7 @@ void Optimizer::update_uplo() {
 
 
 /* contract the box of the cell c , try to find a new loup :;
-     push the cell  in the 2 heaps or if the contraction makes the box empty, delete the cell. For diversification, rebuild the 2 heaps
+     push the cell  in the buffer or if the contraction makes the box empty, delete the cell.
 */
 
   void Optimizer::handle_cell(OptimCell& c, const IntervalVector& init_box ){
@@ -251,31 +263,21 @@ void Optimizer::update_uplo() {
 
 		// Computations for the Casado C3, C5, C7 criteria 
 
-	  if ((buffer2.crit==CellHeapOptim::C3)||(buffer2.crit==CellHeapOptim::C5)||(buffer2.crit==CellHeapOptim::C7))
-	    {compute_pf(c);
-		  
-		  if (loup < 1.e8)
-			c.loup=loup;
-		  else
-			c.loup=1.e8;
-		}
+	  if ((buffer.crit==CellDoubleHeap::C3)||(buffer.crit==CellDoubleHeap::C5)||(buffer.crit==CellDoubleHeap::C7))
+	    compute_pf(c);
 	  
 	  // computations for C5, C7 and PU criteria
-	  if ((buffer2.crit==CellHeapOptim::C5)||(buffer2.crit==CellHeapOptim::C7)||(buffer2.crit==CellHeapOptim::PU))
+	  if ((buffer.crit==CellDoubleHeap::C5)||(buffer.crit==CellDoubleHeap::C7)||(buffer.crit==CellDoubleHeap::PU))
 		compute_pu(c);
 	  
-	  // the cell is put into the 2 heaps	  
+	  // the cell is put into the buffer (in the 2 heaps)
       buffer.push(&c);
-      if (critpr > 0)      buffer2.push(&c);
 
       nb_cells++;
-	  // reconstruction of the 2 heaps every heap_build_period nodes
+	  // the ties are broken another way every heap_build_period nodes
       int heap_build_period=100;
       if (nb_cells% heap_build_period ==0)
-	{ buffer.makeheap();
-	  if (critpr > 0) buffer2.makeheap();
-	}
-
+	    buffer.shuffle();
     }
     catch(EmptyBoxException&) {
       delete &c;
@@ -329,6 +331,8 @@ void Optimizer::contract_and_bound(OptimCell& c, const IntervalVector& init_box)
 	//cout << " [contract]  x before=" << c.box << endl;
 	//cout << " [contract]  y before=" << y << endl;
 
+	ctc.set_cell(&c);
+
 	contract(c.box, init_box);
     
 	
@@ -339,23 +343,28 @@ void Optimizer::contract_and_bound(OptimCell& c, const IntervalVector& init_box)
 
 
 	/*========================= update loup =============================*/
-	
-	IntervalVector tmp_box(n);
-	read_ext_box(c.box,tmp_box);
+
+	read_ext_box(c.box,ws.tmp_box);
 
 	entailed = &c.get<EntailedCtr>();
-	update_entailed_ctr(tmp_box);
+	update_entailed_ctr(ws.tmp_box);
 
-	bool loup_ch=update_loup(tmp_box);
+	bool loup_ch=update_loup(ws.tmp_box);
     // update of the upper bound of y in case of a new loup found
 	if (loup_ch)  	y &= Interval(NEG_INFINITY,compute_ymax());
 	loup_changed |= loup_ch;
+	// the cell cannot contain a point better than the new loup
+	// (an empty y would break the order of the buffer)
+	if (y.is_empty()) {
+		c.box.set_empty();
+		throw EmptyBoxException();
+	}
 	/*====================================================================*/
 	// [gch] TODO: the case (!c.box.is_bisectable()) seems redundant
 	// with the case of a NoBisectableVariableException in
 	// optimize(). Is update_uplo_of_epsboxes called twice in this case?
 	// (bn] NO , the NoBisectableVariableException is raised by the bisector, there are 2 different cases of a non bisected box that may cause an update of uplo_of_epsboxes
-	if ((tmp_box.max_diam()<=prec && y.diam() <=goal_abs_prec) || !c.box.is_bisectable()) {
+	if ((ws.tmp_box.max_diam()<=prec && y.diam() <=goal_abs_prec) || !c.box.is_bisectable()) {
 		// rem1: tmp_box and not c.box because y is handled with goal_rel_prec and goal_abs_prec
 		// rem2: do not use a precision contractor here since it would make the box empty (and y==(-inf,-inf)!!)
 		// rem 3 : the extended  boxes with no bisectable  domains  should be catched for avoiding infinite bisections
@@ -366,9 +375,9 @@ void Optimizer::contract_and_bound(OptimCell& c, const IntervalVector& init_box)
 	//gradient=0 contraction for unconstrained optimization ; 
 	//first order test for constrained optimization (useful only when there are no equations replaced by inequalities) 
 	//works with the box without the objective (tmp_box)
-	firstorder_contract(tmp_box,init_box);
+	firstorder_contract(ws.tmp_box,init_box);
 	// the current extended box in the cell is updated
-	write_ext_box(tmp_box,c.box);
+	write_ext_box(ws.tmp_box,c.box);
 	
 	
 	  }
@@ -383,7 +392,7 @@ void Optimizer::firstorder_contract(  IntervalVector& box, const  IntervalVector
 			if (n==1)
 				df.backward(Interval::ZERO,box);
 			else
-				df.backward(IntervalVector(n,Interval::ZERO),box);
+				df.backward(ws.zero,box);
 		}
 	}
 	
@@ -419,8 +428,7 @@ void Optimizer::optimize(const IntervalVector& init_box, double obj_init_bound)
 	diam_rand=0;
 
 	buffer.flush();
-	if (critpr > 0) buffer2.flush();
-	
+
 	OptimCell* root=new OptimCell(IntervalVector(n+1));
 
 	write_ext_box(init_box,root->box);
@@ -428,6 +436,9 @@ void Optimizer::optimize(const IntervalVector& init_box, double obj_init_bound)
 	// add data required by the bisector
 	bsc.add_backtrackable(*root);
 
+	// add data required by the contractor
+	ctc.add_backtrackable(*root);
+
 	// add data required by optimizer + Fritz John contractor
 	root->add<EntailedCtr>();
 	//root->add<Multipliers>();
@@ -444,22 +455,11 @@ void Optimizer::optimize(const IntervalVector& init_box, double obj_init_bound)
 	try {
 		while (!buffer.empty()) {
 		  if (trace >= 2) cout << " buffer " << ((CellBuffer&) buffer) << endl;
-		  if (critpr> 0 && trace >= 2) cout << "  buffer2 " << ((CellBuffer&) buffer2) << endl;
-		  //		  cout << "buffer size "  << buffer.size() << " " << buffer2.size() << endl;
-		  // removes from the heap buffer, the cells already chosen in the other buffer
-		  if (critpr >0)
-			{buffer.cleantop();
-			  buffer2.cleantop();
-			}
 		  update_uplo();
-		  if (buffer.empty() || (critpr > 0 && buffer2.empty())) {
-			  //cout << " buffer empty " << buffer.empty() << " " << buffer2.empty() << endl;
-			  break;
-		  }
 		  
 			loup_changed=false;
 			OptimCell *c;
-			// random choice between the 2 buffers corresponding to two criteria implemented in two heaps)
+			// random choice between the 2 criteria implemented in the two heaps of the buffer
 			// critpr chances over 100 to choose the second heap
 			if (rand() % 100 >=critpr)
 			  { indbuf=0;
@@ -467,7 +467,7 @@ void Optimizer::optimize(const IntervalVector& init_box, double obj_init_bound)
 			  }
 			else {
 			  indbuf=1;
-			  c=buffer2.top();  // the second heap is used
+			  c=buffer.top2();  // the second heap is used
 			}
 			  
 			try {
@@ -477,8 +477,8 @@ void Optimizer::optimize(const IntervalVector& init_box, double obj_init_bound)
 				if (indbuf ==0) 
 				  buffer.pop();
 				else  
-				  buffer2.pop();
-				if (c->heap_present==0) delete c; // deletes the cell if it is no more present in a heap.
+				  buffer.pop2();
+				delete c; // the cell is removed from the 2 heaps
 				
 				handle_cell(*new_cells.first, init_box);
 				handle_cell(*new_cells.second, init_box);
@@ -497,7 +497,6 @@ void Optimizer::optimize(const IntervalVector& init_box, double obj_init_bound)
 					double ymax= compute_ymax();
 
 					buffer.contract_heap(ymax);
-					if (critpr > 0) buffer2.contract_heap(ymax);
 
 					if (ymax <=NEG_INFINITY) {
 					  if (trace) cout << " infinite value for the minimum " << endl;
@@ -514,17 +513,21 @@ void Optimizer::optimize(const IntervalVector& init_box, double obj_init_bound)
 				if (indbuf ==0)
 				  buffer.pop();
 				else  
-				  buffer2.pop();
-				if (c->heap_present==0) delete c;
+				  buffer.pop2();
+				delete c;
 
 
 			}
 		}
 	}
 	catch (TimeOutException& ) {
+		ctc.set_cell(NULL);
 		return;
 	}
 
+	// the cells have been deleted
+	ctc.set_cell(NULL);
+
 	Timer::stop();
 	time+= Timer::VIRTUAL_TIMELAPSE();
 }
@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : May 14, 2012
-// Last Update : May 14, 2012
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #ifndef __IBEX_OPTIMIZER_H__
@@ -16,7 +16,7 @@
 #include "ibex_Ctc3BCid.h"
 #include "ibex_CtcUnion.h"
 #include "ibex_Backtrackable.h"
-#include "ibex_CellHeapOptim.h"
+#include "ibex_CellDoubleHeap.h"
 #include "ibex_NormalizedSystem.h"
 #include "ibex_ExtendedSystem.h"
 #include "ibex_EntailedCtr.h"
@@ -55,7 +55,7 @@ public:
 	 *   \param equ_eps       - thickness of equations when relaxed to inequalities
 	 *   \param rigor         - look for points that strictly satisfy equalities. By default: false
 	 *   \param critpr        - probability to choose the second criterion in node selection; integer in [0,100]. By default 50
-	 *  \param crit           - second criterion in node selection (the first criterion is the minimum of the objective estimate). default value CellHeapOPtim::UB
+	 *  \param crit           - second criterion in node selection (the first criterion is the minimum of the objective estimate). default value CellDoubleHeap::UB
 	 *
 	 * <ul> The extended system (see ExtendedSystem constructor) contains:
 	 * <li> (n+1) variables, x_1,...x_n,y. The index of y is #goal_var (==n).
@@ -70,7 +70,7 @@ public:
 
 	Optimizer(System& sys, Ctc& ctc, Bsc& bsc, double prec=default_prec,
 			double goal_rel_prec=default_goal_rel_prec, double goal_abs_prec=default_goal_abs_prec,
-			  int sample_size=default_sample_size, double equ_eps=default_equ_eps, bool rigor=false, int critpr=50,CellHeapOptim::criterion crit= CellHeapOptim::UB);
+			  int sample_size=default_sample_size, double equ_eps=default_equ_eps, bool rigor=false, int critpr=50,CellDoubleHeap::criterion crit= CellDoubleHeap::UB);
 	/**
 	 * \brief Delete *this.
 	 */
@@ -169,13 +169,15 @@ public:
 	/** Bisector. */
 	Bsc& bsc;
 
-	/** Cell buffers.
-	Two buffers are used for node selection. the first one corresponds to minimize  the minimum of the objective estimate,
+	/** Cell buffer.
+	Two criteria are used for node selection. the first one corresponds to minimize  the minimum of the objective estimate,
 	the second one to minimize another criterion (by default the maximum of the objective estimate).
 	The second one is chosen at each node with a probability critpr/100 (default value critpr=50)
+	To bound the memory, set buffer.dive_threshold (see #ibex::CellDoubleHeap).
+	Since Oct 2026, there is no more "buffer2": each cell is stored once, in this buffer,
+	and the cells are selected with the second criterion by buffer.top2() and buffer.pop2().
 	 */
-	CellHeapOptim buffer;
-	CellHeapOptim buffer2;
+	CellDoubleHeap buffer;
 
 	/**
 	 * \brief Index of the goal variable y in the extended box.
@@ -212,7 +214,7 @@ public:
 	/** Probability to choose the second criterion in node selection in percentage
 	 * integer in [0,100] default value 50
 	 * the value 0 corresponds to use a single criterion for node selection (the classical one : minimizing the lower bound of the estimate of the objective) 
-	 * the value 100 corresponds to use a single criterion for node selection (the second one used in buffer2) */
+	 * the value 100 corresponds to use a single criterion for node selection (the second one of the buffer) */
 	 int critpr;
 	
 	/**
@@ -283,9 +285,11 @@ protected:
 	 * \brief Return an upper bound of f(x).
 	 *
 	 * Return +oo if x is outside the definition domain of f.
+	 *
+	 * \note Overwrites the box returned by #point_box.
 	 */
-	inline double goal(const Vector& x) const {
-		Interval fx=sys.goal->eval(x);
+	inline double goal(const Vector& x) {
+		Interval fx=sys.goal->eval(point_box(x));
 		if (fx.is_empty())  // means: outside of the definition domain of the function
 			return POS_INFINITY;
 		else
@@ -293,6 +297,19 @@ protected:
 		
 	}
 
+	/**
+	 * \brief Load a point into the degenerated box of the workspace.
+	 *
+	 * Allows to evaluate functions at a point without
+	 * building a temporary IntervalVector. The returned box
+	 * is only valid until the next call (this function and #goal
+	 * overwrite it).
+	 */
+	inline const IntervalVector& point_box(const Vector& x) {
+		for (int i=0; i<n; i++) ws.pt_box[i]=x[i];
+		return ws.pt_box;
+	}
+
 	/**
 	 * \brief Main procedure for processing a box.
 	 *
@@ -547,6 +564,68 @@ private:
 	int nb_inhc4;
 	double diam_inhc4;
 
+	/**
+	 * \brief Workspace of the optimizer.
+	 *
+	 * Buffers allocated once for all in the constructor, so that processing
+	 * a node does not allocate memory (n=number of variables, m=number of constraints).
+	 *
+	 * Unless stated otherwise, a buffer is only valid inside the function that fills it,
+	 * and the functions this one calls with the buffer as argument. No value is carried
+	 * from a node to the next one. Because of this workspace, an optimizer cannot
+	 * process two nodes at the same time (it is not reentrant).
+	 */
+	struct Workspace {
+		Workspace(int n, int m);
+		~Workspace();
+
+		/** Degenerated box of a point (see #point_box). Size n.
+		 * Valid until the next call to #point_box (or #goal). */
+		IntervalVector pt_box;
+
+		/** Current box without the goal variable. Size n.
+		 * Valid during the whole call to #contract_and_bound (in particular,
+		 * during the update of the loup, which receives it as argument). */
+		IntervalVector tmp_box;
+
+		/** Inner box (see #update_loup_probing). Size n. */
+		IntervalVector inbox;
+
+		/** Gradient (or partial derivatives) of a function. Size n.
+		 * Overwritten by #monotonicity_analysis, #line_probing and #update_loup_simplex. */
+		IntervalVector G;
+
+		/** Right-hand side of the gradient=0 contraction (unconstrained case). Size n.
+		 * Constant (never modified after the construction). */
+		const IntervalVector zero;
+
+		/** Candidate point. Size n.
+		 * Filled by #random_probing, #line_probing and #update_loup_simplex,
+		 * and then passed to #check_candidate or #dichotomic_line_search. */
+		Vector pt;
+
+		/** Current point and direction of #dichotomic_line_search. Size n. */
+		Vector pt2;
+		Vector seg;
+
+		/** Distance to the facet of the box (see #line_probing). Size n. */
+		Vector dist;
+
+		/** Corner of the box used for the linearization (see #update_loup_simplex). Size n. */
+		bool* corner;
+		IntervalVector x_corner;
+
+		/** Constraints evaluated at the corner (see #update_loup_simplex). Size m. */
+		IntervalVector g_corner;
+
+		/** Row, variable bounds and primal solution of the LP (see #update_loup_simplex). Size n+1. */
+		Vector row;
+		IntervalVector bound;
+		Vector prim;
+
+	private:
+		Workspace(const Workspace&); // forbidden
+	} ws;
 
 };
 
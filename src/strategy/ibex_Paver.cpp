@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : May 12, 2012
-// Last Update : May 12, 2012
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_Paver.h"
@@ -16,13 +16,35 @@ using namespace std;
 
 namespace ibex {
 
+namespace {
+
+/*
+ * The leaf of the paving corresponding to a cell.
+ */
+class PavingLeaf : public Backtrackable {
+public:
+	PavingLeaf() : leaf(NULL) { }
+
+	std::pair<Backtrackable*,Backtrackable*> down() {
+		return std::pair<Backtrackable*,Backtrackable*>(new PavingLeaf(),new PavingLeaf());
+	}
+
+	size_t memory() const {
+		return sizeof(PavingLeaf);
+	}
+
+	Paving::Node* leaf;
+};
+
+}
+
 Paver::Paver(const Array<Ctc>& c, Bsc& b, CellBuffer& buffer) :
-		capacity(-1), ctc_loop(true), ctc(c), bsc(b), buffer(buffer) {
+		paving(NULL), capacity(-1), timeout(-1), ctc_loop(true), trace(false), ctc(c), bsc(b), buffer(buffer) {
 
 	assert(ctc.size()>0);
 }
 
-void Paver::contract(Cell& cell, SubPaving* paving) {
+void Paver::contract(Cell& cell) {
 	int i=0; // contractor number
 
 	int n=ctc.size(); // number of contractors
@@ -36,6 +58,11 @@ void Paver::contract(Cell& cell, SubPaving* paving) {
 	// used to compare boxes before and after contraction
 	IntervalVector tmpbox(cell.box.size());
 
+	Paving::Node*& leaf=cell.get<PavingLeaf>().leaf;
+
+	// parts of the box removed by the contractors
+	vector<IntervalVector> removed;
+
 	try {
 		while (fix_count<n && i<ctc.size()) {
 
@@ -50,10 +77,19 @@ void Paver::contract(Cell& cell, SubPaving* paving) {
 
 			ctc[i].contract(cell.box);
 
-			if (tmpbox.rel_distance(cell.box)>0) {
-				fix_count=0;
+			// note: must be computed before the paving is updated
+			// (Paving::contract sets tmpbox to the contracted box)
+			bool contracted=tmpbox.rel_distance(cell.box)>0;
 
-				paving[i].add(tmpbox,cell.box);
+			if (cell.box!=tmpbox) {
+				removed.clear();
+				leaf=paving->contract(leaf,tmpbox,cell.box,i,&removed);
+				for (vector<IntervalVector>::const_iterator it=removed.begin(); it!=removed.end(); it++)
+					pending.push_back(pair<int,IntervalVector>(i,*it));
+			}
+
+			if (contracted) {
+				fix_count=0;
 
 				if (trace) cout << " -> contracts" << endl;
 
@@ -69,7 +105,11 @@ void Paver::contract(Cell& cell, SubPaving* paving) {
 		assert(cell.box.is_empty());
 		if (trace) cout << " -> empty set" << endl;
 
-		paving[i].add(tmpbox);
+		removed.clear();
+		paving->contract(leaf,tmpbox,cell.box,i,&removed);
+		leaf=NULL;
+		for (vector<IntervalVector>::const_iterator it=removed.begin(); it!=removed.end(); it++)
+			pending.push_back(pair<int,IntervalVector>(i,*it));
 	}
 
 }
@@ -79,6 +119,15 @@ void Paver::bisect(Cell& c) {
 	pair<IntervalVector,IntervalVector> boxes=bsc.bisect(c);
 	pair<Cell*,Cell*> new_cells=c.bisect(boxes.first,boxes.second);
 
+	// the bisected variable
+	int var=0;
+	while (var<c.box.size() && boxes.first[var].ub()==c.box[var].ub()) var++;
+	assert(var<c.box.size());
+
+	pair<Paving::Node*,Paving::Node*> leaves=paving->bisect(c.get<PavingLeaf>().leaf, var, boxes.first[var].ub());
+	new_cells.first->get<PavingLeaf>().leaf=leaves.first;
+	new_cells.second->get<PavingLeaf>().leaf=leaves.second;
+
 	delete buffer.pop();
 	buffer.push(new_cells.first);
 	buffer.push(new_cells.second);
@@ -86,11 +135,49 @@ void Paver::bisect(Cell& c) {
 
 SubPaving* Paver::pave(const IntervalVector& init_box) {
 
-	SubPaving* paving=new SubPaving[ctc.size()];
+	Paving p(init_box);
+	pave(p);
+
+	SubPaving* res=new SubPaving[ctc.size()];
+
+	vector<IntervalVector> boxes;
+	for (int i=0; i<ctc.size(); i++) {
+		boxes.clear();
+		p.boxes(i,boxes);
+		for (vector<IntervalVector>::const_iterator it=boxes.begin(); it!=boxes.end(); it++)
+			res[i].add(*it);
+	}
+
+	return res;
+}
+
+void Paver::pave(Paving& p) {
+
+	paving=&p;
 
 	buffer.flush();
+	pending.clear();
+
+	vector<IntervalVector> boxes;
+	vector<Paving::Node*> leaves;
+	p.boxes(Paving::UNKNOWN, boxes, &leaves);
+	for (unsigned int k=0; k<leaves.size(); k++)
+		push(boxes[k], leaves[k]);
 
-	Cell* root=new Cell(init_box);
+	Timer::start();
+
+	int i;
+	IntervalVector box(p.box().size());
+
+	while (next(i,box)) { }
+
+	p.simplify();
+
+	paving=NULL;
+}
+
+void Paver::push(const IntervalVector& box, Paving::Node* leaf) {
+	Cell* root=new Cell(box);
 
 	// add data required by the contractors
 //	for (int i=0; i<ctc.size(); i++) {
@@ -99,33 +186,73 @@ SubPaving* Paver::pave(const IntervalVector& init_box) {
 	// add data required by the bisector
 	bsc.add_backtrackable(*root);
 
+	// add data required by this paver
+	root->add<PavingLeaf>();
+	root->get<PavingLeaf>().leaf=leaf;
+
 	buffer.push(root);
+}
+
+void Paver::start(const IntervalVector& init_box) {
+
+	paving=new Paving(init_box);
+
+	buffer.flush();
+	pending.clear();
 
-	while (!buffer.empty()) {
+	push(init_box, paving->root());
+
+	Timer::start();
+}
+
+bool Paver::next(int& i, IntervalVector& box) {
+
+	while (pending.empty() && !buffer.empty()) {
 		Cell* c=buffer.top();
 
 		if (trace) cout << buffer << endl;
 
-		contract(*c, paving);
+		contract(*c);
 
-		Timer::check(timeout);
-		check_capacity(paving);
+		if (timeout>0) Timer::check(timeout);
+		check_capacity();
 
 		if (c->box.is_empty()) delete buffer.pop();
 		else bisect(*c);
 	}
 
-	return paving;
+	if (pending.empty()) return false;
+
+	i=pending.front().first;
+	box=pending.front().second;
+	pending.pop_front();
+	return true;
 }
 
+void Paver::refine(int i) {
+	assert(paving);
+	assert(i>=0 && i<ctc.size());
 
-void Paver::check_capacity(SubPaving* paving) {
-	if (capacity==-1) return;
+	vector<IntervalVector> boxes;
+	vector<Paving::Node*> leaves;
+	paving->boxes(i, boxes, &leaves);
 
-	int size=0;
-	for (int i=0; i<ctc.size(); i++) size+=paving[i].size();
+	for (unsigned int k=0; k<leaves.size(); k++) {
+		leaves[k]->var=Paving::UNKNOWN;
+		push(boxes[k], leaves[k]);
+	}
+
+	// the boxes of the i^th contractor not returned yet are obsolete
+	for (deque<pair<int,IntervalVector> >::iterator it=pending.begin(); it!=pending.end(); ) {
+		if (it->first==i) it=pending.erase(it);
+		else it++;
+	}
+}
+
+void Paver::check_capacity() {
+	if (capacity==-1) return;
 
-	if (size>capacity) throw CapacityException();
+	if (paving->size()>capacity) throw CapacityException();
 }
 
 } // end namespace ibex
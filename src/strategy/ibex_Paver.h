@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : May 12, 2012
-// Last Update : May 12, 2012
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #ifndef __IBEX_PAVER_H__
@@ -15,8 +15,11 @@
 #include "ibex_Ctc.h"
 #include "ibex_Bsc.h"
 #include "ibex_CellBuffer.h"
+#include "ibex_Paving.h"
 #include "ibex_SubPaving.h"
 
+#include <deque>
+
 namespace ibex {
 
 class CapacityException : public Exception { };
@@ -29,6 +32,13 @@ class CapacityException : public Exception { };
  * of boxes (or, more exactly, cells) gets empty.
  * See the description of this algorithm in <a href="www.references.html#cha09">[cha09]</a>
  *
+ * The paving is a k-d tree over the initial box where each leaf is tagged with
+ * the number of the contractor that has removed it (see #ibex::Paving).
+ *
+ * The paving can also be calculated incrementally (see #start(const IntervalVector&)
+ * and #next(int&, IntervalVector&)) and refined: the parts of the
+ * paving obtained with one contractor (typically, the boundary) can be paved again,
+ * e.g., with a finer precision, while the rest of the paving is kept (see #refine(int)).
  */
 class Paver {
 public:
@@ -48,9 +58,66 @@ public:
 	 * \brief Run the paver.
 	 *
 	 * The paving returned is an array that must be disallocated by the caller.
+	 *
+	 * The i^th subpaving contains the boxes removed by the i^th contractor,
+	 * stored as traces (box,empty set). They are the leaves of the
+	 * paving calculated by #pave(Paving&), tagged with i.
 	 */
 	SubPaving* pave(const IntervalVector& init_box);
 
+	/**
+	 * \brief Run the paver on a paving.
+	 *
+	 * All the #ibex::Paving::UNKNOWN leaves of \a paving are paved and
+	 * tagged with the number of the contractor that removes them
+	 * (see #ibex::Paving::tag and #ibex::Paving::boxes).
+	 * Typically, \a paving is a new paving of the initial box, i.e.,
+	 * a single unknown leaf.
+	 */
+	void pave(Paving& paving);
+
+	/**
+	 * \brief Start paving (interactive mode).
+	 *
+	 * A new paving is created (see #paving). It must be disallocated by the caller.
+	 */
+	void start(const IntervalVector& init_box);
+
+	/**
+	 * \brief Continue paving (interactive mode).
+	 *
+	 * Look for the next box removed by a contractor (i.e., the next
+	 * leaf classified in the paving).
+	 *
+	 * \param i      - the number of the contractor.
+	 * \param box    - the box.
+	 * \return false if the paving is over (in this case, the arguments
+	 *                 are not set).
+	 */
+	bool next(int& i, IntervalVector& box);
+
+	/**
+	 * \brief Refine the paving (interactive mode).
+	 *
+	 * All the leaves of the paving tagged with the i^th contractor are
+	 * pushed again in the buffer. They will be paved again by the subsequent
+	 * calls to #next(int&, IntervalVector&).
+	 *
+	 * Typically, the i^th contractor removes boxes smaller than some
+	 * precision (the "boundary") and the precision of this contractor
+	 * (and of the bisector) is decreased before calling this function.
+	 *
+	 * \pre #start(const IntervalVector&) has been called.
+	 */
+	void refine(int i);
+
+	/**
+	 * \brief The current paving.
+	 *
+	 * NULL if the paving has not been started yet.
+	 */
+	Paving* paving;
+
 	/*----------------------------------------------------------------------------------*/
 	/*                                        PARAMETERS                                */
 	/*----------------------------------------------------------------------------------*/
@@ -70,7 +137,7 @@ public:
 	 *
 	 * Maximum cpu time used by the strategy.
 	 * This parameter allows to bound time complexity.
-	 * The value can be fixed by the user.
+	 * The value can be fixed by the user. By default, it is -1 (no limit).
 	 */
 	double timeout;
 
@@ -105,23 +172,32 @@ protected:
 	/**
 	 * \brief Calls all the contractors until the fix-point is reached.
 	 *
-	 * Contracted parts are put into the paving in argument.
-	 *
-	 * \return the contractor number that entirely emptied the box, if any.
-	 * Otherwise, return -1 (the box is non empty and the fixpoint is reached).
+	 * Contracted parts are put into the paving.
 	 */
-	void contract(Cell& c, SubPaving*);
+	void contract(Cell& c);
 
 	/**
 	 * \brief Check the number of boxes stored in the paving.
 	 */
-	void check_capacity(SubPaving*);
+	void check_capacity();
 
 	/**
 	 * \brief Bisect the cell and push the two subcells into the buffer.
 	 */
 	void bisect(Cell& c);
 
+	/**
+	 * \brief Push a new root cell into the buffer.
+	 *
+	 * \param leaf - the leaf of the paving corresponding to the box.
+	 */
+	void push(const IntervalVector& box, Paving::Node* leaf);
+
+	/**
+	 * \brief Boxes not yet returned by #next(int&, IntervalVector&),
+	 * with their contractor number.
+	 */
+	std::deque<std::pair<int,IntervalVector> > pending;
 };
 
 
@@ -0,0 +1,351 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_Paving.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include <stdio.h>
+#include <string.h>
+
+#include "ibex_Paving.h"
+#include "ibex_UnknownFileException.h"
+
+using namespace std;
+
+namespace ibex {
+
+const int Paving::UNKNOWN=-1;
+
+namespace {
+
+typedef Paving::Node Node;
+
+const char MAGIC[8]="IBEXPAV";
+const int VERSION=1;
+
+Node* copy(const Node* n) {
+	if (n->is_leaf()) return new Node(n->var);
+	else return new Node(n->var, n->pt, copy(n->left), copy(n->right));
+}
+
+int count(const Node* n) {
+	if (n->is_leaf()) return 1;
+	else return count(n->left)+count(n->right);
+}
+
+/*
+ * Traverse the leaves tagged with "tag". The box is
+ * rebuilt on the fly (and restored on return).
+ */
+void visit(Node* n, IntervalVector& box, int tag, double& vol, vector<IntervalVector>* list, vector<Node*>* leaves) {
+	if (n->is_leaf()) {
+		if (n->var==tag) {
+			vol+=box.volume();
+			if (list) list->push_back(box);
+			if (leaves) leaves->push_back(n);
+		}
+	} else {
+		Interval save=box[n->var];
+		box[n->var]=Interval(save.lb(),n->pt);
+		visit(n->left, box, tag, vol, list, leaves);
+		box[n->var]=Interval(n->pt,save.ub());
+		visit(n->right, box, tag, vol, list, leaves);
+		box[n->var]=save;
+	}
+}
+
+/*
+ * Cut the subtree n by the plane x[var]=pt.
+ * The nodes of n are either reused or deleted.
+ */
+pair<Node*,Node*> split(Node* n, int var, double pt) {
+	if (n->is_leaf())
+		return pair<Node*,Node*>(n, new Node(n->var));
+
+	if (n->var==var) {
+		if (pt==n->pt) {
+			pair<Node*,Node*> p(n->left,n->right);
+			n->left=n->right=NULL;
+			delete n;
+			return p;
+		} else if (pt<n->pt) {
+			pair<Node*,Node*> p=split(n->left,var,pt);
+			n->left=p.second;
+			return pair<Node*,Node*>(p.first,n);
+		} else {
+			pair<Node*,Node*> p=split(n->right,var,pt);
+			n->right=p.first;
+			return pair<Node*,Node*>(n,p.second);
+		}
+	} else {
+		pair<Node*,Node*> l=split(n->left,var,pt);
+		pair<Node*,Node*> r=split(n->right,var,pt);
+		n->left=l.first;
+		n->right=r.first;
+		return pair<Node*,Node*>(n, new Node(n->var,n->pt,l.second,r.second));
+	}
+}
+
+void retag(Node* n, int t2, const Paving::Op& op) {
+	if (n->is_leaf()) n->var=op(n->var,t2);
+	else {
+		retag(n->left,t2,op);
+		retag(n->right,t2,op);
+	}
+}
+
+Node* copy_retag(int t1, const Node* m, const Paving::Op& op) {
+	if (m->is_leaf()) return new Node(op(t1,m->var));
+	else return new Node(m->var, m->pt, copy_retag(t1,m->left,op), copy_retag(t1,m->right,op));
+}
+
+/*
+ * Combine the subtree n with the subtree m
+ * (both covering the same box).
+ */
+Node* graft(Node* n, const Node* m, const Paving::Op& op) {
+	if (m->is_leaf()) {
+		retag(n,m->var,op);
+		return n;
+	} else if (n->is_leaf()) {
+		Node* res=copy_retag(n->var,m,op);
+		delete n;
+		return res;
+	} else {
+		pair<Node*,Node*> p=split(n,m->var,m->pt);
+		return new Node(m->var, m->pt, graft(p.first,m->left,op), graft(p.second,m->right,op));
+	}
+}
+
+void merge_leaves(Node* n) {
+	if (n->is_leaf()) return;
+	merge_leaves(n->left);
+	merge_leaves(n->right);
+	if (n->left->is_leaf() && n->right->is_leaf() && n->left->var==n->right->var) {
+		int tag=n->left->var;
+		delete n->left;
+		delete n->right;
+		n->left=n->right=NULL;
+		n->var=tag;
+		n->pt=0;
+	}
+}
+
+class UnionOp : public Paving::Op {
+public:
+	UnionOp(int tag) : tag(tag) { }
+	int operator()(int t1, int t2) const { return t2==tag? tag : t1; }
+	int tag;
+};
+
+class InterOp : public Paving::Op {
+public:
+	InterOp(int tag, int other) : tag(tag), other(other) { }
+	int operator()(int t1, int t2) const { return t1==tag && t2!=tag? other : t1; }
+	int tag;
+	int other;
+};
+
+void write_node(FILE* fd, const Node* n) {
+	if (n->is_leaf()) {
+		int leaf=-1;
+		fwrite(&leaf, sizeof(int), 1, fd);
+		fwrite(&n->var, sizeof(int), 1, fd);
+	} else {
+		fwrite(&n->var, sizeof(int), 1, fd);
+		fwrite(&n->pt, sizeof(double), 1, fd);
+		write_node(fd, n->left);
+		write_node(fd, n->right);
+	}
+}
+
+template<class T>
+void read(FILE* fd, T& x) {
+	if (fread(&x, sizeof(T), 1, fd)!=1) throw Paving::InvalidFile();
+}
+
+Node* read_node(FILE* fd, int n) {
+	int var;
+	read(fd,var);
+	if (var==-1) {
+		int tag;
+		read(fd,tag);
+		return new Node(tag);
+	} else {
+		if (var<0 || var>=n) throw Paving::InvalidFile();
+		double pt;
+		read(fd,pt);
+		Node* left=read_node(fd,n);
+		Node* right;
+		try {
+			right=read_node(fd,n);
+		} catch(Paving::InvalidFile& e) {
+			delete left;
+			throw e;
+		}
+		return new Node(var,pt,left,right);
+	}
+}
+
+} // end anonymous namespace
+
+Paving::Paving(const IntervalVector& box) : _box(box), _root(new Node(UNKNOWN)), nb_leaves(1) {
+
+}
+
+Paving::Paving(const Paving& p) : _box(p._box), _root(copy(p._root)), nb_leaves(p.nb_leaves) {
+
+}
+
+Paving::Paving(const char* filename) : _box(1), _root(NULL), nb_leaves(0) {
+	FILE* fd=fopen(filename, "rb");
+	if (fd==NULL) throw UnknownFileException(filename);
+
+	try {
+		char magic[8];
+		int version, n;
+		if (fread(magic, 1, 8, fd)!=8 || memcmp(magic,MAGIC,8)!=0) throw InvalidFile();
+		read(fd,version);
+		if (version!=VERSION) throw InvalidFile();
+		read(fd,n);
+		if (n<=0) throw InvalidFile();
+		_box.resize(n);
+		for (int i=0; i<n; i++) {
+			double lb,ub;
+			read(fd,lb);
+			read(fd,ub);
+			_box[i]=Interval(lb,ub);
+		}
+		_root=read_node(fd,n);
+	} catch(InvalidFile& e) {
+		fclose(fd);
+		throw e;
+	}
+	fclose(fd);
+	nb_leaves=count(_root);
+}
+
+Paving::~Paving() {
+	delete _root;
+}
+
+pair<Paving::Node*,Paving::Node*> Paving::bisect(Node* leaf, int var, double pt) {
+	assert(leaf->is_leaf());
+	assert(var>=0 && var<_box.size());
+
+	int tag=leaf->var;
+	leaf->var=var;
+	leaf->pt=pt;
+	leaf->left=new Node(tag);
+	leaf->right=new Node(tag);
+	nb_leaves++;
+	return pair<Node*,Node*>(leaf->left,leaf->right);
+}
+
+Paving::Node* Paving::contract(Node* leaf, IntervalVector& box, const IntervalVector& after, int tag, vector<IntervalVector>* removed) {
+	assert(leaf->is_leaf());
+
+	if (after.is_empty()) {
+		leaf->var=tag;
+		if (removed) removed->push_back(box);
+		box.set_empty();
+		return NULL;
+	}
+
+	assert(after.is_subset(box));
+
+	for (int i=0; i<box.size(); i++) {
+		if (after[i].lb()>box[i].lb()) {
+			pair<Node*,Node*> p=bisect(leaf, i, after[i].lb());
+			p.first->var=tag;
+			if (removed) {
+				Interval save=box[i];
+				box[i]=Interval(save.lb(),after[i].lb());
+				removed->push_back(box);
+				box[i]=save;
+			}
+			box[i]=Interval(after[i].lb(),box[i].ub());
+			leaf=p.second;
+		}
+		if (after[i].ub()<box[i].ub()) {
+			pair<Node*,Node*> p=bisect(leaf, i, after[i].ub());
+			p.second->var=tag;
+			if (removed) {
+				Interval save=box[i];
+				box[i]=Interval(after[i].ub(),save.ub());
+				removed->push_back(box);
+				box[i]=save;
+			}
+			box[i]=Interval(box[i].lb(),after[i].ub());
+			leaf=p.first;
+		}
+	}
+	return leaf;
+}
+
+int Paving::tag(const Vector& pt) const {
+	if (!_box.contains(pt)) return UNKNOWN;
+
+	const Node* n=_root;
+	while (!n->is_leaf())
+		n = pt[n->var]<=n->pt ? n->left : n->right;
+	return n->var;
+}
+
+double Paving::volume(int tag) const {
+	IntervalVector box(_box);
+	double vol=0;
+	visit(_root, box, tag, vol, NULL, NULL);
+	return vol;
+}
+
+void Paving::boxes(int tag, vector<IntervalVector>& list, vector<Node*>* leaves) const {
+	IntervalVector box(_box);
+	double vol=0;
+	visit(_root, box, tag, vol, &list, leaves);
+}
+
+void Paving::combine(const Paving& p, const Op& op) {
+	assert(p._box==_box);
+	_root=graft(_root, p._root, op);
+	nb_leaves=count(_root);
+}
+
+void Paving::unite(const Paving& p, int tag) {
+	combine(p, UnionOp(tag));
+	simplify();
+}
+
+void Paving::intersect(const Paving& p, int tag, int other) {
+	combine(p, InterOp(tag,other));
+	simplify();
+}
+
+void Paving::simplify() {
+	merge_leaves(_root);
+	nb_leaves=count(_root);
+}
+
+void Paving::save(const char* filename) const {
+	FILE* fd=fopen(filename, "wb");
+	if (fd==NULL) throw UnknownFileException(filename);
+
+	fwrite(MAGIC, 1, 8, fd);
+	fwrite(&VERSION, sizeof(int), 1, fd);
+	int n=_box.size();
+	fwrite(&n, sizeof(int), 1, fd);
+	for (int i=0; i<n; i++) {
+		double lb=_box[i].lb();
+		double ub=_box[i].ub();
+		fwrite(&lb, sizeof(double), 1, fd);
+		fwrite(&ub, sizeof(double), 1, fd);
+	}
+	write_node(fd, _root);
+	fclose(fd);
+}
+
+} // end namespace ibex
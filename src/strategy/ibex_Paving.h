@@ -0,0 +1,255 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_Paving.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_PAVING_H__
+#define __IBEX_PAVING_H__
+
+#include <utility>
+#include <vector>
+
+#include "ibex_IntervalVector.h"
+#include "ibex_Exception.h"
+
+namespace ibex {
+
+/** \ingroup strategy
+ *
+ * \brief Paving (tagged k-d tree)
+ *
+ * A paving is a binary tree (k-d tree) that partitions an
+ * initial box. Each internal node only stores a split variable and a
+ * split point, and each leaf a tag (an integer, e.g., the number of the
+ * contractor that has removed the leaf in a paver, or any user-defined
+ * classification like inside/outside/boundary).
+ * The boxes are not stored: they are rebuilt when the tree is traversed.
+ *
+ * A leaf that is not classified yet is tagged with #UNKNOWN.
+ *
+ * <p>
+ * A point on a split plane is considered to belong to the left child.
+ */
+class Paving {
+public:
+
+	/**
+	 * \brief Tag of leaves that are not classified.
+	 */
+	static const int UNKNOWN;
+
+	/**
+	 * \brief Node of the tree.
+	 *
+	 * A node is a leaf iff it has no child.
+	 */
+	class Node {
+	public:
+		/** Create a leaf. */
+		explicit Node(int tag);
+
+		/** Create an internal node. */
+		Node(int var, double pt, Node* left, Node* right);
+
+		/** Delete the subtree. */
+		~Node();
+
+		/** True iff this node is a leaf. */
+		bool is_leaf() const;
+
+		/** Split variable (internal node) or tag (leaf). */
+		int var;
+
+		/** Split point (internal node). */
+		double pt;
+
+		/** Left child: the part of the box where x[var]<=pt. */
+		Node* left;
+
+		/** Right child: the part of the box where x[var]>=pt. */
+		Node* right;
+	};
+
+	/**
+	 * \brief Thrown when a file is not a valid paving.
+	 */
+	class InvalidFile : public Exception { };
+
+	/**
+	 * \brief Create a paving of \a box made of a single #UNKNOWN leaf.
+	 */
+	explicit Paving(const IntervalVector& box);
+
+	/**
+	 * \brief Load a paving from a file (see #save(const char*) const).
+	 *
+	 * \throws UnknownFileException, Paving::InvalidFile.
+	 */
+	explicit Paving(const char* filename);
+
+	/**
+	 * \brief Duplicate a paving.
+	 */
+	Paving(const Paving& p);
+
+	/**
+	 * \brief Delete *this.
+	 */
+	~Paving();
+
+	/**
+	 * \brief The initial box.
+	 */
+	const IntervalVector& box() const;
+
+	/**
+	 * \brief The root of the tree.
+	 */
+	Node* root();
+
+	/**
+	 * \brief Return the size (number of leaves).
+	 */
+	int size() const;
+
+	/**
+	 * \brief Split a leaf.
+	 *
+	 * The leaf becomes an internal node with two new leaves
+	 * that inherit from its tag.
+	 *
+	 * \return the two new leaves.
+	 */
+	std::pair<Node*,Node*> bisect(Node* leaf, int var, double pt);
+
+	/**
+	 * \brief Add the trace of a contraction into *this.
+	 *
+	 * The leaf is split so that the part of \a box outside of \a after
+	 * is covered by new leaves tagged with \a tag.
+	 *
+	 * \param box     - the box of the leaf (before contraction). Set to
+	 *                  \a after on return.
+	 * \param removed - if not NULL, the boxes of the new tagged leaves are
+	 *                  pushed into this vector.
+	 * \return the leaf corresponding to \a after (NULL if
+	 *         \a after is empty: the leaf itself is tagged).
+	 */
+	Node* contract(Node* leaf, IntervalVector& box, const IntervalVector& after, int tag, std::vector<IntervalVector>* removed=NULL);
+
+	/**
+	 * \brief Tag of the leaf containing \a pt (point membership).
+	 *
+	 * Return #UNKNOWN if \a pt is outside of the initial box.
+	 */
+	int tag(const Vector& pt) const;
+
+	/**
+	 * \brief Total volume of the leaves tagged with \a tag.
+	 */
+	double volume(int tag) const;
+
+	/**
+	 * \brief Rebuild the boxes of the leaves tagged with \a tag.
+	 *
+	 * \param leaves - if not NULL, the leaves are pushed into this vector
+	 *                 (in the same order as the boxes).
+	 */
+	void boxes(int tag, std::vector<IntervalVector>& list, std::vector<Node*>* leaves=NULL) const;
+
+	/**
+	 * \brief Union.
+	 *
+	 * Tag with \a tag all the points of *this that are tagged
+	 * with \a tag in \a p.
+	 *
+	 * \pre \a p is a paving of the same initial box.
+	 */
+	void unite(const Paving& p, int tag);
+
+	/**
+	 * \brief Intersection.
+	 *
+	 * Tag with \a other all the points of *this tagged with \a tag
+	 * that are not tagged with \a tag in \a p.
+	 *
+	 * \pre \a p is a paving of the same initial box.
+	 */
+	void intersect(const Paving& p, int tag, int other=UNKNOWN);
+
+	/**
+	 * \brief Merge all the sibling leaves that have the same tag.
+	 *
+	 * \warning The leaves of *this may be deleted.
+	 */
+	void simplify();
+
+	/**
+	 * \brief Save *this in a (binary) file.
+	 *
+	 * \throws UnknownFileException if the file cannot be created.
+	 */
+	void save(const char* filename) const;
+
+	/**
+	 * \brief Operator on tags (see #combine(const Paving&, const Op&)).
+	 */
+	class Op {
+	public:
+		virtual int operator()(int t1, int t2) const=0;
+		virtual ~Op() { }
+	};
+
+	/**
+	 * \brief Combine *this with \a p.
+	 *
+	 * Each leaf of the result is the intersection of a leaf of *this
+	 * and a leaf of \a p, tagged with op(t1,t2) where t1 and t2
+	 * are the tags of these two leaves.
+	 *
+	 * \pre \a p is a paving of the same initial box.
+	 */
+	void combine(const Paving& p, const Op& op);
+
+private:
+	Paving& operator=(const Paving&); // forbidden
+
+	IntervalVector _box;
+	Node* _root;
+	int nb_leaves;
+};
+
+/*============================================ inline implementation ============================================ */
+
+inline Paving::Node::Node(int tag) : var(tag), pt(0), left(NULL), right(NULL) { }
+
+inline Paving::Node::Node(int var, double pt, Node* left, Node* right) : var(var), pt(pt), left(left), right(right) { }
+
+inline Paving::Node::~Node() {
+	delete left;
+	delete right;
+}
+
+inline bool Paving::Node::is_leaf() const {
+	return left==NULL;
+}
+
+inline const IntervalVector& Paving::box() const {
+	return _box;
+}
+
+inline Paving::Node* Paving::root() {
+	return _root;
+}
+
+inline int Paving::size() const {
+	return nb_leaves;
+}
+
+} // end namespace ibex
+#endif // __IBEX_PAVING_H__
@@ -5,11 +5,10 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Nov 27, 2012
-// Last Update : Nov 27, 2012
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_SetImage.h"
-#include "ibex_PdcImageSubset.h"
 #include "ibex_LargestFirst.h"
 #include "ibex_BoolInterval.h"
 
@@ -45,29 +44,65 @@ public:
 
 }
 
-SetImage::SetImage(Function& f, const IntervalVector& x) : f(f), n(f.nb_var()), c_out(*new CtcInter(x)), p_in(*new PdcSubset(x)) {
+SetImage::SetImage(Function& f, const IntervalVector& x) : f(f), n(f.nb_var()), c_out(*new CtcInter(x)), p_in(*new PdcSubset(x)),
+		x0(n), epsilon(-1), p_fin(f,x0,p_in) {
 	assert(f.image_dim()==n);
 }
 
-SetImage::SetImage(Function& f, Ctc& c_out, Pdc& p_in) : f(f), n(f.nb_var()), c_out(c_out), p_in(p_in) {
+SetImage::SetImage(Function& f, Ctc& c_out, Pdc& p_in) : f(f), n(f.nb_var()), c_out(c_out), p_in(p_in),
+		x0(n), epsilon(-1), p_fin(f,x0,p_in) {
 	assert(f.image_dim()==n);
 }
 
 void SetImage::pave(const IntervalVector& x, double epsilon) {
 
+	if (this->epsilon>=0 && x==x0) {
+		// resume from the current boundary
+		if (epsilon<this->epsilon) refine(epsilon);
+	} else
+		start(x,epsilon);
+
+	IntervalVector y(n);
+	BoolInterval status;
+
+	while (next(y,status)) { }
+}
+
+void SetImage::start(const IntervalVector& x, double epsilon) {
+
+	assert(x.size()==n);
+
 	Linside.clear();
 	Lboundary.clear();
+	Xboundary.clear();
 
-	PdcImageSubset p_fin(f,x,p_in);
+	while (!Ldomain.empty()) Ldomain.pop();
 
-	assert(x.size()==n);
+	x0=x;
+	this->epsilon=epsilon;
+
+	Ldomain.push(x);
+}
+
+void SetImage::refine(double epsilon) {
+
+	assert(this->epsilon>=0);
+
+	this->epsilon=epsilon;
+
+	for (vector<IntervalVector>::const_iterator it=Xboundary.begin(); it!=Xboundary.end(); it++)
+		Ldomain.push(*it);
+
+	Lboundary.clear();
+	Xboundary.clear();
+}
+
+bool SetImage::next(IntervalVector& y, BoolInterval& status) {
 
-	stack<IntervalVector> Ldomain;
 	IntervalVector xtilde(n);
 	IntervalVector ytilde(n);
 	LargestFirst lf(epsilon);
 
-	Ldomain.push(x);
 	while (! Ldomain.empty()) {
 		xtilde = Ldomain.top();
 		Ldomain.pop();
@@ -81,16 +116,23 @@ void SetImage::pave(const IntervalVector& x, double epsilon) {
 		ytilde=f.eval_vector(xtilde);
 		// improve with centered form
 		ytilde&=f.eval_vector(xtilde.mid())+f.jacobian(xtilde)*(xtilde-xtilde.mid());
-		if (p_in.test(xtilde)==YES && p_fin.test(cart_prod(xtilde,ytilde))==YES)
+		if (p_in.test(xtilde)==YES && p_fin.test(cart_prod(xtilde,ytilde))==YES) {
 			Linside.push_back(ytilde);
-		else if (xtilde.max_diam()<=epsilon)
+			status=YES;
+		} else if (xtilde.max_diam()<=epsilon) {
 			Lboundary.push_back(ytilde);
-		else  {
+			Xboundary.push_back(xtilde);
+			status=MAYBE;
+		} else  {
 			pair<IntervalVector,IntervalVector> boxes=lf.bisect(xtilde);
 			Ldomain.push(boxes.first);
 			Ldomain.push(boxes.second);
+			continue;
 		}
+		y=ytilde;
+		return true;
 	}
+	return false;
 }
 
 
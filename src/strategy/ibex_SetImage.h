@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Nov 27, 2012
-// Last Update : Nov 27, 2012
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #ifndef __IBEX_SET_IMAGE_H__
@@ -14,7 +14,9 @@
 #include "ibex_Function.h"
 #include "ibex_Ctc.h"
 #include "ibex_Pdc.h"
+#include "ibex_PdcImageSubset.h"
 #include <vector>
+#include <stack>
 
 namespace ibex {
 
@@ -28,6 +30,11 @@ namespace ibex {
  *
  * Note: the bisection procedure is fixed to LargestFirst.
  *
+ * The classification of the boxes is kept from one call to
+ * another: the paving can be refined progressively (e.g.,
+ * a coarse preview, then finer) without losing the inner
+ * boxes already found. See #refine(double).
+ *
  * \param f - A function from R^n to R^n
  * \param x - The box in IR^n
  *
@@ -56,10 +63,57 @@ public:
 	 * #interior()) and one for the boundary (returned by
 	 * #boundary()).
 	 *
+	 * If the previous paving was calculated on the same box x
+	 * with a larger precision, the paving is resumed
+	 * from the boundary boxes (see #refine(double)).
+	 * Otherwise, it is calculated from scratch.
+	 *
 	 * \param epsilon - the precision up to which the x box will be bisected by the algorithm.
 	 */
 	void pave(const IntervalVector& x, double epsilon);
 
+	/**
+	 * \brief Start paving (interactive mode).
+	 *
+	 * Clear the current paving. The boxes are then
+	 * obtained one by one with #next(IntervalVector&, BoolInterval&).
+	 */
+	void start(const IntervalVector& x, double epsilon);
+
+	/**
+	 * \brief Refine the paving (interactive mode).
+	 *
+	 * Only the boundary boxes of the current paving are bisected
+	 * further, down to the new precision \a epsilon. The interior
+	 * is kept. The boundary returned by #boundary() is emptied and
+	 * filled again by the subsequent calls to #next(IntervalVector&, BoolInterval&).
+	 *
+	 * \pre #start(const IntervalVector&, double) has been called.
+	 */
+	void refine(double epsilon);
+
+	/**
+	 * \brief Continue paving (interactive mode).
+	 *
+	 * Look for the next box of the paving, i.e., the
+	 * image of a subbox of x, and store it either into
+	 * #interior() or into #boundary().
+	 *
+	 * \param y      - the new box
+	 * \param status - YES if y is inside the image, MAYBE if
+	 *                 it belongs to the boundary.
+	 * \return false if the paving is over (in this case,
+	 *                 y and status are not set).
+	 */
+	bool next(IntervalVector& y, BoolInterval& status);
+
+	/**
+	 * \brief Current precision.
+	 *
+	 * (-1 if no paving has been started yet).
+	 */
+	double precision() const;
+
 	/**
 	 * Return the set of boxes proven to be inside the
 	 * interior of range(f,x) by the previous call to
@@ -86,8 +140,22 @@ private:
 	Ctc &c_out;
 	Pdc &p_in;
 
+	// the current domain
+	IntervalVector x0;
+	// the current precision
+	double epsilon;
+
+	PdcImageSubset p_fin;
+
+	// boxes of the domain that remain to be processed
+	std::stack<IntervalVector> Ldomain;
+
 	std::vector<IntervalVector> Linside;
 	std::vector<IntervalVector> Lboundary;
+
+	// the subboxes of the domain whose images are
+	// the boxes of Lboundary (for further refinement)
+	std::vector<IntervalVector> Xboundary;
 };
 
 inline const std::vector<IntervalVector>& SetImage::interior() {
@@ -98,5 +166,9 @@ inline const std::vector<IntervalVector>& SetImage::boundary() {
 	return Lboundary;
 }
 
+inline double SetImage::precision() const {
+	return epsilon;
+}
+
 } // end namespace ibex
 #endif // __IBEX_SET_IMAGE_H__
@@ -0,0 +1,425 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_SolutionClusters.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "ibex_SolutionClusters.h"
+#include "ibex_Newton.h"
+#include "ibex_Linear.h"
+#include "ibex_LinearException.h"
+
+#include <algorithm>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// maximal number of entries in a node of the R-tree
+const int MAX_ENTRIES=8;
+
+bool intersects(const IntervalVector& a, const IntervalVector& b) {
+	for (int i=0; i<a.size(); i++)
+		if (a[i].lb()>b[i].ub() || b[i].lb()>a[i].ub()) return false;
+	return true;
+}
+
+// increase of the perimeter of a when merged with b
+// (the perimeter is used instead of the volume
+// because solution boxes are often flat)
+double enlargement(const IntervalVector& a, const IntervalVector& b) {
+	return (a|b).perimeter()-a.perimeter();
+}
+
+// compare the entries of a node by the midpoint of their ith component
+class MidCompare {
+public:
+	MidCompare(const vector<IntervalVector>& boxes, int i) : boxes(boxes), i(i) { }
+
+	bool operator()(int e1, int e2) const {
+		return boxes[e1][i].mid()<boxes[e2][i].mid();
+	}
+
+	const vector<IntervalVector>& boxes;
+	int i;
+};
+
+/*
+ * Krawczyk test: true if f has a unique zero in x.
+ */
+bool unique(const Fnc& f, const IntervalVector& x) {
+	int n=x.size();
+	Vector mid=x.mid();
+	IntervalMatrix J=f.jacobian(x);
+	if (J.is_empty()) return false;
+
+	Matrix C(n,n);
+	try {
+		real_inverse(J.mid(),C);
+	} catch(LinearException&) {
+		return false;
+	}
+
+	IntervalMatrix I=Matrix::eye(n);
+	IntervalVector k=mid-C*f.eval_vector(mid)+(I-C*J)*(x-mid);
+	return k.is_interior_subset(x);
+}
+
+// maximal number of times an exclusion region is doubled
+const int MAX_INFLATE=50;
+
+// number of bisection steps to refine an exclusion region
+const int NB_REFINE=4;
+
+} // end anonymous namespace
+
+/*
+ * A node of the R-tree. The entries of a leaf are clusters,
+ * the entries of other nodes are subnodes.
+ */
+class SolutionClusters::RNode {
+public:
+	RNode(bool leaf) : leaf(leaf), parent(NULL) { }
+
+	~RNode() {
+		for (vector<RNode*>::iterator it=children.begin(); it!=children.end(); it++)
+			delete *it;
+	}
+
+	int size() const {
+		return boxes.size();
+	}
+
+	IntervalVector bounding_box() const {
+		IntervalVector b=boxes[0];
+		for (int i=1; i<size(); i++) b|=boxes[i];
+		return b;
+	}
+
+	// position of a subnode
+	int index(RNode* node) const {
+		int i=0;
+		while (children[i]!=node) i++;
+		return i;
+	}
+
+	bool leaf;
+	RNode* parent;
+	// bounding boxes of the entries
+	vector<IntervalVector> boxes;
+	// entries of a non-leaf node
+	vector<RNode*> children;
+	// entries of a leaf
+	vector<Cluster*> clusters;
+};
+
+class SolutionClusters::RTree {
+public:
+	RTree() : root(new RNode(true)) { }
+
+	~RTree() {
+		delete root;
+	}
+
+	void insert(Cluster* c) {
+		IntervalVector key=c->key();
+		RNode* node=root;
+		while (!node->leaf) {
+			int best=0;
+			double e=enlargement(node->boxes[0],key);
+			for (int i=1; i<node->size(); i++) {
+				double e2=enlargement(node->boxes[i],key);
+				if (e2<e) { best=i; e=e2; }
+			}
+			node=node->children[best];
+		}
+		node->boxes.push_back(key);
+		node->clusters.push_back(c);
+		c->leaf=node;
+		if (node->size()>MAX_ENTRIES) split(node);
+		else adjust(node);
+	}
+
+	void remove(Cluster* c) {
+		RNode* node=c->leaf;
+		int i=0;
+		while (node->clusters[i]!=c) i++;
+		node->boxes.erase(node->boxes.begin()+i);
+		node->clusters.erase(node->clusters.begin()+i);
+		c->leaf=NULL;
+
+		// remove the empty nodes
+		while (node!=root && node->size()==0) {
+			RNode* parent=node->parent;
+			int j=parent->index(node);
+			parent->boxes.erase(parent->boxes.begin()+j);
+			parent->children.erase(parent->children.begin()+j);
+			delete node;
+			node=parent;
+		}
+		adjust(node);
+
+		// shorten the tree
+		while (!root->leaf && root->size()==1) {
+			RNode* old=root;
+			root=root->children[0];
+			root->parent=NULL;
+			old->children.clear();
+			delete old;
+		}
+	}
+
+	void query(const IntervalVector& box, vector<Cluster*>& res) const {
+		query(root, box, res);
+	}
+
+	RNode* root;
+
+private:
+	void query(RNode* node, const IntervalVector& box, vector<Cluster*>& res) const {
+		for (int i=0; i<node->size(); i++) {
+			if (intersects(node->boxes[i],box)) {
+				if (node->leaf) res.push_back(node->clusters[i]);
+				else query(node->children[i], box, res);
+			}
+		}
+	}
+
+	// update the bounding boxes from node up to the root
+	void adjust(RNode* node) {
+		while (node->parent) {
+			RNode* parent=node->parent;
+			if (node->size()>0) parent->boxes[parent->index(node)]=node->bounding_box();
+			node=parent;
+		}
+	}
+
+	// split an overflowing node in two halves along the
+	// dimension where the entries are the most spread.
+	void split(RNode* node) {
+		int m=node->size();
+		int n=node->boxes[0].size();
+
+		int var=0;
+		double spread=-1;
+		for (int j=0; j<n; j++) {
+			double lb=POS_INFINITY, ub=NEG_INFINITY;
+			for (int i=0; i<m; i++) {
+				double mid=node->boxes[i][j].mid();
+				if (mid<lb) lb=mid;
+				if (mid>ub) ub=mid;
+			}
+			if (ub-lb>spread) { var=j; spread=ub-lb; }
+		}
+
+		vector<int> order(m);
+		for (int i=0; i<m; i++) order[i]=i;
+		sort(order.begin(), order.end(), MidCompare(node->boxes,var));
+
+		vector<IntervalVector> boxes(node->boxes);
+		vector<RNode*> children(node->children);
+		vector<Cluster*> clusters(node->clusters);
+		node->boxes.clear();
+		node->children.clear();
+		node->clusters.clear();
+
+		RNode* sibling=new RNode(node->leaf);
+
+		for (int i=0; i<m; i++) {
+			RNode* dest= i<m/2 ? node : sibling;
+			int e=order[i];
+			dest->boxes.push_back(boxes[e]);
+			if (node->leaf) {
+				dest->clusters.push_back(clusters[e]);
+				clusters[e]->leaf=dest;
+			} else {
+				dest->children.push_back(children[e]);
+				children[e]->parent=dest;
+			}
+		}
+
+		if (node==root) {
+			root=new RNode(false);
+			root->boxes.push_back(node->bounding_box());
+			root->children.push_back(node);
+			root->boxes.push_back(sibling->bounding_box());
+			root->children.push_back(sibling);
+			node->parent=sibling->parent=root;
+		} else {
+			RNode* parent=node->parent;
+			parent->boxes[parent->index(node)]=node->bounding_box();
+			parent->boxes.push_back(sibling->bounding_box());
+			parent->children.push_back(sibling);
+			sibling->parent=parent;
+			if (parent->size()>MAX_ENTRIES) split(parent);
+			else adjust(parent);
+		}
+	}
+};
+
+SolutionClusters::Cluster::Cluster(const IntervalVector& box) : hull(box), nb_boxes(1), certified(false),
+		region(IntervalVector::empty(box.size())), index(-1), leaf(NULL) {
+
+}
+
+IntervalVector SolutionClusters::Cluster::key() const {
+	return certified ? hull | region : hull;
+}
+
+SolutionClusters::SolutionClusters(int n, double max_diam) : max_diam(max_diam), exclusion(false), n(n), f(NULL), rtree(new RTree()) {
+
+}
+
+SolutionClusters::SolutionClusters(const Fnc& f, double max_diam, bool exclusion) : max_diam(max_diam), exclusion(exclusion),
+		n(f.nb_var()), f(&f), rtree(new RTree()) {
+	assert(f.image_dim()==n);
+}
+
+SolutionClusters::~SolutionClusters() {
+	delete rtree;
+	for (vector<Cluster*>::iterator it=list.begin(); it!=list.end(); it++)
+		delete *it;
+}
+
+const SolutionClusters::Cluster& SolutionClusters::add(const IntervalVector& box) {
+	assert(box.size()==n);
+
+	vector<Cluster*> candidates;
+	rtree->query(box, candidates);
+
+	Cluster* c=NULL;
+
+	for (vector<Cluster*>::iterator it=candidates.begin(); it!=candidates.end(); it++) {
+		Cluster* d=*it;
+
+		if (d->certified && box.is_subset(d->region)) {
+			// the box is absorbed by a certified region
+		} else if (!intersects(d->hull,box) && !(d->certified && intersects(d->region,box)))
+			continue;
+		else if ((d->hull|box).max_diam()>max_diam)
+			continue;
+
+		if (c==NULL) {
+			c=d;
+			rtree->remove(c);
+			c->hull|=box;
+			c->nb_boxes++;
+		} else if (!(c->certified && d->certified) && (c->hull|d->hull).max_diam()<=max_diam) {
+			// the box links two clusters
+			merge(*c,*d);
+		}
+	}
+
+	if (c==NULL) {
+		c=new Cluster(box);
+		c->index=list.size();
+		list.push_back(c);
+	}
+
+	if (f && !c->certified) certify(*c);
+
+	rtree->insert(c);
+
+	return *c;
+}
+
+bool SolutionClusters::covered(const IntervalVector& box) const {
+	vector<Cluster*> candidates;
+	rtree->query(box, candidates);
+
+	for (vector<Cluster*>::iterator it=candidates.begin(); it!=candidates.end(); it++) {
+		if ((*it)->certified && box.is_subset((*it)->region)) return true;
+	}
+	return false;
+}
+
+bool SolutionClusters::trim(IntervalVector& box) const {
+	vector<Cluster*> candidates;
+	rtree->query(box, candidates);
+
+	for (vector<Cluster*>::iterator it=candidates.begin(); it!=candidates.end(); it++) {
+		if (!(*it)->certified) continue;
+
+		const IntervalVector& region=(*it)->region;
+
+		if (box.is_subset(region)) return true;
+
+		IntervalVector* rest;
+		int nb=box.diff(region,rest);
+		if (nb==1 && !rest[0].is_empty()) box=rest[0];
+		delete[] rest;
+	}
+	return false;
+}
+
+void SolutionClusters::certify(Cluster& c) {
+	IntervalVector box=c.hull;
+	if (inflating_newton(*f, box)) {
+		c.certified=true;
+		c.region=box;
+		if (exclusion) inflate(c);
+	}
+}
+
+void SolutionClusters::inflate(Cluster& c) {
+	Vector mid=c.region.mid();
+
+	// radius of the largest box proven to contain a unique zero
+	double r=0;
+	// radius of the smallest box where uniqueness failed
+	double fail=POS_INFINITY;
+
+	// (the Newton region is usually much tighter than the hull)
+	double rk=std::max(c.region.max_diam(),c.hull.max_diam());
+	if (rk==0) rk=1e-12;
+
+	for (int k=0; k<MAX_INFLATE; k++, rk*=2) {
+		if (unique(*f, mid+IntervalVector(n,Interval(-rk,rk))))
+			r=rk;
+		else {
+			fail=rk;
+			break;
+		}
+	}
+
+	if (r==0) return; // keep the region given by Newton
+
+	if (fail<POS_INFINITY) {
+		for (int k=0; k<NB_REFINE; k++) {
+			double rk=(r+fail)/2;
+			if (unique(*f, mid+IntervalVector(n,Interval(-rk,rk)))) r=rk;
+			else fail=rk;
+		}
+	}
+
+	IntervalVector region=mid+IntervalVector(n,Interval(-r,r));
+	// the exclusion region must contain the Newton region
+	c.region=region | c.region;
+}
+
+void SolutionClusters::merge(Cluster& c1, Cluster& c2) {
+	rtree->remove(&c2);
+
+	c1.hull|=c2.hull;
+	c1.nb_boxes+=c2.nb_boxes;
+	if (c2.certified) {
+		c1.certified=true;
+		c1.region=c2.region;
+	}
+
+	// remove c2 from the list
+	Cluster* last=list.back();
+	list[c2.index]=last;
+	last->index=c2.index;
+	list.pop_back();
+
+	delete &c2;
+}
+
+} // end namespace ibex
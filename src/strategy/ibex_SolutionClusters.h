@@ -0,0 +1,185 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_SolutionClusters.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_SOLUTION_CLUSTERS_H__
+#define __IBEX_SOLUTION_CLUSTERS_H__
+
+#include "ibex_IntervalVector.h"
+#include "ibex_Fnc.h"
+
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \ingroup strategy
+ *
+ * \brief Clusters of solutions.
+ *
+ * Near a solution, a solver produces many adjacent small boxes.
+ * This structure merges online adjacent or overlapping solution boxes
+ * into clusters (represented by the hull of their boxes). The clusters
+ * are indexed by an R-tree.
+ *
+ * A cluster is not merged with a box if the diameter of the resulting
+ * hull exceeds some threshold (to avoid merging a whole continuum of
+ * solutions in a single cluster).
+ *
+ * If a (square) function is given, the existence and uniqueness of a solution
+ * in each cluster is checked with #ibex::inflating_newton(). A cluster
+ * is then "certified" and the box proven to contain the solution
+ * (the "region") is used to absorb the subsequent boxes (see also #covered()).
+ *
+ * Optionally, the region of a certified cluster can be inflated to a (nearly)
+ * maximal box where the solution is still proven to be unique. Such
+ * "exclusion regions" allow to discard or trim the boxes around
+ * a solution (see #trim(IntervalVector&) const).
+ */
+class SolutionClusters {
+private:
+	class RNode;
+	class RTree;
+
+public:
+
+	/**
+	 * \brief A cluster.
+	 */
+	class Cluster {
+	public:
+		/** Hull of the boxes. */
+		IntervalVector hull;
+
+		/** Number of boxes. */
+		int nb_boxes;
+
+		/** True if the cluster is certified. */
+		bool certified;
+
+		/** The box proven to contain a unique solution (if certified). */
+		IntervalVector region;
+
+	private:
+		friend class SolutionClusters;
+
+		Cluster(const IntervalVector& box);
+
+		/* The key of the cluster in the R-tree */
+		IntervalVector key() const;
+
+		/* Position in the list of clusters */
+		int index;
+
+		/* The leaf of the R-tree */
+		RNode* leaf;
+	};
+
+	/**
+	 * \brief Create clusters of boxes in IR^n.
+	 *
+	 * \param max_diam - maximal diameter of a cluster.
+	 */
+	SolutionClusters(int n, double max_diam=POS_INFINITY);
+
+	/**
+	 * \brief Create clusters of solutions of f(x)=0.
+	 *
+	 * The clusters are certified with f.
+	 *
+	 * \param exclusion - if true, the region of each certified cluster is
+	 *                    inflated to an exclusion region.
+	 * \pre f must be square (from R^n to R^n).
+	 */
+	SolutionClusters(const Fnc& f, double max_diam=POS_INFINITY, bool exclusion=false);
+
+	/**
+	 * \brief Delete *this.
+	 */
+	~SolutionClusters();
+
+	/**
+	 * \brief Add a solution box.
+	 *
+	 * \return the cluster of the box.
+	 * \warning the indices of the clusters may change.
+	 */
+	const Cluster& add(const IntervalVector& box);
+
+	/**
+	 * \brief True if the box is included in the region
+	 * of a certified cluster.
+	 */
+	bool covered(const IntervalVector& box) const;
+
+	/**
+	 * \brief Remove from a box the regions of certified clusters.
+	 *
+	 * The box is only trimmed when the remaining part is a box.
+	 *
+	 * \return true if the box is included in a region (the box
+	 *         can be discarded).
+	 */
+	bool trim(IntervalVector& box) const;
+
+	/**
+	 * \brief Number of clusters.
+	 */
+	int size() const;
+
+	/**
+	 * \brief The ith cluster.
+	 */
+	const Cluster& operator[](int i) const;
+
+	/**
+	 * \brief Maximal diameter of a cluster.
+	 */
+	const double max_diam;
+
+	/**
+	 * \brief True if the regions are inflated to exclusion regions.
+	 */
+	const bool exclusion;
+
+private:
+	SolutionClusters(const SolutionClusters&); // forbidden
+
+	// try to certify the cluster
+	void certify(Cluster& c);
+
+	// inflate the region of a certified cluster
+	void inflate(Cluster& c);
+
+	// merge c2 into c1 (c2 is deleted)
+	void merge(Cluster& c1, Cluster& c2);
+
+	const int n;
+
+	// the function (NULL if no certification)
+	const Fnc* f;
+
+	std::vector<Cluster*> list;
+
+	RTree* rtree;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline int SolutionClusters::size() const {
+	return list.size();
+}
+
+inline const SolutionClusters::Cluster& SolutionClusters::operator[](int i) const {
+	return *list[i];
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_SOLUTION_CLUSTERS_H__
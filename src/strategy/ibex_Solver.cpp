@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : May 13, 2012
-// Last Update : May 13, 2012
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #include "ibex_Solver.h"
@@ -17,11 +17,31 @@ using namespace std;
 
 namespace ibex {
 
+namespace {
+
+/*
+ * Stores the solutions into a vector
+ * and pauses after each solution.
+ */
+class VectorOutput : public SolverOutput {
+public:
+	VectorOutput(vector<IntervalVector>& sols) : sols(sols) { }
+
+	bool push(const IntervalVector& sol) {
+		sols.push_back(sol);
+		return false;
+	}
+
+	vector<IntervalVector>& sols;
+};
+
+}
+
 Solver::Solver(Ctc& ctc, Bsc& bsc, CellBuffer& buffer) :
-		  ctc(ctc), bsc(bsc), buffer(buffer), time_limit(-1), cell_limit(-1), trace(0), time(0) {
+		  ctc(ctc), bsc(bsc), buffer(buffer), time_limit(-1), cell_limit(-1), trace(0), clusters(NULL), time(0) {
 
 	nb_cells=0;
-
+	nb_sols=0;
 }
 
 void Solver::start(const IntervalVector& init_box) {
@@ -35,6 +55,9 @@ void Solver::start(const IntervalVector& init_box) {
 	// add data required by the bisector
 	bsc.add_backtrackable(*root);
 
+	// add data required by the contractor
+	ctc.add_backtrackable(*root);
+
 	buffer.push(root);
 
 	IntervalVector tmpbox(init_box.size());
@@ -43,11 +66,13 @@ void Solver::start(const IntervalVector& init_box) {
 
 	impact.set_all();
 
+	nb_sols=0;
+
 	Timer::start();
 
 }
 
-bool Solver::next(std::vector<IntervalVector>& sols) {
+bool Solver::next(SolverOutput& out) {
 	try  {
 		while (!buffer.empty()) {
 
@@ -55,13 +80,24 @@ bool Solver::next(std::vector<IntervalVector>& sols) {
 
 			Cell* c=buffer.top();
 
+			if (clusters && clusters->trim(c->box)) {
+				// a solution has already been certified in this box
+				delete buffer.pop();
+				impact.set_all();
+				continue;
+			}
+
 			try {
 				int v=c->get<BisectedVar>().var;      // last bisected var.
 
 				if (v!=-1) impact.set(v);
 
+				ctc.set_cell(c);
+
 				ctc.contract(c->box,impact);
 
+				ctc.set_cell(NULL);
+
 				if (v!=-1) impact.unset(v);
 				try {
 
@@ -75,13 +111,13 @@ bool Solver::next(std::vector<IntervalVector>& sols) {
 					if (cell_limit >=0 && nb_cells>=cell_limit) throw CellLimitException();}
 
 				catch (NoBisectableVariableException&) {
-					new_sol(sols, c->box);
+					new_sol(c->box);
+					bool go_on=out.push(c->box);
 					delete buffer.pop();
 					impact.set_all();
-					return !buffer.empty();
-					// note that we skip time_limit_check() here.
-					// In the case where "next" is called by "solve",
-					// and if time has exceeded, the exception will be raised by the
+					if (!go_on) return true;
+					// note that we skip time_limit_check() when the search is paused.
+					// If time has exceeded, the exception will be raised by the
 					// very next call to "next" anyway. This holds, unless "next" finds
 					// new solutions again and again endlessly. So there is a little risk
 					// of uncaught timeout in this case (but this case is probably already
@@ -91,6 +127,7 @@ bool Solver::next(std::vector<IntervalVector>& sols) {
 
 			} catch(EmptyBoxException&) {
 				assert(c->box.is_empty());
+				ctc.set_cell(NULL);
 				delete buffer.pop();
 				impact.set_all();
 			}
@@ -110,6 +147,16 @@ bool Solver::next(std::vector<IntervalVector>& sols) {
 
 }
 
+bool Solver::next(std::vector<IntervalVector>& sols) {
+	VectorOutput out(sols);
+	return next(out) && !buffer.empty();
+}
+
+bool Solver::solve(const IntervalVector& init_box, SolverOutput& out) {
+	start(init_box);
+	return next(out);
+}
+
 vector<IntervalVector> Solver::solve(const IntervalVector& init_box) {
 	vector<IntervalVector> sols;
 	start(init_box);
@@ -125,11 +172,13 @@ void Solver::time_limit_check () {
 }
 
 
-void Solver::new_sol (vector<IntervalVector> & sols, IntervalVector & box) {
-	sols.push_back(box);
-	cout.precision(12);
-	if (trace >=1)
-		cout << " sol " << sols.size() << " nb_cells " <<  nb_cells << " "  << sols[sols.size()-1] <<   endl;
+void Solver::new_sol (IntervalVector & box) {
+	nb_sols++;
+	if (clusters) clusters->add(box);
+	if (trace >=1) {
+		cout.precision(12);
+		cout << " sol " << nb_sols << " nb_cells " <<  nb_cells << " "  << box <<   endl;
+	}
 }
 
 } // end namespace ibex
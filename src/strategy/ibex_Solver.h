@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : May 13, 2012
-// Last Update : August 21, 2013
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #ifndef __IBEX_SOLVER_H__
@@ -16,6 +16,8 @@
 #include "ibex_Bsc.h"
 #include "ibex_CellBuffer.h"
 #include "ibex_SubPaving.h"
+#include "ibex_SolverOutput.h"
+#include "ibex_SolutionClusters.h"
 #include "ibex_Timer.h"
 #include "ibex_Exception.h"
 
@@ -69,6 +71,29 @@ public:
 	 */
 	bool next(std::vector<IntervalVector>& sols);
 
+	/**
+	 * \brief Solve the system (streaming mode).
+	 *
+	 * Each solution is passed to \a out as soon as it is found
+	 * (nothing is stored by the solver).
+	 *
+	 * \return true if the search has been paused by \a out (call
+	 *         #next(SolverOutput&) to resume), false if the search is over.
+	 */
+	bool solve(const IntervalVector& init_box, SolverOutput& out);
+
+	/**
+	 * \brief Continue solving (streaming mode).
+	 *
+	 * Pass each new solution to \a out until either \a out asks
+	 * to pause or the search is over.
+	 *
+	 * \pre #start(const IntervalVector&) has been called.
+	 * \return true if the search has been paused by \a out, false
+	 *         if the search is over.
+	 */
+	bool next(SolverOutput& out);
+
 	 
 	/**
 	 * \brief  The contractor 
@@ -107,6 +132,16 @@ public:
 	 */
 	int trace;
 
+	/**
+	 * \brief Clusters of solutions (optional).
+	 *
+	 * If not NULL, each solution found is also added to these clusters,
+	 * and the cells are trimmed by the regions of the certified clusters:
+	 * a cell included in such a region is discarded
+	 * (see #ibex::SolutionClusters::trim(IntervalVector&) const). NULL by default.
+	 */
+	SolutionClusters* clusters;
+
 	/** Number of nodes  in the search tree */
 	int nb_cells;
 
@@ -118,7 +153,10 @@ protected :
 
 	void time_limit_check();
 
-	void new_sol(std::vector<IntervalVector> & sols, IntervalVector & box);
+	void new_sol(IntervalVector & box);
+
+	/** Number of solutions found since the last call to #start(const IntervalVector&). */
+	long nb_sols;
 
 	BoolMask impact;
 
@@ -0,0 +1,95 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_SolverOutput.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include <string.h>
+
+#include "ibex_SolverOutput.h"
+#include "ibex_UnknownFileException.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+const char MAGIC[8]="IBEXSOL";
+const int VERSION=1;
+
+}
+
+SolverBinaryOutput::SolverBinaryOutput(const char* filename, int n, int buffer_size) :
+		n(n), buffer_size(buffer_size), buffer(new double[2*n*buffer_size]), size(0), nb(0) {
+
+	assert(n>0 && buffer_size>0);
+
+	fd=fopen(filename, "wb");
+	if (fd==NULL) {
+		delete[] buffer;
+		throw UnknownFileException(filename);
+	}
+
+	if (fwrite(MAGIC, 1, 8, fd)!=8 ||
+		fwrite(&VERSION, sizeof(int), 1, fd)!=1 ||
+		fwrite(&n, sizeof(int), 1, fd)!=1 ||
+		fflush(fd)!=0) {
+		fclose(fd);
+		delete[] buffer;
+		throw WriteFailure();
+	}
+}
+
+SolverBinaryOutput::~SolverBinaryOutput() {
+	try {
+		flush();
+	} catch(WriteFailure&) {
+		// cannot be reported here (call flush() before
+		// deleting the object to detect the failure)
+	}
+	fclose(fd);
+	delete[] buffer;
+}
+
+void SolverBinaryOutput::flush() {
+	// the buffer is emptied even if the write fails
+	// (the solutions are lost anyway)
+	int s=size;
+	size=0;
+	if ((s>0 && (int) fwrite(buffer, sizeof(double), 2*n*s, fd)!=2*n*s) || fflush(fd)!=0)
+		throw WriteFailure();
+}
+
+void SolverBinaryOutput::read(const char* filename, vector<IntervalVector>& sols) {
+	FILE* fd=fopen(filename, "rb");
+	if (fd==NULL) throw UnknownFileException(filename);
+
+	char magic[8];
+	int version, n;
+	if (fread(magic, 1, 8, fd)!=8 || memcmp(magic,MAGIC,8)!=0 ||
+		fread(&version, sizeof(int), 1, fd)!=1 || version!=VERSION ||
+		fread(&n, sizeof(int), 1, fd)!=1 || n<=0) {
+		fclose(fd);
+		throw InvalidFile();
+	}
+
+	double* b=new double[2*n];
+	size_t r;
+	while ((r=fread(b, sizeof(double), 2*n, fd))==(size_t) 2*n) {
+		IntervalVector sol(n);
+		for (int i=0; i<n; i++)
+			sol[i]=Interval(b[2*i],b[2*i+1]);
+		sols.push_back(sol);
+	}
+	delete[] b;
+	fclose(fd);
+
+	if (r!=0) throw InvalidFile(); // truncated file
+}
+
+} // end namespace ibex
@@ -0,0 +1,156 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_SolverOutput.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_SOLVER_OUTPUT_H__
+#define __IBEX_SOLVER_OUTPUT_H__
+
+#include "ibex_IntervalVector.h"
+#include "ibex_Exception.h"
+
+#include <vector>
+#include <stdio.h>
+
+namespace ibex {
+
+/**
+ * \ingroup strategy
+ *
+ * \brief Consumer of the solutions of a solver (streaming mode).
+ *
+ * Each solution is passed to #push(const IntervalVector&) as soon as
+ * it is found by the solver (see #ibex::Solver::next(SolverOutput&)).
+ *
+ * <p>
+ * Backpressure: if the consumer cannot keep up with the solver, it can
+ * either block in #push(const IntervalVector&) or return false. In
+ * the latter case, the search is paused until the solver is called again.
+ */
+class SolverOutput {
+public:
+	/**
+	 * \brief Take a new solution.
+	 *
+	 * \return false if the search must be paused.
+	 */
+	virtual bool push(const IntervalVector& sol)=0;
+
+	/**
+	 * \brief Delete *this.
+	 */
+	virtual ~SolverOutput() { }
+};
+
+/**
+ * \ingroup strategy
+ *
+ * \brief Binary file of solutions.
+ *
+ * The file starts with a header (format version and number of
+ * variables) followed by the solutions. Each solution is stored
+ * with fixed-width doubles: the lower and upper bounds of each
+ * component, in native byte order.
+ *
+ * Writing is buffered (the buffer is flushed when it is full
+ * or when the object is deleted).
+ */
+class SolverBinaryOutput : public SolverOutput {
+public:
+	/**
+	 * \brief Create the file.
+	 *
+	 * \param n           - the number of variables.
+	 * \param buffer_size - the number of solutions in the buffer.
+	 *
+	 * \throws UnknownFileException if the file cannot be created,
+	 *         SolverBinaryOutput::WriteFailure if the header cannot be written.
+	 */
+	SolverBinaryOutput(const char* filename, int n, int buffer_size=1024);
+
+	/**
+	 * \brief Flush the buffer and close the file.
+	 *
+	 * A write failure is ignored at this point. Call #flush()
+	 * before to detect it.
+	 */
+	~SolverBinaryOutput();
+
+	/**
+	 * \brief Write a solution (always returns true).
+	 *
+	 * \throws SolverBinaryOutput::WriteFailure if the buffer is
+	 *         full and cannot be written.
+	 */
+	bool push(const IntervalVector& sol);
+
+	/**
+	 * \brief Write the buffer into the file.
+	 *
+	 * \throws SolverBinaryOutput::WriteFailure if the buffer cannot
+	 *         be entirely written (e.g., the disk is full). The solutions
+	 *         of the buffer are then lost and the file is truncated.
+	 */
+	void flush();
+
+	/**
+	 * \brief Number of solutions written so far.
+	 */
+	long nb_sols() const;
+
+	/**
+	 * \brief Thrown when the file cannot be written.
+	 */
+	class WriteFailure : public Exception { };
+
+	/**
+	 * \brief Thrown when a file is not a valid file of solutions.
+	 */
+	class InvalidFile : public Exception { };
+
+	/**
+	 * \brief Read all the solutions of a file.
+	 *
+	 * \throws UnknownFileException, SolverBinaryOutput::InvalidFile.
+	 */
+	static void read(const char* filename, std::vector<IntervalVector>& sols);
+
+private:
+	SolverBinaryOutput(const SolverBinaryOutput&); // forbidden
+
+	FILE* fd;
+	const int n;
+	const int buffer_size;
+	double* buffer;
+	// number of solutions in the buffer
+	int size;
+	long nb;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline bool SolverBinaryOutput::push(const IntervalVector& sol) {
+	assert(sol.size()==n);
+
+	double* b=buffer+2*n*size;
+	for (int i=0; i<n; i++) {
+		*(b++)=sol[i].lb();
+		*(b++)=sol[i].ub();
+	}
+	nb++;
+	if (++size==buffer_size) flush();
+	return true;
+}
+
+inline long SolverBinaryOutput::nb_sols() const {
+	return nb;
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_SOLVER_OUTPUT_H__
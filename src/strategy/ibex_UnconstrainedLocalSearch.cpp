@@ -74,7 +74,7 @@ UnconstrainedLocalSearch::ReturnCode UnconstrainedLocalSearch::minimize(const Ve
 
 		// Initialize the quadratic approximation at the initial point x0
 		// like in the quasi-Newton algorithm
-		double fk=_mid(f.eval(xk1));
+		double fk=_check(f.eval_point(xk1));
 		Vector gk=_mid(f.gradient(xk1));
 		Matrix Bk=Matrix::eye(n);
 		//  cout << " [minimize] gk= " << gk << endl;
@@ -107,7 +107,7 @@ UnconstrainedLocalSearch::ReturnCode UnconstrainedLocalSearch::minimize(const Ve
 			xk1 = conj_grad(gk,Bk,xk,x_gcp,region,I);
 
 			// Compute the ration of achieved to predicted reduction in the function
-			fk1 = _mid(f.eval(xk1));
+			fk1 = _check(f.eval_point(xk1));
 			//  cout << " [minimize] xk1= " << xk1 <<"  fk1 = "<<fk1<<"   fk=" <<fk<< endl;
 
 			// computing m(xk1)-f(xk) = (xk1-xk)^T gk + 1/2 (xk1-xk)^T Bk (xk1-xzk)
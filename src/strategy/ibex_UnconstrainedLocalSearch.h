@@ -150,6 +150,12 @@ private:
 	 */
 	Vector _mid(const IntervalVector& x);
 
+	/*
+	 * \brief Return x if it is a finite number,
+	 * throw a InvalidPointException otherwise.
+	 */
+	double _check(double x);
+
 };
 
 
@@ -171,6 +177,11 @@ inline Vector UnconstrainedLocalSearch::_mid(const IntervalVector& x) {
 	else return x.mid();
 }
 
+inline double UnconstrainedLocalSearch::_check(double x) {
+	if (x!=x || x==POS_INFINITY || x==NEG_INFINITY) throw InvalidPointException();
+	else return x;
+}
+
 } // end namespace
 
 #endif /* __IBEX_UNCONSTRAINED_LOCAL_SEARCH_H__ */
@@ -29,6 +29,15 @@ namespace {
 
 int id_count=0;
 
+// expressions can be built by different threads (e.g., by the parser)
+inline int next_id() {
+#ifdef __GNUC__
+	return __sync_fetch_and_add(&id_count,1);
+#else
+	return id_count++;
+#endif
+}
+
 int max_height(const ExprNode& n1, const ExprNode& n2) {
 	if (n1.height>n2.height) return n1.height;
 	else return n2.height;
@@ -44,7 +53,7 @@ int max_height(const Array<const ExprNode>& args) {
 } // end anonymous namespace
 
 ExprNode::ExprNode(int height, int size, const Dim& dim) :
-  height(height), size(size), id(id_count++), dim(dim) {
+  height(height), size(size), id(next_id()), dim(dim) {
 
 }
 
@@ -0,0 +1,513 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ExprSimplify.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include <cassert>
+#include "ibex_ExprSimplify.h"
+#include "ibex_Expr.h"
+#include "ibex_ExprSubNodes.h"
+#include "ibex_Eval.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+enum { IDX, ADD, MUL, SUB, DIV, MAX, MIN, ATAN2, MINUS, TRANS, SIGN, ABS, POWER,
+	SQR, SQRT, EXP, LOG, COS, SIN, TAN, COSH, SINH, TANH, ACOS, ASIN, ATAN, ACOSH, ASINH, ATANH };
+
+/*
+ * True if e is the scalar constant v.
+ */
+bool is_cst(const ExprNode& e, double v) {
+	const ExprConstant* c=dynamic_cast<const ExprConstant*>(&e);
+	return c && c->dim.is_scalar() && c->get_value()==Interval(v);
+}
+
+/*
+ * Scalar domain with value x.
+ */
+Domain scalar(const Interval& x) {
+	Domain d(Dim::scalar());
+	d.i()=x;
+	return d;
+}
+
+}
+
+bool ExprSimplify::Key::operator<(const Key& k) const {
+	if (op!=k.op) return op<k.op;
+	if (a!=k.a) return a<k.a;
+	if (b!=k.b) return b<k.b;
+	return p<k.p;
+}
+
+const ExprNode& ExprSimplify::simplify(const Array<const ExprSymbol>& old_x, const Array<const ExprSymbol>& new_x, const ExprNode& y) {
+
+	clone.clean();
+	table.clear();
+	csts.clear();
+	created.clear();
+	defined.clear();
+
+	assert(new_x.size()>=old_x.size());
+
+	for (int i=0; i<old_x.size(); i++)
+		clone.insert(old_x[i],&new_x[i]);
+
+	visit(y);
+
+	const ExprNode& root=*clone[y];
+
+	// Delete the nodes that have been simplified afterwards
+	// (e.g., "x+y" in "0*(x+y)"). They must also be removed
+	// from the fathers of the remaining nodes.
+	ExprSubNodes live(root);
+	NodeMap<bool> dead;
+	for (vector<const ExprNode*>::iterator it=created.begin(); it!=created.end(); it++) {
+		if (!live.found(**it)) dead.insert(**it,true);
+	}
+
+	if (!created.empty()) {
+		Array<const ExprNode> remaining(live.size()+new_x.size());
+		for (int i=0; i<live.size(); i++)
+			remaining.set_ref(i,live[i]);
+		for (int i=0; i<new_x.size(); i++)
+			remaining.set_ref(live.size()+i,new_x[i]);
+
+		for (int i=0; i<remaining.size(); i++) {
+			Array<const ExprNode>& fathers=(Array<const ExprNode>&) remaining[i].fathers;
+			vector<const ExprNode*> keep;
+			for (int j=0; j<fathers.size(); j++)
+				if (!dead.found(fathers[j])) keep.push_back(&fathers[j]);
+			if ((int) keep.size()==fathers.size()) continue;
+			fathers.clear();  // not to delete the fathers
+			fathers.resize(0);
+			for (vector<const ExprNode*>::iterator it=keep.begin(); it!=keep.end(); it++)
+				fathers.add(**it);
+		}
+	}
+
+	// note: the map cannot be used anymore once a node is deleted
+	vector<const ExprNode*> to_delete;
+	for (vector<const ExprNode*>::iterator it=created.begin(); it!=created.end(); it++) {
+		if (dead.found(**it)) to_delete.push_back(*it);
+	}
+	dead.clean();
+	clone.clean();
+
+	for (vector<const ExprNode*>::iterator it=to_delete.begin(); it!=to_delete.end(); it++)
+		delete (ExprNode*) *it;
+
+	return root;
+}
+
+const ExprNode& ExprSimplify::node(int op, const ExprNode& a, const ExprNode* b, int p) {
+
+	map<Key,const ExprNode*>::iterator it=table.find(Key(op,&a,b,p));
+	if (it!=table.end()) return *it->second;
+
+	// commutative operators
+	if (op==ADD || op==MUL || op==MAX || op==MIN) {
+		it=table.find(Key(op,b,&a,p));
+		// note: a*b and b*a are not the same for matrices
+		if (it!=table.end() && (op!=MUL || a.dim.is_scalar() || b->dim.is_scalar())) return *it->second;
+	}
+
+	const ExprNode* n;
+	switch(op) {
+	case IDX:   n=&a[p]; break;
+	case ADD:   n=&(a+*b); break;
+	case MUL:   n=&(a**b); break;
+	case SUB:   n=&(a-*b); break;
+	case DIV:   n=&(a/(*b)); break;
+	case MAX:   n=&max(a,*b); break;
+	case MIN:   n=&min(a,*b); break;
+	case ATAN2: n=&atan2(a,*b); break;
+	case MINUS: n=&(-a); break;
+	case TRANS: n=&transpose(a); break;
+	case SIGN:  n=&sign(a); break;
+	case ABS:   n=&abs(a); break;
+	case POWER: n=&pow(a,p); break;
+	case SQR:   n=&sqr(a); break;
+	case SQRT:  n=&sqrt(a); break;
+	case EXP:   n=&exp(a); break;
+	case LOG:   n=&log(a); break;
+	case COS:   n=&cos(a); break;
+	case SIN:   n=&sin(a); break;
+	case TAN:   n=&tan(a); break;
+	case COSH:  n=&cosh(a); break;
+	case SINH:  n=&sinh(a); break;
+	case TANH:  n=&tanh(a); break;
+	case ACOS:  n=&acos(a); break;
+	case ASIN:  n=&asin(a); break;
+	case ATAN:  n=&atan(a); break;
+	case ACOSH: n=&acosh(a); break;
+	case ASINH: n=&asinh(a); break;
+	default:    assert(op==ATANH);
+	            n=&atanh(a); break;
+	}
+
+	table.insert(pair<Key,const ExprNode*>(Key(op,&a,b,p),n));
+	created.push_back(n);
+	return *n;
+}
+
+bool ExprSimplify::defined_everywhere(const ExprNode& e) {
+	map<const ExprNode*,bool>::iterator it=defined.find(&e);
+	if (it!=defined.end()) return it->second;
+
+	bool res;
+	const ExprConstant* c=dynamic_cast<const ExprConstant*>(&e);
+	const ExprBinaryOp* b=dynamic_cast<const ExprBinaryOp*>(&e);
+	const ExprUnaryOp* u=dynamic_cast<const ExprUnaryOp*>(&e);
+	const ExprIndex* i=dynamic_cast<const ExprIndex*>(&e);
+	const ExprVector* v=dynamic_cast<const ExprVector*>(&e);
+	const ExprPower* p=dynamic_cast<const ExprPower*>(&e);
+
+	if (dynamic_cast<const ExprSymbol*>(&e))
+		res=true;
+	else if (c)
+		res=!c->dim.is_scalar() || !c->get_value().is_empty();
+	else if (b)
+		res=(dynamic_cast<const ExprAdd*>(b) || dynamic_cast<const ExprSub*>(b) ||
+			 dynamic_cast<const ExprMul*>(b) || dynamic_cast<const ExprMax*>(b) ||
+			 dynamic_cast<const ExprMin*>(b))
+			&& defined_everywhere(b->left) && defined_everywhere(b->right);
+	else if (u)
+		// sqrt, log, tan, acos, asin, acosh, atanh and negative powers are partial
+		res=!(dynamic_cast<const ExprSqrt*>(u) || dynamic_cast<const ExprLog*>(u) ||
+			  dynamic_cast<const ExprTan*>(u)  || dynamic_cast<const ExprAcos*>(u) ||
+			  dynamic_cast<const ExprAsin*>(u) || dynamic_cast<const ExprAcosh*>(u) ||
+			  dynamic_cast<const ExprAtanh*>(u) || (p && p->expon<0))
+			&& defined_everywhere(u->expr);
+	else if (i)
+		res=defined_everywhere(i->expr);
+	else if (v) {
+		res=true;
+		for (int j=0; res && j<v->nb_args; j++)
+			res=defined_everywhere(v->arg(j));
+	} else
+		res=false; // function calls, chi, etc.
+
+	defined.insert(pair<const ExprNode*,bool>(&e,res));
+	return res;
+}
+
+const ExprNode& ExprSimplify::cst(const Domain& d) {
+	if (d.dim.is_scalar() && !d.i().is_empty()) {
+		pair<double,double> v(d.i().lb(),d.i().ub());
+		map<pair<double,double>,const ExprNode*>::iterator it=csts.find(v);
+		if (it!=csts.end()) return *it->second;
+		const ExprNode& c=ExprConstant::new_scalar(d.i());
+		csts.insert(pair<pair<double,double>,const ExprNode*>(v,&c));
+		created.push_back(&c);
+		return c;
+	} else {
+		const ExprNode& c=ExprConstant::new_(d);
+		created.push_back(&c);
+		return c;
+	}
+}
+
+const ExprNode& ExprSimplify::add(const ExprNode& l, const ExprNode& r, const Dim& dim) {
+	const ExprConstant* cl=dynamic_cast<const ExprConstant*>(&l);
+	const ExprConstant* cr=dynamic_cast<const ExprConstant*>(&r);
+
+	if (cl && cr) return cst(cl->get()+cr->get());
+	if (cl && cl->is_zero() && r.dim==dim) return r;
+	if (cr && cr->is_zero() && l.dim==dim) return l;
+
+	const ExprMinus* ml=dynamic_cast<const ExprMinus*>(&l);
+	const ExprMinus* mr=dynamic_cast<const ExprMinus*>(&r);
+	if (mr) return sub(l,mr->expr,dim);  // x+(-y) --> x-y
+	if (ml) return sub(r,ml->expr,dim);  // (-x)+y --> y-x
+
+	return node(ADD,l,&r);
+}
+
+const ExprNode& ExprSimplify::sub(const ExprNode& l, const ExprNode& r, const Dim& dim) {
+	const ExprConstant* cl=dynamic_cast<const ExprConstant*>(&l);
+	const ExprConstant* cr=dynamic_cast<const ExprConstant*>(&r);
+
+	if (cl && cr) return cst(cl->get()-cr->get());
+	if (cr && cr->is_zero() && l.dim==dim) return l;
+	if (cl && cl->is_zero() && r.dim==dim) return minus(r);
+
+	const ExprMinus* mr=dynamic_cast<const ExprMinus*>(&r);
+	if (mr) return add(l,mr->expr,dim);  // x-(-y) --> x+y
+
+	return node(SUB,l,&r);
+}
+
+const ExprNode& ExprSimplify::mul(const ExprNode& l, const ExprNode& r, const Dim& dim) {
+	const ExprConstant* cl=dynamic_cast<const ExprConstant*>(&l);
+	const ExprConstant* cr=dynamic_cast<const ExprConstant*>(&r);
+
+	if (cl && cr) return cst(cl->get()*cr->get());
+
+	// 0*x --> 0, unless x is not defined everywhere (e.g., 0*sqrt(x)
+	// is empty for x<0, and must remain so).
+	if (dim.is_scalar() && ((cl && cl->is_zero() && defined_everywhere(r)) ||
+			                (cr && cr->is_zero() && defined_everywhere(l))))
+		return cst(scalar(Interval::ZERO));
+
+	if (is_cst(l,1) && r.dim==dim) return r;
+	if (is_cst(r,1) && l.dim==dim) return l;
+	if (is_cst(l,-1) && r.dim==dim) return minus(r);
+	if (is_cst(r,-1) && l.dim==dim) return minus(l);
+
+	return node(MUL,l,&r);
+}
+
+const ExprNode& ExprSimplify::minus(const ExprNode& x) {
+	const ExprConstant* c=dynamic_cast<const ExprConstant*>(&x);
+	if (c) return cst(-c->get());
+
+	const ExprMinus* m=dynamic_cast<const ExprMinus*>(&x);
+	if (m) return m->expr;  // -(-x) --> x
+
+	const ExprSub* s=dynamic_cast<const ExprSub*>(&x);
+	if (s) return node(SUB,s->right,&s->left); // -(x-y) --> y-x
+
+	return node(MINUS,x);
+}
+
+const ExprNode& ExprSimplify::binary(int op, const ExprNode& l, const ExprNode& r, Domain (*fcst)(const Domain&, const Domain&)) {
+	const ExprConstant* cl=dynamic_cast<const ExprConstant*>(&l);
+	const ExprConstant* cr=dynamic_cast<const ExprConstant*>(&r);
+
+	if (cl && cr) return cst(fcst(cl->get(),cr->get()));
+
+	return node(op,l,&r);
+}
+
+const ExprNode& ExprSimplify::unary(int op, const ExprNode& x, Domain (*fcst)(const Domain&)) {
+	const ExprConstant* c=dynamic_cast<const ExprConstant*>(&x);
+	if (c) return cst(fcst(c->get()));
+
+	return node(op,x);
+}
+
+void ExprSimplify::visit(const ExprNode& e) {
+	if (!clone.found(e)) {
+		e.acceptVisitor(*this);
+	}
+}
+
+void ExprSimplify::visit(const ExprIndex& i) {
+	visit(i.expr);
+	const ExprNode& x=*clone[i.expr];
+
+	const ExprConstant* c=dynamic_cast<const ExprConstant*>(&x);
+	if (c) {
+		clone.insert(i, &cst(c->get()[i.index]));
+		return;
+	}
+
+	const ExprVector* v=dynamic_cast<const ExprVector*>(&x);
+	if (v) {  // (x,y)[0] --> x, unless y may be undefined
+		bool others_defined=true;
+		for (int j=0; others_defined && j<v->nb_args; j++)
+			if (j!=i.index) others_defined=defined_everywhere(v->arg(j));
+		if (others_defined) {
+			clone.insert(i, &v->arg(i.index));
+			return;
+		}
+	}
+
+	clone.insert(i, &node(IDX,x,NULL,i.index));
+}
+
+void ExprSimplify::visit(const ExprSymbol& x) {
+
+}
+
+void ExprSimplify::visit(const ExprConstant& c) {
+	clone.insert(c, &cst(c.get()));
+}
+
+// (useless so far)
+void ExprSimplify::visit(const ExprNAryOp& e) {
+	e.acceptVisitor(*this);
+}
+
+void ExprSimplify::visit(const ExprLeaf& e) {
+	e.acceptVisitor(*this);
+}
+
+// (useless so far)
+void ExprSimplify::visit(const ExprBinaryOp& b) {
+	b.acceptVisitor(*this);
+}
+
+// (useless so far)
+void ExprSimplify::visit(const ExprUnaryOp& u) {
+	u.acceptVisitor(*this);
+}
+
+#define ARG(i) (*clone[e.arg(i)])
+#define LEFT   (*clone[e.left])
+#define RIGHT  (*clone[e.right])
+#define EXPR   (*clone[e.expr])
+
+void ExprSimplify::visit(const ExprVector& e) {
+	bool all_cst=true;
+	for (int i=0; i<e.nb_args; i++) {
+		visit(e.arg(i));
+		all_cst &= dynamic_cast<const ExprConstant*>(&ARG(i))!=NULL;
+	}
+
+	if (all_cst) {
+		Domain d(e.dim);
+		if (e.dim.is_vector()) {
+			for (int i=0; i<e.nb_args; i++)
+				d.v()[i]=((const ExprConstant&) ARG(i)).get_value();
+		} else if (e.dim.type()==Dim::MATRIX) {
+			for (int i=0; i<e.nb_args; i++)
+				d.m().set_row(i,((const ExprConstant&) ARG(i)).get_vector_value());
+		} else {
+			assert(e.dim.type()==Dim::MATRIX_ARRAY);
+			for (int i=0; i<e.nb_args; i++)
+				d.ma()[i]=((const ExprConstant&) ARG(i)).get_matrix_value();
+		}
+		clone.insert(e, &cst(d));
+		return;
+	}
+
+	Array<const ExprNode> args2(e.nb_args);
+	for (int i=0; i<e.nb_args; i++)
+		args2.set_ref(i,ARG(i));
+
+	const ExprNode& v=ExprVector::new_(args2,e.row_vector());
+	created.push_back(&v);
+	clone.insert(e, &v);
+}
+
+void ExprSimplify::visit(const ExprApply& e) {
+	bool all_cst=true;
+	for (int i=0; i<e.nb_args; i++) {
+		visit(e.arg(i));
+		all_cst &= dynamic_cast<const ExprConstant*>(&ARG(i))!=NULL;
+	}
+
+	if (all_cst) {
+		Array<const Domain> d(e.nb_args);
+		for (int i=0; i<e.nb_args; i++)
+			d.set_ref(i,((const ExprConstant&) ARG(i)).get());
+		clone.insert(e, &cst(Eval().eval(e.func,d)));
+		return;
+	}
+
+	Array<const ExprNode> args2(e.nb_args);
+	for (int i=0; i<e.nb_args; i++)
+		args2.set_ref(i,ARG(i));
+
+	const ExprNode& a=ExprApply::new_(e.func, args2);
+	created.push_back(&a);
+	clone.insert(e, &a);
+}
+
+void ExprSimplify::visit(const ExprChi& e) {
+	for (int i=0; i<e.nb_args; i++)
+		visit(e.arg(i));
+
+	Array<const ExprNode> args2(e.nb_args);
+	for (int i=0; i<e.nb_args; i++)
+		args2.set_ref(i,ARG(i));
+
+	const ExprNode& c=ExprChi::new_(args2);
+	created.push_back(&c);
+	clone.insert(e, &c);
+}
+
+void ExprSimplify::visit(const ExprAdd& e) {
+	visit(e.left);
+	visit(e.right);
+	clone.insert(e, &add(LEFT,RIGHT,e.dim));
+}
+
+void ExprSimplify::visit(const ExprMul& e) {
+	visit(e.left);
+	visit(e.right);
+	clone.insert(e, &mul(LEFT,RIGHT,e.dim));
+}
+
+void ExprSimplify::visit(const ExprSub& e) {
+	visit(e.left);
+	visit(e.right);
+	clone.insert(e, &sub(LEFT,RIGHT,e.dim));
+}
+
+void ExprSimplify::visit(const ExprDiv& e) {
+	visit(e.left);
+	visit(e.right);
+	if (is_cst(RIGHT,1)) clone.insert(e, &LEFT); // x/1 --> x
+	else clone.insert(e, &binary(DIV,LEFT,RIGHT,operator/));
+}
+
+void ExprSimplify::visit(const ExprMax& e)   { visit(e.left); visit(e.right); clone.insert(e, &binary(MAX,  LEFT,RIGHT,max)); }
+void ExprSimplify::visit(const ExprMin& e)   { visit(e.left); visit(e.right); clone.insert(e, &binary(MIN,  LEFT,RIGHT,min)); }
+void ExprSimplify::visit(const ExprAtan2& e) { visit(e.left); visit(e.right); clone.insert(e, &binary(ATAN2,LEFT,RIGHT,atan2)); }
+
+void ExprSimplify::visit(const ExprMinus& e) {
+	visit(e.expr);
+	clone.insert(e, &minus(EXPR));
+}
+
+void ExprSimplify::visit(const ExprTrans& e) {
+	visit(e.expr);
+	const ExprTrans* t=dynamic_cast<const ExprTrans*>(&EXPR);
+	if (t) clone.insert(e, &t->expr); // (x')' --> x
+	else clone.insert(e, &unary(TRANS,EXPR,transpose));
+}
+
+void ExprSimplify::visit(const ExprPower& e) {
+	visit(e.expr);
+	const ExprConstant* c=dynamic_cast<const ExprConstant*>(&EXPR);
+	if (c)              clone.insert(e, &cst(pow(c->get(),e.expon)));
+	else if (e.expon==0 && defined_everywhere(EXPR)) clone.insert(e, &cst(scalar(Interval::ONE)));
+	else if (e.expon==1) clone.insert(e, &EXPR);
+	else if (e.expon==2) clone.insert(e, &node(SQR,EXPR));
+	else                 clone.insert(e, &node(POWER,EXPR,NULL,e.expon));
+}
+
+void ExprSimplify::visit(const ExprSqr& e) {
+	visit(e.expr);
+	const ExprMinus* m=dynamic_cast<const ExprMinus*>(&EXPR);
+	if (m) clone.insert(e, &node(SQR,m->expr)); // (-x)^2 --> x^2
+	else clone.insert(e, &unary(SQR,EXPR,sqr));
+}
+
+void ExprSimplify::visit(const ExprAbs& e) {
+	visit(e.expr);
+	const ExprMinus* m=dynamic_cast<const ExprMinus*>(&EXPR);
+	if (m) clone.insert(e, &node(ABS,m->expr)); // |-x| --> |x|
+	else clone.insert(e, &unary(ABS,EXPR,abs));
+}
+
+void ExprSimplify::visit(const ExprSign& e)  { visit(e.expr); clone.insert(e, &unary(SIGN, EXPR,sign)); }
+void ExprSimplify::visit(const ExprSqrt& e)  { visit(e.expr); clone.insert(e, &unary(SQRT, EXPR,sqrt)); }
+void ExprSimplify::visit(const ExprExp& e)   { visit(e.expr); clone.insert(e, &unary(EXP,  EXPR,exp)); }
+void ExprSimplify::visit(const ExprLog& e)   { visit(e.expr); clone.insert(e, &unary(LOG,  EXPR,log)); }
+void ExprSimplify::visit(const ExprCos& e)   { visit(e.expr); clone.insert(e, &unary(COS,  EXPR,cos)); }
+void ExprSimplify::visit(const ExprSin& e)   { visit(e.expr); clone.insert(e, &unary(SIN,  EXPR,sin)); }
+void ExprSimplify::visit(const ExprTan& e)   { visit(e.expr); clone.insert(e, &unary(TAN,  EXPR,tan)); }
+void ExprSimplify::visit(const ExprCosh& e)  { visit(e.expr); clone.insert(e, &unary(COSH, EXPR,cosh)); }
+void ExprSimplify::visit(const ExprSinh& e)  { visit(e.expr); clone.insert(e, &unary(SINH, EXPR,sinh)); }
+void ExprSimplify::visit(const ExprTanh& e)  { visit(e.expr); clone.insert(e, &unary(TANH, EXPR,tanh)); }
+void ExprSimplify::visit(const ExprAcos& e)  { visit(e.expr); clone.insert(e, &unary(ACOS, EXPR,acos)); }
+void ExprSimplify::visit(const ExprAsin& e)  { visit(e.expr); clone.insert(e, &unary(ASIN, EXPR,asin)); }
+void ExprSimplify::visit(const ExprAtan& e)  { visit(e.expr); clone.insert(e, &unary(ATAN, EXPR,atan)); }
+void ExprSimplify::visit(const ExprAcosh& e) { visit(e.expr); clone.insert(e, &unary(ACOSH,EXPR,acosh)); }
+void ExprSimplify::visit(const ExprAsinh& e) { visit(e.expr); clone.insert(e, &unary(ASINH,EXPR,asinh)); }
+void ExprSimplify::visit(const ExprAtanh& e) { visit(e.expr); clone.insert(e, &unary(ATANH,EXPR,atanh)); }
+
+} // end ibex namespace
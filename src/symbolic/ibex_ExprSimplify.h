@@ -0,0 +1,144 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ExprSimplify.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_EXPR_SIMPLIFY_H__
+#define __IBEX_EXPR_SIMPLIFY_H__
+
+#include "ibex_ExprVisitor.h"
+#include "ibex_Array.h"
+#include "ibex_Domain.h"
+#include "ibex_NodeMap.h"
+
+#include <map>
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \brief Simplified copy of an expression
+ *
+ * Duplicate an expression (with new symbols, as ExprCopy) and, in the same pass:
+ * <ul>
+ * <li> fold constant subexpressions into a single node,
+ * <li> remove trivial operations (0+x, x-0, 1*x, 0*x, x/1, -(-x), x^1, (x,y)[0], etc.),
+ *      without changing the definition domain: 0*x, x^0 and (x,y)[0] are only simplified
+ *      if x (resp. y) is defined everywhere (e.g., 0*sqrt(x) is kept),
+ * <li> merge identical subexpressions (hash-consing): two nodes with the same
+ *      operator applied to the same (simplified) arguments are represented by a
+ *      single node in the resulting DAG.
+ * </ul>
+ *
+ * Only scalar constants are merged. Vectors, function calls and
+ * chi nodes are copied without being merged.
+ */
+class ExprSimplify : public virtual ExprVisitor {
+
+public:
+	/*
+	 * \brief Duplicate and simplify an expression (with new symbols).
+	 *
+	 * Same conventions as ExprCopy::copy(...). The expression \a y
+	 * is left unchanged.
+	 */
+	const ExprNode& simplify(const Array<const ExprSymbol>& old_x, const Array<const ExprSymbol>& new_x, const ExprNode& y);
+
+protected:
+	void visit(const ExprNode& e);
+	void visit(const ExprIndex& i);
+	void visit(const ExprNAryOp& e);
+	void visit(const ExprLeaf& e);
+	void visit(const ExprBinaryOp& b);
+	void visit(const ExprUnaryOp& u);
+	void visit(const ExprSymbol& x);
+	void visit(const ExprConstant& c);
+	void visit(const ExprVector& e);
+	void visit(const ExprApply& e);
+	void visit(const ExprChi& e);
+	void visit(const ExprAdd& e);
+	void visit(const ExprMul& e);
+	void visit(const ExprSub& e);
+	void visit(const ExprDiv& e);
+	void visit(const ExprMax& e);
+	void visit(const ExprMin& e);
+	void visit(const ExprAtan2& e);
+	void visit(const ExprMinus& e);
+	void visit(const ExprTrans& e);
+	void visit(const ExprSign& e);
+	void visit(const ExprAbs& e);
+	void visit(const ExprPower& e);
+	void visit(const ExprSqr& e);
+	void visit(const ExprSqrt& e);
+	void visit(const ExprExp& e);
+	void visit(const ExprLog& e);
+	void visit(const ExprCos& e);
+	void visit(const ExprSin& e);
+	void visit(const ExprTan& e);
+	void visit(const ExprCosh& e);
+	void visit(const ExprSinh& e);
+	void visit(const ExprTanh& e);
+	void visit(const ExprAcos& e);
+	void visit(const ExprAsin& e);
+	void visit(const ExprAtan& e);
+	void visit(const ExprAcosh& e);
+	void visit(const ExprAsinh& e);
+	void visit(const ExprAtanh& e);
+
+	/*
+	 * Identify an operator node: code of the operator, arguments
+	 * (simplified) and integer parameter (index or exponent).
+	 */
+	struct Key {
+		int op;
+		const ExprNode* a;
+		const ExprNode* b;
+		int p;
+		Key(int op, const ExprNode* a, const ExprNode* b, int p) : op(op), a(a), b(b), p(p) { }
+		bool operator<(const Key& k) const;
+	};
+
+	/* Get the (unique) node "a op b" or create it. */
+	const ExprNode& node(int op, const ExprNode& a, const ExprNode* b=NULL, int p=0);
+
+	/* Get the (unique) constant node with value d or create it. */
+	const ExprNode& cst(const Domain& d);
+
+	const ExprNode& add(const ExprNode& l, const ExprNode& r, const Dim& dim);
+	const ExprNode& sub(const ExprNode& l, const ExprNode& r, const Dim& dim);
+	const ExprNode& mul(const ExprNode& l, const ExprNode& r, const Dim& dim);
+	const ExprNode& minus(const ExprNode& x);
+	const ExprNode& binary(int op, const ExprNode& l, const ExprNode& r, Domain (*fcst)(const Domain&, const Domain&));
+	const ExprNode& unary(int op, const ExprNode& x, Domain (*fcst)(const Domain&));
+
+	/* Copy of each node of the original expression. */
+	NodeMap<const ExprNode*> clone;
+
+	/* Operator nodes created so far. */
+	std::map<Key,const ExprNode*> table;
+
+	/* Scalar constants created so far. */
+	std::map<std::pair<double,double>,const ExprNode*> csts;
+
+	/* All the nodes created so far (some may not appear in the result). */
+	std::vector<const ExprNode*> created;
+
+	/*
+	 * True if the (simplified) expression e is defined on the whole space,
+	 * i.e., only made of symbols, constants and total operators (+,-,*,
+	 * max, exp, cos, etc.). Results are stored in #defined.
+	 */
+	bool defined_everywhere(const ExprNode& e);
+
+	/* Results of defined_everywhere(...) so far. */
+	std::map<const ExprNode*,bool> defined;
+};
+
+} // end namespace ibex
+
+#endif // __IBEX_EXPR_SIMPLIFY_H__
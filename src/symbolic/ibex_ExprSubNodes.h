@@ -89,6 +89,13 @@ public:
 	 */
 	bool found(const ExprNode& e) const;
 
+	/**
+	 * Return the index of the subnode e.
+	 *
+	 * \pre e must be a subnode (see #found(const ExprNode&)).
+	 */
+	int rank(const ExprNode& e) const;
+
 private:
 	friend class ExprNodes;
 	const ExprNode** tab;
@@ -114,5 +121,9 @@ inline bool ExprSubNodes::found(const ExprNode& e) const {
 	return map.found(e);
 }
 
+inline int ExprSubNodes::rank(const ExprNode& e) const {
+	return map[e];
+}
+
 } // end namespace ibex
 #endif // __IBEX_EXPR_SUB_NODES_H__
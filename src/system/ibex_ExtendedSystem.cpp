@@ -18,6 +18,10 @@ const char* ExtendedSystem::goal_name() {
 	return _goal_name;
 }
 
+ExtendedSystem::ExtendedSystem() {
+
+}
+
 ExtendedSystem::ExtendedSystem(const System& sys, double eps) /*: original_goal(*sys.goal)*/ {
 	init(SystemExtend(sys,eps));
 }
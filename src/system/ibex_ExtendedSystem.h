@@ -60,6 +60,12 @@ public:
 	 */
 	//Function original_goal;
 
+protected:
+	friend class SystemCache;
+
+	/** Uninitialized system */
+	ExtendedSystem();
+
 };
 
 /*================================== inline implementations ========================================*/
@@ -104,8 +104,12 @@ NormalizedSystem::NormalizedSystem(const System& sys, double eps) {
 	assert(j==nb_ctr);
 }
 
+NormalizedSystem::NormalizedSystem() : _orig_index(NULL) {
+
+}
+
 NormalizedSystem::~NormalizedSystem() {
-	delete[] _orig_index;
+	if (_orig_index) delete[] _orig_index;
 }
 
 } // end namespace ibex
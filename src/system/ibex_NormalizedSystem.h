@@ -55,6 +55,11 @@ public:
 	int original_index(int i) const;
 
 protected:
+	friend class SystemCache;
+
+	/** Uninitialized system */
+	NormalizedSystem();
+
 	int* _orig_index;
 };
 
@@ -11,26 +11,16 @@
 #include "ibex_System.h"
 #include "ibex_SyntaxError.h"
 #include "ibex_UnknownFileException.h"
+#include "ibex_ParserContext.h"
 #include "ibex_ExprCopy.h"
 #include "ibex_SystemCopy.cpp_"
 #include "ibex_SystemMerge.cpp_"
 #include <stdio.h>
 
-extern int ibexparse();
-extern void ibexparse_string(const char* syntax);
-//extern int ibex_lineno;
-extern void ibexrestart(FILE *);
-extern FILE* ibexin;
-
 using namespace std;
 
 namespace ibex {
 
-namespace parser {
-extern System* system;
-extern bool choco_start;
-}
-
 System::System() : nb_var(0), nb_ctr(0), box(1) /* tmp */ {
 
 }
@@ -41,17 +31,13 @@ System::System(const char* filename) : nb_var(0), nb_ctr(0), box(1) /* tmp */ {
 	load(fd);
 }
 
+System::System(const char* source, int size) : nb_var(0), nb_ctr(0), box(1) /* tmp */ {
+	parser::P_Context(*this).parse(source,size);
+}
+
 System::System(int n, const char* syntax) : nb_var(n), /* NOT TMP (required by parser) */
 		                                    nb_ctr(0), box(1) /* tmp */ {
-	try {
-		parser::choco_start=true;
-		parser::system=this;
-		ibexparse_string(syntax);
-		parser::system=NULL;
-	} catch(SyntaxError& e) {
-		parser::system=NULL;
-		throw e;
-	}
+	parser::P_Context(*this,true).parse(syntax,strlen(syntax));
 }
 
 System::System(const System& sys, copy_mode mode) : nb_var(0), nb_ctr(0), func(0), box(1) {
@@ -89,18 +75,12 @@ std::ostream& operator<<(std::ostream& os, const System& sys) {
 }
 
 void System::load(FILE* fd) {
-	ibexin = fd;
-
 	try {
-		parser::system=this;
-		ibexparse();
-		parser::system=NULL;
+		parser::P_Context(*this).parse(fd);
 	}
 
 	catch(SyntaxError& e) {
-		parser::system=NULL;
 		fclose(fd);
-		ibexrestart(ibexin);
 		throw e;
 	}
 
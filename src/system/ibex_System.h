@@ -21,6 +21,7 @@ class MainGenerator;
 }
 
 class SystemFactory;
+class SystemCache;
 
 /**
  * \defgroup system Systems
@@ -49,6 +50,14 @@ public:
 	 */
 	System(const char* filename);
 
+	/**
+	 * \brief Load a system from a memory buffer.
+	 *
+	 * \a source contains the same text as a system file
+	 * (size characters, not necessarily null-terminated).
+	 */
+	System(const char* source, int size);
+
 	/**
 	 * \brief Load a stand-alone conjunction of constraints
 	 * from a string.
@@ -162,6 +171,7 @@ protected:
 
 private:
 	friend class parser::MainGenerator;
+	friend class SystemCache;
 
 	void load(FILE* file);
 
@@ -0,0 +1,937 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_SystemCache.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "ibex_SystemCache.h"
+#include "ibex_UnknownFileException.h"
+#include "ibex_ExprVisitor.h"
+#include "ibex_NodeMap.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include <map>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+using namespace std;
+
+namespace ibex {
+
+const int SystemCache::VERSION = 1;
+
+namespace {
+
+/*
+ * Layout of a cache file (all numbers in the native byte order):
+ *
+ * - the header (see below)
+ * - the table of functions: number of functions and, for each function:
+ *     name, arguments (name and dimension), expression (see below)
+ *     and index of the derivative in the table (-1 if none).
+ *     A function only refers to functions (ExprApply, derivative)
+ *     that appear before it in the table.
+ * - the system, and then the normalized and extended systems
+ *   (if any): nb_var, nb_ctr, arguments, box, sybs, eprs, indices
+ *   of auxiliary functions, goal and constraint functions in the table,
+ *   expression of the main function (on the arguments of the system)
+ *   and original indices of constraints (normalized system only).
+ *
+ * An expression is a sequence of nodes sorted in topological order
+ * (subexpressions first), each node referring to its subexpressions by
+ * their rank. The first nodes are the arguments of the function.
+ */
+
+const char MAGIC[8] = { 'I','B','E','X','S','Y','S','\0' };
+
+const unsigned int BYTE_ORDER_MARK = 0x01020304;
+
+struct Header {
+	char magic[8];
+	int version;
+	unsigned int byte_order;
+	int size_of_double;
+	int content;
+	double eps;
+	unsigned long long source_hash;
+	unsigned long long body_hash;
+	unsigned long long body_size;
+};
+
+/* Node codes */
+typedef enum { SYMBOL, CONSTANT, INDEX, VECTOR, APPLY, CHI,
+	ADD, MUL, SUB, DIV, MAX, MIN, ATAN2,
+	MINUS, TRANS, SIGN, ABS, POWER, SQR, SQRT, EXP, LOG,
+	COS, SIN, TAN, COSH, SINH, TANH, ACOS, ASIN, ATAN, ACOSH, ASINH, ATANH } node_code;
+
+/*================================================================================*/
+/*                                   Writing                                      */
+/*================================================================================*/
+
+class Buffer : public string {
+public:
+	void put_int(int i)                 { append((const char*) &i, sizeof(int)); }
+	void put_double(double d)           { append((const char*) &d, sizeof(double)); }
+	void put_string(const char* s)      { int n=strlen(s); put_int(n); append(s,n+1); }
+	void put_dim(const Dim& d)          { put_int(d.dim1); put_int(d.dim2); put_int(d.dim3); }
+
+	void put_interval(const Interval& x) {
+		// an empty interval is stored as [+oo,-oo]
+		put_double(x.is_empty()? POS_INFINITY : x.lb());
+		put_double(x.is_empty()? NEG_INFINITY : x.ub());
+	}
+
+	void put_domain(const Domain& d) {
+		put_dim(d.dim);
+		switch (d.dim.type()) {
+		case Dim::SCALAR:       put_interval(d.i()); break;
+		case Dim::ROW_VECTOR:
+		case Dim::COL_VECTOR:   for (int i=0; i<d.v().size(); i++) put_interval(d.v()[i]); break;
+		case Dim::MATRIX:       for (int i=0; i<d.m().nb_rows(); i++)
+		                        	for (int j=0; j<d.m().nb_cols(); j++) put_interval(d.m()[i][j]);
+		                        break;
+		case Dim::MATRIX_ARRAY: for (int k=0; k<d.ma().size(); k++)
+		                        	for (int i=0; i<d.ma()[k].nb_rows(); i++)
+		                        		for (int j=0; j<d.ma()[k].nb_cols(); j++) put_interval(d.ma()[k][i][j]);
+		                        break;
+		}
+	}
+};
+
+/*
+ * True if the symbolic derivative of the function can be calculated
+ * (ExprDiff does not support all the operators and stops the program
+ * in this case). Conservative: scalar functions of scalar operations.
+ */
+class Differentiable : public virtual ExprVisitor {
+public:
+	Differentiable(const Function& f) : ok(f.expr().dim.is_scalar()) {
+		for (int i=0; ok && i<f.nb_arg(); i++)
+			ok = f.arg(i).dim.type()!=Dim::MATRIX_ARRAY;
+		if (ok) visit(f.expr());
+	}
+
+	bool ok;
+
+protected:
+	void visit(const ExprNode& e) {
+		if (ok && !map.found(e)) {
+			map.insert(e,true);
+			e.acceptVisitor(*this);
+		}
+	}
+	void visit(const ExprIndex& e)       { visit(e.expr); }
+	void visit(const ExprLeaf& e)        { }
+	void visit(const ExprNAryOp& e)      { ok=false; }
+	void visit(const ExprBinaryOp& e)    { ok &= e.dim.is_scalar(); visit(e.left); visit(e.right); }
+	void visit(const ExprUnaryOp& e)     { ok &= e.dim.is_scalar(); visit(e.expr); }
+	void visit(const ExprMax& e)         { ok=false; }
+	void visit(const ExprMin& e)         { ok=false; }
+	void visit(const ExprAtan2& e)       { ok=false; }
+	void visit(const ExprTrans& e)       { ok=false; }
+	void visit(const ExprSign& e)        { ok=false; }
+
+	NodeMap<bool> map;
+};
+
+class CacheWriter;
+
+/*
+ * Write the nodes of an expression.
+ */
+class ExprWriter : public virtual ExprVisitor {
+public:
+	ExprWriter(CacheWriter& cache, const Array<const ExprSymbol>& x, const ExprNode& y, Buffer& buf);
+
+protected:
+	void visit(const ExprNode& e);
+	void visit(const ExprIndex& e);
+	void visit(const ExprLeaf& e);
+	void visit(const ExprNAryOp& e);
+	void visit(const ExprBinaryOp& e);
+	void visit(const ExprUnaryOp& e);
+
+	void visit(const ExprSymbol& e);
+	void visit(const ExprConstant& e);
+	void visit(const ExprVector& e);
+	void visit(const ExprApply& e);
+	void visit(const ExprChi& e);
+
+	void visit(const ExprAdd& e)   { binary(e,ADD); }
+	void visit(const ExprMul& e)   { binary(e,MUL); }
+	void visit(const ExprSub& e)   { binary(e,SUB); }
+	void visit(const ExprDiv& e)   { binary(e,DIV); }
+	void visit(const ExprMax& e)   { binary(e,MAX); }
+	void visit(const ExprMin& e)   { binary(e,MIN); }
+	void visit(const ExprAtan2& e) { binary(e,ATAN2); }
+
+	void visit(const ExprMinus& e) { unary(e,MINUS); }
+	void visit(const ExprTrans& e) { unary(e,TRANS); }
+	void visit(const ExprSign& e)  { unary(e,SIGN); }
+	void visit(const ExprAbs& e)   { unary(e,ABS); }
+	void visit(const ExprPower& e);
+	void visit(const ExprSqr& e)   { unary(e,SQR); }
+	void visit(const ExprSqrt& e)  { unary(e,SQRT); }
+	void visit(const ExprExp& e)   { unary(e,EXP); }
+	void visit(const ExprLog& e)   { unary(e,LOG); }
+	void visit(const ExprCos& e)   { unary(e,COS); }
+	void visit(const ExprSin& e)   { unary(e,SIN); }
+	void visit(const ExprTan& e)   { unary(e,TAN); }
+	void visit(const ExprCosh& e)  { unary(e,COSH); }
+	void visit(const ExprSinh& e)  { unary(e,SINH); }
+	void visit(const ExprTanh& e)  { unary(e,TANH); }
+	void visit(const ExprAcos& e)  { unary(e,ACOS); }
+	void visit(const ExprAsin& e)  { unary(e,ASIN); }
+	void visit(const ExprAtan& e)  { unary(e,ATAN); }
+	void visit(const ExprAcosh& e) { unary(e,ACOSH); }
+	void visit(const ExprAsinh& e) { unary(e,ASINH); }
+	void visit(const ExprAtanh& e) { unary(e,ATANH); }
+
+	void binary(const ExprBinaryOp& e, node_code code);
+	void unary(const ExprUnaryOp& e, node_code code);
+
+	// give a rank to a node, once its subnodes are written
+	void add(const ExprNode& e);
+
+	CacheWriter& cache;
+	Buffer nodes;
+	NodeMap<int> rank;
+	int nb_nodes;
+};
+
+class CacheWriter {
+public:
+	CacheWriter(bool diff) : diff(diff), nb_func(0) { }
+
+	/*
+	 * Index of a function in the table
+	 * (the function is added to the table if necessary).
+	 *
+	 * The derivative is only written if \a with_diff is true.
+	 */
+	int index(const Function& f, bool with_diff=true) {
+		map<const Function*,int>::iterator it=func.find(&f);
+		if (it!=func.end()) return it->second;
+
+		Buffer rec;
+		rec.put_string(f.name);
+		put_expr(f.args(), f.expr(), rec);
+
+		rec.put_int(with_diff? index_diff(f) : -1);
+
+		table.append(rec);
+		func.insert(pair<const Function*,int>(&f,nb_func));
+		return nb_func++;
+	}
+
+	// write the arguments and the expression
+	void put_expr(const Array<const ExprSymbol>& x, const ExprNode& y, Buffer& buf) {
+		buf.put_int(x.size());
+		for (int i=0; i<x.size(); i++) {
+			buf.put_string(x[i].name);
+			buf.put_dim(x[i].dim);
+		}
+		ExprWriter(*this, x, y, buf);
+	}
+
+	// index of the derivative of f (-1 if none)
+	// Only first derivatives are written: the derivative of a
+	// univariate function is also differentiable, and so on.
+	int index_diff(const Function& f) {
+		if (diff && Differentiable(f).ok) return index(f.diff(),false);
+		else return -1;
+	}
+
+	void put_system(const System& sys) {
+		body.put_int(sys.nb_var);
+		body.put_int(sys.nb_ctr);
+
+		body.put_int(sys.args.size());
+		for (int i=0; i<sys.args.size(); i++) {
+			body.put_string(sys.args[i].name);
+			body.put_dim(sys.args[i].dim);
+		}
+
+		for (int i=0; i<sys.nb_var; i++)
+			body.put_interval(sys.box[i]);
+
+		body.put_int(sys.sybs.size());
+		for (unsigned int i=0; i<sys.sybs.size(); i++) body.put_int(sys.sybs[i]);
+		body.put_int(sys.eprs.size());
+		for (unsigned int i=0; i<sys.eprs.size(); i++) body.put_int(sys.eprs[i]);
+
+		body.put_int(sys.func.size());
+		for (int i=0; i<sys.func.size(); i++)
+			body.put_int(index(sys.func[i]));
+
+		body.put_int(sys.goal? index(*sys.goal) : -1);
+
+		body.put_int(sys.ctrs.size());
+		for (int i=0; i<sys.ctrs.size(); i++) {
+			body.put_int(index(sys.ctrs[i].f));
+			body.put_int(sys.ctrs[i].op);
+		}
+
+		// the main function is not initialized for
+		// unconstrained problems (see System::init_f_from_ctrs)
+		bool has_f=!sys.ctrs.is_empty();
+		body.put_int(has_f);
+		if (has_f) {
+			body.put_string(sys.f.name);
+			// the arguments of f are the arguments of the system
+			ExprWriter(*this, sys.args, sys.f.expr(), body);
+			body.put_int(index_diff(sys.f));
+		}
+	}
+
+	bool diff;
+	int nb_func;
+	map<const Function*,int> func;
+	Buffer table;
+	Buffer body;
+};
+
+ExprWriter::ExprWriter(CacheWriter& cache, const Array<const ExprSymbol>& x, const ExprNode& y, Buffer& buf) :
+		cache(cache), nb_nodes(0) {
+
+	for (int i=0; i<x.size(); i++)
+		rank.insert(x[i], nb_nodes++);
+
+	visit(y);
+
+	buf.put_int(nb_nodes-x.size());
+	buf.append(nodes);
+	buf.put_int(rank[y]);
+}
+
+void ExprWriter::add(const ExprNode& e) {
+	rank.insert(e, nb_nodes++);
+}
+
+void ExprWriter::visit(const ExprNode& e) {
+	if (!rank.found(e))
+		e.acceptVisitor(*this);
+}
+
+void ExprWriter::visit(const ExprIndex& e) {
+	visit(e.expr);
+	nodes.put_int(INDEX);
+	nodes.put_int(rank[e.expr]);
+	nodes.put_int(e.index);
+	add(e);
+}
+
+void ExprWriter::visit(const ExprLeaf& e) {
+	e.acceptVisitor(*this);
+}
+
+void ExprWriter::visit(const ExprNAryOp& e) {
+	e.acceptVisitor(*this);
+}
+
+void ExprWriter::visit(const ExprBinaryOp& e) {
+	e.acceptVisitor(*this);
+}
+
+void ExprWriter::visit(const ExprUnaryOp& e) {
+	e.acceptVisitor(*this);
+}
+
+void ExprWriter::visit(const ExprSymbol& e) {
+	// all the symbols are ranked at the beginning
+	ibex_error("SystemCache: symbol not declared as argument of the function");
+}
+
+void ExprWriter::visit(const ExprConstant& e) {
+	nodes.put_int(CONSTANT);
+	nodes.put_domain(e.get());
+	add(e);
+}
+
+void ExprWriter::visit(const ExprVector& e) {
+	for (int i=0; i<e.nb_args; i++)
+		visit(e.arg(i));
+	nodes.put_int(VECTOR);
+	nodes.put_int(e.row_vector());
+	nodes.put_int(e.nb_args);
+	for (int i=0; i<e.nb_args; i++)
+		nodes.put_int(rank[e.arg(i)]);
+	add(e);
+}
+
+void ExprWriter::visit(const ExprApply& e) {
+	for (int i=0; i<e.nb_args; i++)
+		visit(e.arg(i));
+	// the called function is written first in the table
+	int f=cache.index(e.func);
+	nodes.put_int(APPLY);
+	nodes.put_int(f);
+	nodes.put_int(e.nb_args);
+	for (int i=0; i<e.nb_args; i++)
+		nodes.put_int(rank[e.arg(i)]);
+	add(e);
+}
+
+void ExprWriter::visit(const ExprChi& e) {
+	for (int i=0; i<e.nb_args; i++)
+		visit(e.arg(i));
+	nodes.put_int(CHI);
+	for (int i=0; i<e.nb_args; i++)
+		nodes.put_int(rank[e.arg(i)]);
+	add(e);
+}
+
+void ExprWriter::visit(const ExprPower& e) {
+	visit(e.expr);
+	nodes.put_int(POWER);
+	nodes.put_int(rank[e.expr]);
+	nodes.put_int(e.expon);
+	add(e);
+}
+
+void ExprWriter::binary(const ExprBinaryOp& e, node_code code) {
+	visit(e.left);
+	visit(e.right);
+	nodes.put_int(code);
+	nodes.put_int(rank[e.left]);
+	nodes.put_int(rank[e.right]);
+	add(e);
+}
+
+void ExprWriter::unary(const ExprUnaryOp& e, node_code code) {
+	visit(e.expr);
+	nodes.put_int(code);
+	nodes.put_int(rank[e.expr]);
+	add(e);
+}
+
+/*================================================================================*/
+/*                                   Reading                                      */
+/*================================================================================*/
+
+/*
+ * Read-only view of a file (memory-mapped when possible).
+ */
+class MappedFile {
+public:
+	MappedFile(const char* filename) {
+#ifndef _WIN32
+		int fd=open(filename, O_RDONLY);
+		if (fd==-1) throw UnknownFileException(filename);
+		struct stat st;
+		if (fstat(fd,&st)==-1 || st.st_size==0) {
+			::close(fd);
+			throw SystemCache::InvalidCache();
+		}
+		size=st.st_size;
+		void* p=mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+		::close(fd);
+		if (p==MAP_FAILED) throw SystemCache::InvalidCache();
+		data=(const char*) p;
+#else
+		FILE* fd=fopen(filename, "rb");
+		if (fd==NULL) throw UnknownFileException(filename);
+		fseek(fd,0,SEEK_END);
+		size=ftell(fd);
+		fseek(fd,0,SEEK_SET);
+		char* buf=new char[size];
+		size_t n=fread(buf,1,size,fd);
+		fclose(fd);
+		data=buf;
+		if (n!=size) { delete[] buf; throw SystemCache::InvalidCache(); }
+#endif
+	}
+
+	~MappedFile() {
+#ifndef _WIN32
+		munmap((void*) data, size);
+#else
+		delete[] data;
+#endif
+	}
+
+	const char* data;
+	size_t size;
+};
+
+/*
+ * Read and check the header of a cache file.
+ */
+const Header& read_header(const MappedFile& file) {
+	if (file.size<sizeof(Header)) throw SystemCache::InvalidCache();
+
+	const Header& h=*((const Header*) file.data);
+	if (memcmp(h.magic,MAGIC,sizeof(MAGIC))!=0 ||
+			h.version!=SystemCache::VERSION ||
+			h.byte_order!=BYTE_ORDER_MARK ||
+			h.size_of_double!=sizeof(double) ||
+			h.body_size!=file.size-sizeof(Header))
+		throw SystemCache::InvalidCache();
+
+	return h;
+}
+
+class CacheReader {
+public:
+	CacheReader(const char* data, size_t size) : p(data), end(data+size) { }
+
+	void check(size_t n) {
+		if (p+n>end) throw SystemCache::InvalidCache();
+	}
+
+	int get_int() {
+		int i;
+		check(sizeof(int));
+		memcpy(&i,p,sizeof(int));
+		p+=sizeof(int);
+		return i;
+	}
+
+	// get a non-negative integer less than max
+	int get_index(int max) {
+		int i=get_int();
+		if (i<0 || i>=max) throw SystemCache::InvalidCache();
+		return i;
+	}
+
+	double get_double() {
+		double d;
+		check(sizeof(double));
+		memcpy(&d,p,sizeof(double));
+		p+=sizeof(double);
+		return d;
+	}
+
+	// the string is not copied
+	const char* get_string() {
+		int n=get_int();
+		if (n<0) throw SystemCache::InvalidCache();
+		check(n+1);
+		const char* s=p;
+		if (s[n]!='\0') throw SystemCache::InvalidCache();
+		p+=n+1;
+		return s;
+	}
+
+	Dim get_dim() {
+		int d1=get_int();
+		int d2=get_int();
+		int d3=get_int();
+		if (d1<1 || d2<1 || d3<1) throw SystemCache::InvalidCache();
+		return Dim(d1,d2,d3);
+	}
+
+	Interval get_interval() {
+		double lb=get_double();
+		double ub=get_double();
+		return lb>ub? Interval::EMPTY_SET : Interval(lb,ub);
+	}
+
+	const ExprConstant& get_constant() {
+		Domain d(get_dim());
+		switch (d.dim.type()) {
+		case Dim::SCALAR:       d.i()=get_interval(); break;
+		case Dim::ROW_VECTOR:
+		case Dim::COL_VECTOR:   for (int i=0; i<d.v().size(); i++) d.v()[i]=get_interval(); break;
+		case Dim::MATRIX:       for (int i=0; i<d.m().nb_rows(); i++)
+		                        	for (int j=0; j<d.m().nb_cols(); j++) d.m()[i][j]=get_interval();
+		                        break;
+		case Dim::MATRIX_ARRAY: for (int k=0; k<d.ma().size(); k++)
+		                        	for (int i=0; i<d.ma()[k].nb_rows(); i++)
+		                        		for (int j=0; j<d.ma()[k].nb_cols(); j++) d.ma()[k][i][j]=get_interval();
+		                        break;
+		}
+		return ExprConstant::new_(d);
+	}
+
+	void get_symbols(Array<const ExprSymbol>& x) {
+		int n=get_int();
+		if (n<0) throw SystemCache::InvalidCache();
+		x.resize(n);
+		int i=0;
+		try {
+			for (; i<n; i++) {
+				const char* name=get_string();
+				x.set_ref(i,ExprSymbol::new_(name,get_dim()));
+			}
+		} catch(SystemCache::InvalidCache&) {
+			for (int j=0; j<i; j++)
+				delete &x[j];
+			x.clear();
+			throw;
+		}
+	}
+
+	const ExprNode& get_expr(const Array<const ExprSymbol>& x);
+
+	void get_table() {
+		int n=get_int();
+		if (n<0) throw SystemCache::InvalidCache();
+		for (int i=0; i<n; i++) {
+			const char* name=get_string();
+			Array<const ExprSymbol> x(0);
+			get_symbols(x);
+			const ExprNode* y;
+			try {
+				y=&get_expr(x);
+			} catch(SystemCache::InvalidCache&) {
+				for (int j=0; j<x.size(); j++)
+					delete &x[j];
+				throw;
+			}
+			Function* f=new Function(x,*y,name);
+			table.push_back(f);
+			owned.push_back(false);
+			set_diff(*f);
+		}
+	}
+
+	// get a function of the table, owned by the caller
+	Function& get_function(int i) {
+		if (i<0 || i>=(int) table.size() || owned[i]) throw SystemCache::InvalidCache();
+		owned[i]=true;
+		return *table[i];
+	}
+
+	// the derivative is set by the caller (see SystemCache::read)
+	void set_diff(Function& f) {
+		int i=get_int();
+		if (i!=-1) diffs.push_back(pair<Function*,Function*>(&f,&get_function(i)));
+	}
+
+	void get_system(System& sys) {
+		(int&) sys.nb_var=get_int();
+		(int&) sys.nb_ctr=get_int();
+		if (sys.nb_var<0 || sys.nb_ctr<0) throw SystemCache::InvalidCache();
+
+		get_symbols(sys.args);
+		// owned by the main function, once initialized
+		free_args.push_back(&sys.args);
+
+		sys.box.resize(sys.nb_var);
+		for (int i=0; i<sys.nb_var; i++)
+			sys.box[i]=get_interval();
+
+		int n=get_int();
+		for (int i=0; i<n; i++) sys.sybs.push_back(get_int());
+		n=get_int();
+		for (int i=0; i<n; i++) sys.eprs.push_back(get_int());
+
+		n=get_int();
+		if (n<0) throw SystemCache::InvalidCache();
+		sys.func.resize(n);
+		for (int i=0; i<n; i++)
+			sys.func.set_ref(i,get_function(get_int()));
+
+		int goal=get_int();
+		sys.goal= goal==-1? NULL : &get_function(goal);
+
+		n=get_int();
+		if (n<0) throw SystemCache::InvalidCache();
+		sys.ctrs.resize(n);
+		for (int i=0; i<n; i++) {
+			Function& f=get_function(get_int());
+			CmpOp op=(CmpOp) get_index(GT+1);
+			// the function is owned by the constraint only
+			// once the whole file is read (see SystemCache::read)
+			ctrs.push_back(new NumConstraint(f,op,false));
+			sys.ctrs.set_ref(i,*ctrs.back());
+		}
+
+		if (get_int()) {
+			const char* name=get_string();
+			const ExprNode& y=get_expr(sys.args);
+			sys.f.init(sys.args,y,name);
+			free_args.pop_back();
+			set_diff(sys.f);
+		}
+	}
+
+	// the file is invalid: delete the systems and all
+	// the objects built so far
+	void release(System* sys) {
+		if (!sys) return;
+		sys->func.clear();
+		sys->func.resize(0);
+		sys->goal=NULL;
+		sys->ctrs.clear();
+		sys->ctrs.resize(0);
+		for (unsigned int i=0; i<free_args.size(); i++)
+			if (free_args[i]==&sys->args) {
+				for (int j=0; j<sys->args.size(); j++)
+					delete &sys->args[j];
+				sys->args.clear();
+			}
+		delete sys;
+	}
+
+	void release() {
+		for (unsigned int i=0; i<ctrs.size(); i++)
+			delete ctrs[i]; // without the function
+		for (unsigned int i=0; i<table.size(); i++)
+			delete table[i];
+	}
+
+	const char* p;
+	const char* end;
+	std::vector<Function*> table;
+	std::vector<bool> owned;
+	// functions and their derivatives
+	std::vector<pair<Function*,Function*> > diffs;
+	// constraints of the systems
+	std::vector<NumConstraint*> ctrs;
+	// arguments of systems not owned yet by the main function
+	std::vector<Array<const ExprSymbol>*> free_args;
+};
+
+const ExprNode& CacheReader::get_expr(const Array<const ExprSymbol>& x) {
+	int n=get_int();
+	if (n<0) throw SystemCache::InvalidCache();
+
+	vector<const ExprNode*> node(x.size()+n);
+	for (int i=0; i<x.size(); i++)
+		node[i]=&x[i];
+
+	int i=x.size();
+	try {
+		for (; i<x.size()+n; i++) {
+#define ARG node[get_index(i)]
+			int code=get_int();
+			switch(code) {
+			case CONSTANT: node[i]=&get_constant(); break;
+			case INDEX:    { const ExprNode& e=*ARG; node[i]=&e[get_int()]; } break;
+			case VECTOR:
+			case APPLY:
+			case CHI:      {
+				int r=0;
+				const Function* f=NULL;
+				if (code==VECTOR) r=get_int();
+				if (code==APPLY) f=table[get_index(table.size())];
+				int m= code==CHI? 3 : get_int();
+				if (m<1) throw SystemCache::InvalidCache();
+				Array<const ExprNode> args(m);
+				for (int j=0; j<m; j++) args.set_ref(j,*ARG);
+				switch(code) {
+				case VECTOR: node[i]=&ExprVector::new_(args,r); break;
+				case APPLY:  node[i]=&ExprApply::new_(*f,args); break;
+				default:     node[i]=&ExprChi::new_(args); break;
+				}
+				}
+				break;
+			case ADD:      { const ExprNode& l=*ARG; node[i]=&ExprAdd::new_(l,*ARG); } break;
+			case MUL:      { const ExprNode& l=*ARG; node[i]=&ExprMul::new_(l,*ARG); } break;
+			case SUB:      { const ExprNode& l=*ARG; node[i]=&ExprSub::new_(l,*ARG); } break;
+			case DIV:      { const ExprNode& l=*ARG; node[i]=&ExprDiv::new_(l,*ARG); } break;
+			case MAX:      { const ExprNode& l=*ARG; node[i]=&ExprMax::new_(l,*ARG); } break;
+			case MIN:      { const ExprNode& l=*ARG; node[i]=&ExprMin::new_(l,*ARG); } break;
+			case ATAN2:    { const ExprNode& l=*ARG; node[i]=&ExprAtan2::new_(l,*ARG); } break;
+			case MINUS:    node[i]=&ExprMinus::new_(*ARG); break;
+			case TRANS:    node[i]=&ExprTrans::new_(*ARG); break;
+			case SIGN:     node[i]=&ExprSign::new_(*ARG); break;
+			case ABS:      node[i]=&ExprAbs::new_(*ARG); break;
+			case POWER:    { const ExprNode& e=*ARG; node[i]=&ExprPower::new_(e,get_int()); } break;
+			case SQR:      node[i]=&ExprSqr::new_(*ARG); break;
+			case SQRT:     node[i]=&ExprSqrt::new_(*ARG); break;
+			case EXP:      node[i]=&ExprExp::new_(*ARG); break;
+			case LOG:      node[i]=&ExprLog::new_(*ARG); break;
+			case COS:      node[i]=&ExprCos::new_(*ARG); break;
+			case SIN:      node[i]=&ExprSin::new_(*ARG); break;
+			case TAN:      node[i]=&ExprTan::new_(*ARG); break;
+			case COSH:     node[i]=&ExprCosh::new_(*ARG); break;
+			case SINH:     node[i]=&ExprSinh::new_(*ARG); break;
+			case TANH:     node[i]=&ExprTanh::new_(*ARG); break;
+			case ACOS:     node[i]=&ExprAcos::new_(*ARG); break;
+			case ASIN:     node[i]=&ExprAsin::new_(*ARG); break;
+			case ATAN:     node[i]=&ExprAtan::new_(*ARG); break;
+			case ACOSH:    node[i]=&ExprAcosh::new_(*ARG); break;
+			case ASINH:    node[i]=&ExprAsinh::new_(*ARG); break;
+			case ATANH:    node[i]=&ExprAtanh::new_(*ARG); break;
+			default:       throw SystemCache::InvalidCache();
+			}
+#undef ARG
+		}
+
+		return *node[get_index(x.size()+n)];
+
+	} catch(Exception&) {
+		// including DimException (nodes with mismatching dimensions)
+		for (int j=x.size(); j<i; j++)
+			delete node[j];
+		throw SystemCache::InvalidCache();
+	}
+}
+
+/* Read a whole file */
+string read_file(const char* filename) {
+	FILE* fd=fopen(filename, "rb");
+	if (fd==NULL) throw UnknownFileException(filename);
+	string s;
+	char buf[4096];
+	size_t n;
+	while ((n=fread(buf,1,sizeof(buf),fd))>0)
+		s.append(buf,n);
+	fclose(fd);
+	return s;
+}
+
+} // end anonymous namespace
+
+unsigned long long SystemCache::hash(const char* text, int size) {
+	unsigned long long h=14695981039346656037ULL;
+	for (int i=0; i<size; i++) {
+		h ^= (unsigned char) text[i];
+		h *= 1099511628211ULL;
+	}
+	return h;
+}
+
+void SystemCache::write(const char* cache_file, const System& sys,
+		const NormalizedSystem* norm, const ExtendedSystem* ext,
+		bool diff, double eps, unsigned long long source_hash) {
+
+	CacheWriter w(diff);
+
+	w.put_system(sys);
+
+	if (norm) {
+		w.put_system(*norm);
+		for (int i=0; i<norm->nb_ctr; i++)
+			w.body.put_int(norm->original_index(i));
+	}
+
+	if (ext) w.put_system(*ext);
+
+	Buffer body;
+	body.put_int(w.nb_func);
+	body.append(w.table);
+	body.append(w.body);
+
+	Header h;
+	memcpy(h.magic,MAGIC,sizeof(MAGIC));
+	h.version=VERSION;
+	h.byte_order=BYTE_ORDER_MARK;
+	h.size_of_double=sizeof(double);
+	h.content=(norm? NORMALIZED : 0) | (ext? EXTENDED : 0) | (diff? DIFF : 0);
+	h.eps=eps;
+	h.source_hash=source_hash;
+	h.body_hash=hash(body.data(),body.size());
+	h.body_size=body.size();
+
+	FILE* fd=fopen(cache_file, "wb");
+	if (fd==NULL) throw UnknownFileException(cache_file);
+	bool ok=fwrite(&h,sizeof(Header),1,fd)==1 && fwrite(body.data(),1,body.size(),fd)==body.size();
+	ok &= (fclose(fd)==0);
+	if (!ok) {
+		remove(cache_file);
+		throw UnknownFileException(cache_file);
+	}
+}
+
+SystemCache::SystemCache(const char* cache_file) : from_cache(true), _content(0), sys(NULL), norm(NULL), ext(NULL) {
+	read(cache_file);
+}
+
+SystemCache::SystemCache(const char* filename, const char* cache_file, int content, double eps) :
+		from_cache(false), _content(content), sys(NULL), norm(NULL), ext(NULL) {
+
+	string source=read_file(filename);
+	unsigned long long source_hash=hash(source.data(),source.size());
+
+	try {
+		MappedFile file(cache_file);
+		const Header& h=read_header(file);
+		if (h.source_hash==source_hash && (h.content & content)==content && h.eps==eps) {
+			read(cache_file);
+			(bool&) from_cache=true;
+			return;
+		}
+	} catch(UnknownFileException&) {
+		// no cache yet
+	} catch(InvalidCache&) {
+		// rewritten below
+	}
+
+	sys = new System(source.data(), source.size());
+	if (content & NORMALIZED) norm = new NormalizedSystem(*sys,eps);
+	if (content & EXTENDED) ext = new ExtendedSystem(*sys,eps);
+
+	try {
+		write(cache_file, *sys, norm, ext, content & DIFF, eps, source_hash);
+	} catch(UnknownFileException&) {
+		ibex_warning("SystemCache: cannot write the cache file");
+	}
+}
+
+void SystemCache::read(const char* cache_file) {
+	MappedFile file(cache_file);
+	const Header& h=read_header(file);
+
+	const char* body=file.data+sizeof(Header);
+	if (hash(body,h.body_size)!=h.body_hash) throw InvalidCache();
+
+	CacheReader r(body,h.body_size);
+
+	try {
+		r.get_table();
+
+		sys = new System();
+		r.get_system(*sys);
+
+		if (h.content & NORMALIZED) {
+			norm = new NormalizedSystem();
+			r.get_system(*norm);
+			norm->_orig_index = new int[norm->nb_ctr];
+			for (int i=0; i<norm->nb_ctr; i++)
+				norm->_orig_index[i]=r.get_index(sys->nb_ctr);
+		}
+
+		if (h.content & EXTENDED) {
+			ext = new ExtendedSystem();
+			r.get_system(*ext);
+		}
+	} catch(InvalidCache&) {
+		r.release(ext);
+		r.release(norm);
+		r.release(sys);
+		r.release();
+		ext=NULL;
+		norm=NULL;
+		sys=NULL;
+		throw;
+	}
+
+	// the file is read: the systems own their functions
+	for (unsigned int i=0; i<r.ctrs.size(); i++)
+		r.ctrs[i]->own_f=true;
+
+	for (unsigned int i=0; i<r.diffs.size(); i++)
+		r.diffs[i].first->df=r.diffs[i].second;
+
+	_content=h.content;
+
+	// the functions only called by other functions
+	for (unsigned int i=0; i<r.table.size(); i++)
+		if (!r.owned[i]) extra.push_back(r.table[i]);
+}
+
+SystemCache::~SystemCache() {
+	if (ext) delete ext;
+	if (norm) delete norm;
+	if (sys) delete sys;
+	for (unsigned int i=0; i<extra.size(); i++)
+		delete extra[i];
+}
+
+} // end namespace ibex
@@ -0,0 +1,192 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_SystemCache.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_SYSTEM_CACHE_H__
+#define __IBEX_SYSTEM_CACHE_H__
+
+#include "ibex_System.h"
+#include "ibex_NormalizedSystem.h"
+#include "ibex_ExtendedSystem.h"
+#include "ibex_Exception.h"
+
+namespace ibex {
+
+/**
+ * \ingroup system
+ *
+ * \brief Binary cache of a system.
+ *
+ * A cache file contains a system in a binary (precompiled) form
+ * and, optionally, its normalized and extended versions
+ * (see #ibex::NormalizedSystem and #ibex::ExtendedSystem) and
+ * the symbolic (first) derivatives of all the functions (see #Function::diff()).
+ *
+ * Loading a cache file rebuilds directly the DAGs of the functions:
+ * there is no parsing, no simplification and no symbolic
+ * differentiation. The file is memory-mapped (when possible).
+ *
+ * The file starts with a versioned header that also stores a hash of
+ * the source text of the system (to detect stale caches) and a hash of
+ * the content.
+ *
+ * Typical usage:
+ * <pre>
+ *    SystemCache cache("ex.bch", "ex.bch.cache", SystemCache::EXTENDED | SystemCache::DIFF);
+ *    ExtendedSystem& ext_sys = cache.extended();
+ * </pre>
+ *
+ * \note The normalized and extended systems may share auxiliary
+ * functions with the original system: the systems are all owned by
+ * the cache object.
+ */
+class SystemCache {
+public:
+
+	/**
+	 * \brief Content of a cache file.
+	 *
+	 * Flags that can be combined with "|".
+	 */
+	typedef enum { NORMALIZED=1, EXTENDED=2, DIFF=4 } content_flag;
+
+	/**
+	 * \brief Load a system file through a cache.
+	 *
+	 * If \a cache_file is a valid cache, built from the
+	 * current contents of \a filename, with at least the
+	 * requested \a content and the same \a eps, the systems
+	 * are loaded from the cache. Otherwise, the system file
+	 * is parsed and the cache file is (re)written.
+	 *
+	 * \param content - The variants to build (see #content_flag).
+	 * \param eps     - The relaxation value of equalities in
+	 *                  the normalized and extended systems.
+	 *
+	 * \throws UnknownFileException, SyntaxError (when parsing).
+	 */
+	SystemCache(const char* filename, const char* cache_file, int content=0, double eps=0);
+
+	/**
+	 * \brief Load a cache file.
+	 *
+	 * The cache is not checked against the source file.
+	 *
+	 * \throws UnknownFileException, SystemCache::InvalidCache.
+	 */
+	explicit SystemCache(const char* cache_file);
+
+	/**
+	 * \brief Delete the systems.
+	 */
+	~SystemCache();
+
+	/**
+	 * \brief Write a system (and its variants) in a cache file.
+	 *
+	 * \param norm, ext    - Normalized/extended versions of \a sys (or NULL).
+	 * \param diff         - If true, the symbolic derivatives are also
+	 *                       written (they are calculated if necessary).
+	 * \param source_hash  - Hash of the source text of \a sys (see #hash)
+	 *                       (0 if unknown).
+	 *
+	 * \warning All the functions called by the expressions (ExprApply)
+	 * must be auxiliary functions of \a sys.
+	 *
+	 * \throws UnknownFileException if the file cannot be created.
+	 */
+	static void write(const char* cache_file, const System& sys,
+			const NormalizedSystem* norm=NULL, const ExtendedSystem* ext=NULL,
+			bool diff=false, double eps=0, unsigned long long source_hash=0);
+
+	/**
+	 * \brief Hash of a text (FNV-1a, 64 bits).
+	 */
+	static unsigned long long hash(const char* text, int size);
+
+	/**
+	 * \brief The system.
+	 */
+	System& system();
+
+	/**
+	 * \brief The normalized system.
+	 *
+	 * \pre content & NORMALIZED.
+	 */
+	NormalizedSystem& normalized();
+
+	/**
+	 * \brief The extended system.
+	 *
+	 * \pre content & EXTENDED.
+	 */
+	ExtendedSystem& extended();
+
+	/**
+	 * \brief The content of this cache (see #content_flag).
+	 */
+	int content() const;
+
+	/**
+	 * \brief True if the systems have been read from the cache file
+	 * (false if the system file had to be parsed).
+	 */
+	const bool from_cache;
+
+	/**
+	 * \brief Version of the file format.
+	 */
+	static const int VERSION;
+
+	/**
+	 * \brief Thrown when a cache file is corrupted or
+	 * was written with another version.
+	 */
+	class InvalidCache : public Exception { };
+
+private:
+	SystemCache(const SystemCache&); // forbidden
+
+	// read the cache file
+	void read(const char* cache_file);
+
+	int _content;
+	System* sys;
+	NormalizedSystem* norm;
+	ExtendedSystem* ext;
+
+	// functions not owned by the systems
+	// (only called by other functions)
+	std::vector<Function*> extra;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline System& SystemCache::system() {
+	return *sys;
+}
+
+inline NormalizedSystem& SystemCache::normalized() {
+	assert(norm);
+	return *norm;
+}
+
+inline ExtendedSystem& SystemCache::extended() {
+	assert(ext);
+	return *ext;
+}
+
+inline int SystemCache::content() const {
+	return _content;
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_SYSTEM_CACHE_H__
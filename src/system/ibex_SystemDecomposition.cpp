@@ -0,0 +1,293 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_SystemDecomposition.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#include "ibex_SystemDecomposition.h"
+#include "ibex_SystemFactory.h"
+#include "ibex_ExprCopy.h"
+#include "ibex_ExprCtr.h"
+
+#include <algorithm>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// the subsystem made of the arguments "args" and the
+// constraints "ctrs" of sys.
+class SystemBlock : public SystemFactory {
+public:
+	SystemBlock(const System& sys, const vector<int>& args, const vector<int>& ctrs) {
+
+		vector<const ExprSymbol*> vars;
+		for (vector<int>::const_iterator it=args.begin(); it!=args.end(); it++)
+			vars.push_back(&sys.args[*it]);
+
+		add_var(Array<const ExprSymbol>(vars));
+
+		// the constraints only involve the arguments of the
+		// block so they can be copied with all the arguments of sys
+		for (vector<int>::const_iterator it=ctrs.begin(); it!=ctrs.end(); it++) {
+			const NumConstraint& c=sys.ctrs[*it];
+			const ExprNode& e=ExprCopy().copy(c.f.args(), sys.args, c.f.expr());
+			add_ctr(ExprCtr(e,c.op));
+			cleanup(e, false);
+		}
+	}
+};
+
+// union-find
+int find(vector<int>& parent, int i) {
+	while (parent[i]!=i) {
+		parent[i]=parent[parent[i]];
+		i=parent[i];
+	}
+	return i;
+}
+
+// augmenting path (for the maximum matching) from the equation e
+bool augment(const vector<vector<int> >& eq_vars, int e, vector<int>& var_of, vector<int>& eq_of, vector<int>& seen, int stamp) {
+	for (vector<int>::const_iterator it=eq_vars[e].begin(); it!=eq_vars[e].end(); it++) {
+		int v=*it;
+		if (seen[v]==stamp) continue;
+		seen[v]=stamp;
+		if (eq_of[v]==-1 || augment(eq_vars, eq_of[v], var_of, eq_of, seen, stamp)) {
+			eq_of[v]=e;
+			var_of[e]=v;
+			return true;
+		}
+	}
+	return false;
+}
+
+// Strongly connected components of the square part. There is an
+// arc e->e' if e involves the variable matched to e'. The components
+// are found in reverse topological order, i.e., a component is found
+// after all the components it depends on.
+class Tarjan {
+public:
+	Tarjan(const vector<vector<int> >& eq_vars, const vector<int>& eq_of, const vector<bool>& square) :
+		eq_vars(eq_vars), eq_of(eq_of), square(square),
+		index(eq_vars.size(),-1), low(eq_vars.size()), on_stack(eq_vars.size(),false), count(0) {
+
+		for (unsigned int e=0; e<eq_vars.size(); e++)
+			if (square[e] && index[e]==-1) visit(e);
+	}
+
+	std::vector<std::vector<int> > comps;
+
+private:
+	void visit(int e) {
+		index[e]=low[e]=count++;
+		stack.push_back(e);
+		on_stack[e]=true;
+
+		for (vector<int>::const_iterator it=eq_vars[e].begin(); it!=eq_vars[e].end(); it++) {
+			int e2=eq_of[*it];
+			if (e2==-1 || e2==e || !square[e2]) continue;
+			if (index[e2]==-1) {
+				visit(e2);
+				low[e]=std::min(low[e],low[e2]);
+			} else if (on_stack[e2])
+				low[e]=std::min(low[e],index[e2]);
+		}
+
+		if (low[e]==index[e]) {
+			comps.push_back(vector<int>());
+			int e2;
+			do {
+				e2=stack.back();
+				stack.pop_back();
+				on_stack[e2]=false;
+				comps.back().push_back(e2);
+			} while (e2!=e);
+		}
+	}
+
+	const vector<vector<int> >& eq_vars;
+	const vector<int>& eq_of;
+	const vector<bool>& square;
+	vector<int> index;
+	vector<int> low;
+	vector<bool> on_stack;
+	vector<int> stack;
+	int count;
+};
+
+}
+
+SystemDecomposition::SystemDecomposition(const System& sys) : sys(sys) {
+
+	int nb_arg=sys.args.size();
+
+	// arg[i]: the argument of the ith variable
+	vector<int> arg(sys.nb_var);
+	vector<int> first_var(nb_arg);
+	for (int a=0, i=0; a<nb_arg; a++) {
+		first_var[a]=i;
+		for (int j=0; j<sys.args[a].dim.size(); j++)
+			arg[i++]=a;
+	}
+
+	// ============ connected components of the arguments =============
+	vector<int> parent(nb_arg);
+	for (int a=0; a<nb_arg; a++) parent[a]=a;
+
+	for (int c=0; c<sys.nb_ctr; c++) {
+		const Function& f=sys.ctrs[c].f;
+		// a constraint with no variable is put in the block of the first argument
+		int root=find(parent, f.nb_used_vars()>0 ? arg[f.used_var(0)] : 0);
+		for (int k=1; k<f.nb_used_vars(); k++) {
+			int r=find(parent, arg[f.used_var(k)]);
+			if (r!=root) parent[r]=root;
+		}
+	}
+
+	// ============ the blocks, by order of their first constraint ============
+	vector<int> block(nb_arg,-1);
+	for (int c=0; c<sys.nb_ctr; c++) {
+		const Function& f=sys.ctrs[c].f;
+		int root=find(parent, f.nb_used_vars()>0 ? arg[f.used_var(0)] : 0);
+		if (block[root]==-1) {
+			block[root]=_ctrs.size();
+			_ctrs.push_back(vector<int>());
+		}
+		_ctrs[block[root]].push_back(c);
+	}
+
+	vector<vector<int> > args(_ctrs.size());
+	_vars.resize(_ctrs.size());
+
+	for (int a=0; a<nb_arg; a++) {
+		int b=block[find(parent,a)];
+		for (int j=0; j<sys.args[a].dim.size(); j++)
+			(b==-1 ? _free_vars : _vars[b]).push_back(first_var[a]+j);
+		if (b!=-1) args[b].push_back(a);
+	}
+
+	for (unsigned int b=0; b<_ctrs.size(); b++) {
+		System* s=new System(SystemBlock(sys, args[b], _ctrs[b]));
+		s->box=project(b, sys.box);
+		blocks.push_back(s);
+	}
+
+	btf();
+}
+
+void SystemDecomposition::btf() {
+
+	// ============ the equations (components of sys.f) ============
+	vector<int> eqs;
+	for (int c=0, i=0; c<sys.nb_ctr; c++) {
+		int n=sys.ctrs[c].f.image_dim();
+		if (sys.ctrs[c].op==EQ)
+			for (int j=0; j<n; j++) eqs.push_back(i+j);
+		i+=n;
+	}
+
+	int m=eqs.size();
+	vector<vector<int> > eq_vars(m);
+	vector<vector<int> > var_eqs(sys.nb_var);
+	for (int e=0; e<m; e++) {
+		const Function& f=sys.f[eqs[e]];
+		for (int k=0; k<f.nb_used_vars(); k++) {
+			eq_vars[e].push_back(f.used_var(k));
+			var_eqs[f.used_var(k)].push_back(e);
+		}
+	}
+
+	// ============ maximum matching ============
+	vector<int> var_of(m,-1);          // variable matched to each equation
+	vector<int> eq_of(sys.nb_var,-1);  // equation matched to each variable
+	vector<int> seen(sys.nb_var,-1);
+	for (int e=0; e<m; e++)
+		augment(eq_vars, e, var_of, eq_of, seen, e);
+
+	// ============ coarse decomposition ============
+	// over-determined part: reachable from an unmatched equation
+	// (by any edge from an equation, by the matching from a variable)
+	vector<bool> over_eq(m,false), over_var(sys.nb_var,false);
+	vector<int> queue;
+	for (int e=0; e<m; e++)
+		if (var_of[e]==-1) { over_eq[e]=true; queue.push_back(e); }
+	while (!queue.empty()) {
+		int e=queue.back(); queue.pop_back();
+		for (vector<int>::const_iterator it=eq_vars[e].begin(); it!=eq_vars[e].end(); it++) {
+			if (over_var[*it]) continue;
+			over_var[*it]=true;
+			int e2=eq_of[*it]; // matched (the matching is maximum)
+			if (!over_eq[e2]) { over_eq[e2]=true; queue.push_back(e2); }
+		}
+	}
+
+	// under-determined part: reachable from an unmatched variable
+	// (by any edge from a variable, by the matching from an equation)
+	vector<bool> under_eq(m,false), under_var(sys.nb_var,false);
+	vector<int> vqueue;
+	for (int v=0; v<sys.nb_var; v++)
+		if (eq_of[v]==-1) { under_var[v]=true; vqueue.push_back(v); }
+	while (!vqueue.empty()) {
+		int v=vqueue.back(); vqueue.pop_back();
+		for (vector<int>::const_iterator it=var_eqs[v].begin(); it!=var_eqs[v].end(); it++) {
+			if (under_eq[*it]) continue;
+			under_eq[*it]=true;
+			int v2=var_of[*it]; // matched (the matching is maximum)
+			if (!under_var[v2]) { under_var[v2]=true; vqueue.push_back(v2); }
+		}
+	}
+
+	for (int e=0; e<m; e++) {
+		if (over_eq[e]) _over_eqs.push_back(eqs[e]);
+		else if (under_eq[e]) _under_eqs.push_back(eqs[e]);
+	}
+	for (int v=0; v<sys.nb_var; v++) {
+		if (over_var[v]) _over_vars.push_back(v);
+		else if (under_var[v]) _under_vars.push_back(v);
+	}
+
+	// ============ fine decomposition of the square part ============
+	vector<bool> square(m);
+	for (int e=0; e<m; e++) square[e]=!over_eq[e] && !under_eq[e];
+
+	Tarjan tarjan(eq_vars, eq_of, square);
+
+	for (vector<vector<int> >::iterator it=tarjan.comps.begin(); it!=tarjan.comps.end(); it++) {
+		sort(it->begin(), it->end());
+		_btf_eqs.push_back(vector<int>());
+		_btf_vars.push_back(vector<int>());
+		for (vector<int>::const_iterator e=it->begin(); e!=it->end(); e++) {
+			_btf_eqs.back().push_back(eqs[*e]);
+			_btf_vars.back().push_back(var_of[*e]);
+		}
+	}
+}
+
+SystemDecomposition::~SystemDecomposition() {
+	for (vector<System*>::iterator it=blocks.begin(); it!=blocks.end(); it++)
+		delete *it;
+}
+
+IntervalVector SystemDecomposition::project(int k, const IntervalVector& box) const {
+	const vector<int>& v=_vars[k];
+	IntervalVector x(v.size());
+	for (unsigned int i=0; i<v.size(); i++)
+		x[i]=box[v[i]];
+	return x;
+}
+
+void SystemDecomposition::lift(int k, const IntervalVector& x, IntervalVector& box) const {
+	const vector<int>& v=_vars[k];
+	assert(x.size()==(int) v.size());
+	for (unsigned int i=0; i<v.size(); i++)
+		box[v[i]]=x[i];
+}
+
+} // end namespace ibex
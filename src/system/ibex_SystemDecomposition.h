@@ -0,0 +1,228 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_SystemDecomposition.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 19, 2026
+// Last Update : Oct 19, 2026
+//============================================================================
+
+#ifndef __IBEX_SYSTEM_DECOMPOSITION_H__
+#define __IBEX_SYSTEM_DECOMPOSITION_H__
+
+#include "ibex_System.h"
+
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \ingroup system
+ *
+ * \brief Decomposition of a system into independent blocks.
+ *
+ * The blocks are the connected components of the constraint-variable
+ * hypergraph: two constraints are in the same block if they share a
+ * variable (directly or through other constraints). Each block is a
+ * stand-alone system, so that the blocks can be solved separately: the
+ * solution set of the original system is the Cartesian product of the
+ * solution sets of the blocks.
+ *
+ * The granularity is the argument: a vector (or matrix) argument
+ * is not split, even if its components appear in independent constraints.
+ *
+ * The variables that appear in no constraint belong to no block
+ * (see #free_vars()). The goal function (if any) is ignored.
+ *
+ * The equations are also put in block-triangular form (Dulmage-Mendelsohn
+ * decomposition). The bipartite graph links each equation, i.e., each
+ * component of sys.f that belongs to an equality constraint, to the
+ * variables it involves. A maximum matching of this graph splits it into:
+ * - an over-determined part (more equations than variables),
+ *   see #over_eqs() and #over_vars(),
+ * - a square part, split into irreducible diagonal blocks (the strongly
+ *   connected components of the graph oriented by the matching),
+ *   see #nb_btf_blocks(), #btf_eqs(int) and #btf_vars(int),
+ * - an under-determined part (more variables than equations),
+ *   see #under_eqs() and #under_vars().
+ *
+ * In this order, the equations of each part (or diagonal block) only
+ * involve its variables and the variables of the previous parts (or blocks):
+ * the diagonal blocks can be solved one after the other. Contrary to the
+ * independent blocks, they are not solved separately by #ibex::BlockSolver:
+ * a diagonal block would have to be solved again for each solution of
+ * the blocks it depends on.
+ */
+class SystemDecomposition {
+public:
+	/**
+	 * \brief Decompose \a sys.
+	 */
+	SystemDecomposition(const System& sys);
+
+	/**
+	 * \brief Delete this.
+	 */
+	~SystemDecomposition();
+
+	/**
+	 * \brief Number of blocks.
+	 */
+	int nb_blocks() const;
+
+	/**
+	 * \brief The kth block.
+	 *
+	 * The initial box of the block is the restriction of sys.box.
+	 */
+	System& operator[](int k);
+
+	/**
+	 * \brief The variables of the kth block.
+	 *
+	 * The ith variable of the kth block is the variable
+	 * vars(k)[i] of the original system.
+	 */
+	const std::vector<int>& vars(int k) const;
+
+	/**
+	 * \brief The constraints of the kth block.
+	 *
+	 * The ith constraint of the kth block is the constraint
+	 * ctrs(k)[i] of the original system.
+	 */
+	const std::vector<int>& ctrs(int k) const;
+
+	/**
+	 * \brief The variables that appear in no constraint.
+	 */
+	const std::vector<int>& free_vars() const;
+
+	/**
+	 * \brief Number of diagonal blocks of the block-triangular form.
+	 */
+	int nb_btf_blocks() const;
+
+	/**
+	 * \brief The equations of the kth diagonal block.
+	 *
+	 * The equations are the indices of the components of sys.f.
+	 * The kth diagonal block has as many equations as variables.
+	 */
+	const std::vector<int>& btf_eqs(int k) const;
+
+	/**
+	 * \brief The variables of the kth diagonal block.
+	 *
+	 * The ith variable is matched to the ith equation.
+	 */
+	const std::vector<int>& btf_vars(int k) const;
+
+	/**
+	 * \brief The equations of the over-determined part.
+	 */
+	const std::vector<int>& over_eqs() const;
+
+	/**
+	 * \brief The variables of the over-determined part.
+	 */
+	const std::vector<int>& over_vars() const;
+
+	/**
+	 * \brief The equations of the under-determined part.
+	 */
+	const std::vector<int>& under_eqs() const;
+
+	/**
+	 * \brief The variables of the under-determined part.
+	 *
+	 * This includes the variables that appear in no equation.
+	 */
+	const std::vector<int>& under_vars() const;
+
+	/**
+	 * \brief Restriction of a box to the variables of the kth block.
+	 */
+	IntervalVector project(int k, const IntervalVector& box) const;
+
+	/**
+	 * \brief Set the variables of the kth block in \a box to \a x.
+	 */
+	void lift(int k, const IntervalVector& x, IntervalVector& box) const;
+
+	/**
+	 * \brief The original system.
+	 */
+	const System& sys;
+
+private:
+	SystemDecomposition(const SystemDecomposition&); // forbidden
+
+	// Dulmage-Mendelsohn decomposition of the equations
+	void btf();
+
+	std::vector<System*> blocks;
+	std::vector<std::vector<int> > _vars;
+	std::vector<std::vector<int> > _ctrs;
+	std::vector<int> _free_vars;
+	std::vector<std::vector<int> > _btf_eqs;
+	std::vector<std::vector<int> > _btf_vars;
+	std::vector<int> _over_eqs;
+	std::vector<int> _over_vars;
+	std::vector<int> _under_eqs;
+	std::vector<int> _under_vars;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline int SystemDecomposition::nb_blocks() const {
+	return blocks.size();
+}
+
+inline System& SystemDecomposition::operator[](int k) {
+	return *blocks[k];
+}
+
+inline const std::vector<int>& SystemDecomposition::vars(int k) const {
+	return _vars[k];
+}
+
+inline const std::vector<int>& SystemDecomposition::ctrs(int k) const {
+	return _ctrs[k];
+}
+
+inline const std::vector<int>& SystemDecomposition::free_vars() const {
+	return _free_vars;
+}
+
+inline int SystemDecomposition::nb_btf_blocks() const {
+	return _btf_eqs.size();
+}
+
+inline const std::vector<int>& SystemDecomposition::btf_eqs(int k) const {
+	return _btf_eqs[k];
+}
+
+inline const std::vector<int>& SystemDecomposition::btf_vars(int k) const {
+	return _btf_vars[k];
+}
+
+inline const std::vector<int>& SystemDecomposition::over_eqs() const {
+	return _over_eqs;
+}
+
+inline const std::vector<int>& SystemDecomposition::over_vars() const {
+	return _over_vars;
+}
+
+inline const std::vector<int>& SystemDecomposition::under_eqs() const {
+	return _under_eqs;
+}
+
+inline const std::vector<int>& SystemDecomposition::under_vars() const {
+	return _under_vars;
+}
+
+} // end namespace ibex
+#endif // __IBEX_SYSTEM_DECOMPOSITION_H__
@@ -12,6 +12,7 @@
 #include "ibex_Exception.h"
 #include "ibex_ExprCtr.h"
 #include "ibex_ExprCopy.h"
+#include "ibex_ExprSimplify.h"
 #include "ibex_EmptySystemException.h"
 
 using std::vector;
@@ -104,6 +105,11 @@ void System::init_f_from_ctrs() {
 	Array<const ExprNode> image(total_output_size);
 	int i=0;
 
+	// the components are first built with temporary
+	// symbols and then simplified (see below).
+	Array<const ExprSymbol> x(args.size());
+	varcopy(args,x);
+
 	// concatenate all the components of all the constraints function
 	for (int j=0; j<ctrs.size(); j++) {
 		Function& fj=ctrs[j].f;
@@ -132,7 +138,7 @@ void System::init_f_from_ctrs() {
 		 * instead of
 		 *    x[0]=0 and x[1]=1.
 		 */
-		const ExprNode& e=ExprCopy().copy(fj.args(), args, fj.expr());
+		const ExprNode& e=ExprCopy().copy(fj.args(), x, fj.expr());
 
 		const Dim& fjd=fj.expr().dim;
 		switch (fjd.type()) {
@@ -160,7 +166,17 @@ void System::init_f_from_ctrs() {
 
 	// TODO: we should probably homgenize; in the case of a scalar function
 	// a 1-sized vector should be created.
-	f.init(args, total_output_size>1? ExprVector::new_(image,false) : image[0]);
+	const ExprNode& y=total_output_size>1? ExprVector::new_(image,false) : image[0];
+
+	// Merge the subexpressions shared by several constraints and
+	// remove trivial nodes. This also replaces the indexed
+	// vectors (e_0,e_1,...)[k] created above by e_k.
+	const ExprNode& y2=ExprSimplify().simplify(x, args, y);
+	cleanup(y,false);
+	for (int k=0; k<x.size(); k++)
+		delete &x[k];
+
+	f.init(args, y2);
 }
 
 
@@ -51,9 +51,19 @@ public:
 
 	/**
 	 * \brief Increments the size of the array by 1 and add the new element.
+	 *
+	 * Amortized constant time.
 	 */
 	void add(T& obj);
 
+	/**
+	 * \brief Reserve memory for \a n references.
+	 *
+	 * The size is unchanged. Adding elements up to this
+	 * number does not reallocate the array.
+	 */
+	void reserve(int n);
+
 	/**
 	 * \brief Set the ith reference to the object \a obj.
 	 */
@@ -217,6 +227,9 @@ protected:
 
 	/** Array of sub-Ts */
 	T** array;
+
+	/** Number of allocated references (>=_nb) */
+	int _cap;
 private:
 	T& operator=(const Array<T>&); //forbidden
 };
@@ -225,12 +238,12 @@ private:
 /*================================== inline implementations ========================================*/
 
 template<class T>
-Array<T>::Array() : _nb(0), array(NULL) {
+Array<T>::Array() : _nb(0), array(NULL), _cap(0) {
 
 }
 
 template<class T>
-Array<T>::Array(int n) : _nb(n), array(new T*[n]) {
+Array<T>::Array(int n) : _nb(n), array(new T*[n]), _cap(n) {
 	assert(n>=0);
 	for (int i=0; i<_nb; i++) {
 		array[i] = NULL;
@@ -240,18 +253,28 @@ Array<T>::Array(int n) : _nb(n), array(new T*[n]) {
 template<class T>
 void Array<T>::resize(int n) {
 	assert(n>=0);
-	T** new_array=new T*[n];
-	int i=0;
+	if (n>_cap) reserve(n);
+	int i=n;
 	for (; i<_nb; i++) {
-		if (i<n) new_array[i] = array[i];
-		else if (array[i]) delete array[i];
+		if (array[i]) delete array[i];
+		array[i]=NULL;
 	}
-	for (; i<n; i++) {
-		new_array[i]=NULL;
+	for (i=_nb; i<n; i++) {
+		array[i]=NULL;
+	}
+	_nb=n;
+}
+
+template<class T>
+void Array<T>::reserve(int n) {
+	if (n<=_cap) return;
+	T** new_array=new T*[n];
+	for (int i=0; i<_nb; i++) {
+		new_array[i] = array[i];
 	}
 	if (array) delete[] array;
 	array=new_array;
-	_nb=n;
+	_cap=n;
 }
 
 template<class T>
@@ -264,12 +287,13 @@ void Array<T>::set_ref(int i, T& obj) {
 
 template<class T>
 void Array<T>::add(T& obj) {
+	if (_nb==_cap) reserve(_cap>0? 2*_cap : 1);
 	resize(size()+1);
 	set_ref(size()-1,obj);
 }
 
 template<class T>
-Array<T>::Array(T** a, int n) : _nb(n), array(new T*[n]) {
+Array<T>::Array(T** a, int n) : _nb(n), array(new T*[n]), _cap(n) {
 	assert(n>=0);
 	for (int i=0; i<_nb; i++) {
 		array[i] = a[i];
@@ -277,7 +301,7 @@ Array<T>::Array(T** a, int n) : _nb(n), array(new T*[n]) {
 }
 
 template<class T>
-Array<T>::Array(const std::vector<T*>& vec) : _nb(vec.size()), array(new T*[vec.size()]) {
+Array<T>::Array(const std::vector<T*>& vec) : _nb(vec.size()), array(new T*[vec.size()]), _cap(vec.size()) {
 
 	assert(vec.size()>0);
 	int i=0;
@@ -287,25 +311,25 @@ Array<T>::Array(const std::vector<T*>& vec) : _nb(vec.size()), array(new T*[vec.
 }
 
 template<class T>
-Array<T>::Array(T& x) : _nb(1), array(new T*[1]) {
+Array<T>::Array(T& x) : _nb(1), array(new T*[1]), _cap(1) {
 	array[0] = &x;
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2) : _nb(2), array(new T*[2]) {
+Array<T>::Array(T& x1, T& x2) : _nb(2), array(new T*[2]), _cap(2) {
 	array[0] = &x1;
 	array[1] = &x2;
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3) : _nb(3), array(new T*[3]) {
+Array<T>::Array(T& x1, T& x2, T& x3) : _nb(3), array(new T*[3]), _cap(3) {
 	array[0] = &x1;
 	array[1] = &x2;
 	array[2] = &x3;
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3, T& x4) : _nb(4), array(new T*[4]) {
+Array<T>::Array(T& x1, T& x2, T& x3, T& x4) : _nb(4), array(new T*[4]), _cap(4) {
 	array[0] = &x1;
 	array[1] = &x2;
 	array[2] = &x3;
@@ -313,7 +337,7 @@ Array<T>::Array(T& x1, T& x2, T& x3, T& x4) : _nb(4), array(new T*[4]) {
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5) : _nb(5), array(new T*[5]) {
+Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5) : _nb(5), array(new T*[5]), _cap(5) {
 	array[0] = &x1;
 	array[1] = &x2;
 	array[2] = &x3;
@@ -322,7 +346,7 @@ Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5) : _nb(5), array(new T*[5]) {
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6) : _nb(6), array(new T*[6]) {
+Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6) : _nb(6), array(new T*[6]), _cap(6) {
 	array[0] = &x1;
 	array[1] = &x2;
 	array[2] = &x3;
@@ -332,7 +356,7 @@ Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6) : _nb(6), array(new T*
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7) : _nb(7), array(new T*[7]) {
+Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7) : _nb(7), array(new T*[7]), _cap(7) {
 	array[0] = &x1;
 	array[1] = &x2;
 	array[2] = &x3;
@@ -343,7 +367,7 @@ Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7) : _nb(7), array
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8) : _nb(8), array(new T*[8]) {
+Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8) : _nb(8), array(new T*[8]), _cap(8) {
 	array[0] = &x1;
 	array[1] = &x2;
 	array[2] = &x3;
@@ -355,7 +379,7 @@ Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8) : _nb(8)
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9) : _nb(9), array(new T*[9]) {
+Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9) : _nb(9), array(new T*[9]), _cap(9) {
 	array[0] = &x1;
 	array[1] = &x2;
 	array[2] = &x3;
@@ -368,7 +392,7 @@ Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9) :
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10) : _nb(10), array(new T*[10]) {
+Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10) : _nb(10), array(new T*[10]), _cap(10) {
 	array[0]  = &x1;
 	array[1]  = &x2;
 	array[2]  = &x3;
@@ -382,7 +406,7 @@ Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11) : _nb(11), array(new T*[11]) {
+Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11) : _nb(11), array(new T*[11]), _cap(11) {
 	array[0]  = &x1;
 	array[1]  = &x2;
 	array[2]  = &x3;
@@ -397,7 +421,7 @@ Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12) : _nb(12), array(new T*[12]) {
+Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12) : _nb(12), array(new T*[12]), _cap(12) {
 	array[0]  = &x1;
 	array[1]  = &x2;
 	array[2]  = &x3;
@@ -413,7 +437,7 @@ Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12, T& x13) : _nb(13), array(new T*[13]) {
+Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12, T& x13) : _nb(13), array(new T*[13]), _cap(13) {
 	array[0]  = &x1;
 	array[1]  = &x2;
 	array[2]  = &x3;
@@ -430,7 +454,7 @@ Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12, T& x13, T& x14) : _nb(14), array(new T*[14]) {
+Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12, T& x13, T& x14) : _nb(14), array(new T*[14]), _cap(14) {
 	array[0]  = &x1;
 	array[1]  = &x2;
 	array[2]  = &x3;
@@ -448,7 +472,7 @@ Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12, T& x13, T& x14, T& x15) : _nb(15), array(new T*[15]) {
+Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12, T& x13, T& x14, T& x15) : _nb(15), array(new T*[15]), _cap(15) {
 	array[0]  = &x1;
 	array[1]  = &x2;
 	array[2]  = &x3;
@@ -467,7 +491,7 @@ Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12, T& x13, T& x14, T& x15, T& x16) : _nb(16), array(new T*[16]) {
+Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12, T& x13, T& x14, T& x15, T& x16) : _nb(16), array(new T*[16]), _cap(16) {
 	array[0]  = &x1;
 	array[1]  = &x2;
 	array[2]  = &x3;
@@ -487,7 +511,7 @@ Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12, T& x13, T& x14, T& x15, T& x16, T& x17) : _nb(17), array(new T*[17]) {
+Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12, T& x13, T& x14, T& x15, T& x16, T& x17) : _nb(17), array(new T*[17]), _cap(17) {
 	array[0]  = &x1;
 	array[1]  = &x2;
 	array[2]  = &x3;
@@ -508,7 +532,7 @@ Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12, T& x13, T& x14, T& x15, T& x16, T& x17, T& x18) : _nb(18), array(new T*[18]) {
+Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12, T& x13, T& x14, T& x15, T& x16, T& x17, T& x18) : _nb(18), array(new T*[18]), _cap(18) {
 	array[0]  = &x1;
 	array[1]  = &x2;
 	array[2]  = &x3;
@@ -530,7 +554,7 @@ Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12, T& x13, T& x14, T& x15, T& x16, T& x17, T& x18, T& x19) : _nb(19), array(new T*[19]) {
+Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12, T& x13, T& x14, T& x15, T& x16, T& x17, T& x18, T& x19) : _nb(19), array(new T*[19]), _cap(19) {
 	array[0]  = &x1;
 	array[1]  = &x2;
 	array[2]  = &x3;
@@ -553,7 +577,7 @@ Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12, T& x13, T& x14, T& x15, T& x16, T& x17, T& x18, T& x19, T& x20) : _nb(20), array(new T*[20]) {
+Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12, T& x13, T& x14, T& x15, T& x16, T& x17, T& x18, T& x19, T& x20) : _nb(20), array(new T*[20]), _cap(20) {
 	array[0]  = &x1;
 	array[1]  = &x2;
 	array[2]  = &x3;
@@ -577,7 +601,7 @@ Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T
 }
 
 template<class T>
-Array<T>::Array(const Array<T>& a) : _nb(a.size()), array(new T*[a.size()]) {
+Array<T>::Array(const Array<T>& a) : _nb(a.size()), array(new T*[a.size()]), _cap(a.size()) {
 	for (int i=0; i<_nb; i++) {
 		array[i] = &a[i];
 	}
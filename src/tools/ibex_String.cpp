@@ -15,10 +15,19 @@ namespace ibex {
 
 #ifdef _MSC_VER
 #define SNPRINTF _snprintf
+#define THREAD_LOCAL __declspec(thread)
 #else
 #define SNPRINTF snprintf
+#define THREAD_LOCAL __thread
 #endif // _MSC_VER
 
+// names can be generated by different threads (e.g., by the parser)
+#ifdef __GNUC__
+#define NEXT_COUNT(count) __sync_fetch_and_add(&count,1)
+#else
+#define NEXT_COUNT(count) count++
+#endif
+
 char* append_index(const char* buff, char lbracket, char rbracket, int index) {
 	assert(index<1000000);
 	char number[6];
@@ -42,7 +51,7 @@ char* append_index(const char* buff, char lbracket, char rbracket, int index) {
 
 
 static char* next_generated_name(const char* base, int num) {
-	static char generated_name_buff[MAX_NAME_SIZE];
+	static THREAD_LOCAL char generated_name_buff[MAX_NAME_SIZE];
 	sprintf(generated_name_buff, base);
 	SNPRINTF(&generated_name_buff[strlen(base)], MAX_NAME_SIZE-strlen(base), "%d", num);
 	return generated_name_buff;
@@ -50,12 +59,12 @@ static char* next_generated_name(const char* base, int num) {
 
 char* next_generated_var_name() {
 	static int generated_var_count=0;
-	return next_generated_name(BASE_VAR_NAME,generated_var_count++);
+	return next_generated_name(BASE_VAR_NAME,NEXT_COUNT(generated_var_count));
 }
 
 char* next_generated_func_name() {
 	static int generated_func_count=0;
-	return next_generated_name(BASE_FUNC_NAME,generated_func_count++);
+	return next_generated_name(BASE_FUNC_NAME,NEXT_COUNT(generated_func_count));
 }
 
 
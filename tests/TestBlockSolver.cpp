@@ -0,0 +1,214 @@
+/* ============================================================================
+ * I B E X - Block Solver Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestBlockSolver.h"
+#include "ibex_SystemFactory.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// two blocks {x,y} and {z,w}, with 2 solutions each,
+// and a free variable v.
+System* sysex1() {
+	SystemFactory fac;
+	Variable x("x"),y("y"),v("v"),z("z"),w("w");
+	fac.add_var(x);
+	fac.add_var(y);
+	fac.add_var(v);
+	fac.add_var(z);
+	fac.add_var(w);
+	fac.add_ctr(sqr(x)+sqr(y)=2);
+	fac.add_ctr(sqr(z)=4);
+	fac.add_ctr(x-y=0);
+	fac.add_ctr(w-z=1);
+	System* sys=new System(fac);
+	sys->box=IntervalVector(5,Interval(-10,10));
+	return sys;
+}
+
+}
+
+void TestBlockSolver::decompose01() {
+	System* sys=sysex1();
+	SystemDecomposition dec(*sys);
+
+	TEST_ASSERT(dec.nb_blocks()==2);
+
+	TEST_ASSERT(dec.vars(0).size()==2);
+	TEST_ASSERT(dec.vars(0)[0]==0);
+	TEST_ASSERT(dec.vars(0)[1]==1);
+	TEST_ASSERT(dec.vars(1).size()==2);
+	TEST_ASSERT(dec.vars(1)[0]==3);
+	TEST_ASSERT(dec.vars(1)[1]==4);
+	TEST_ASSERT(dec.free_vars().size()==1);
+	TEST_ASSERT(dec.free_vars()[0]==2);
+
+	TEST_ASSERT(dec.ctrs(0).size()==2);
+	TEST_ASSERT(dec.ctrs(0)[0]==0);
+	TEST_ASSERT(dec.ctrs(0)[1]==2);
+	TEST_ASSERT(dec.ctrs(1).size()==2);
+	TEST_ASSERT(dec.ctrs(1)[0]==1);
+	TEST_ASSERT(dec.ctrs(1)[1]==3);
+
+	for (int k=0; k<2; k++) {
+		TEST_ASSERT(dec[k].nb_var==2);
+		TEST_ASSERT(dec[k].nb_ctr==2);
+		TEST_ASSERT(dec[k].box==IntervalVector(2,Interval(-10,10)));
+	}
+
+	// the constraints of the blocks are the same as the original ones
+	IntervalVector box(5);
+	box[0]=Interval(1,2);
+	box[1]=Interval(3,4);
+	box[2]=Interval(5,6);
+	box[3]=Interval(7,8);
+	box[4]=Interval(9,10);
+	for (int k=0; k<2; k++) {
+		for (int c=0; c<2; c++) {
+			TEST_ASSERT(dec[k].ctrs[c].f.eval(dec.project(k,box))==sys->ctrs[dec.ctrs(k)[c]].f.eval(box));
+		}
+	}
+
+	IntervalVector box2(5,Interval(0,0));
+	dec.lift(1,dec.project(1,box),box2);
+	TEST_ASSERT(box2[0]==Interval(0,0));
+	TEST_ASSERT(box2[3]==Interval(7,8));
+	TEST_ASSERT(box2[4]==Interval(9,10));
+
+	delete sys;
+}
+
+void TestBlockSolver::decompose02() {
+	// a vector argument is not split
+	SystemFactory fac;
+	Variable x(3,"x"),y("y");
+	fac.add_var(x);
+	fac.add_var(y);
+	fac.add_ctr(x[0]=1);
+	fac.add_ctr(x[2]=2);
+	fac.add_ctr(sqr(y)=3);
+	System sys(fac);
+	SystemDecomposition dec(sys);
+
+	TEST_ASSERT(dec.nb_blocks()==2);
+	TEST_ASSERT(dec.vars(0).size()==3);
+	TEST_ASSERT(dec.vars(1).size()==1);
+	TEST_ASSERT(dec.vars(1)[0]==3);
+	TEST_ASSERT(dec.free_vars().empty());
+	TEST_ASSERT(dec[0].nb_ctr==2);
+}
+
+void TestBlockSolver::btf01() {
+	SystemFactory fac;
+	Variable x(6,"x");
+	fac.add_var(x);
+	fac.add_ctr(x[0]=1);
+	fac.add_ctr(x[0]+x[1]+x[2]=0);
+	fac.add_ctr(x[1]-x[2]=x[0]);
+	fac.add_ctr(x[3]<=1);           // not an equation
+	fac.add_ctr(x[3]+x[4]=x[2]);    // under-determined
+	fac.add_ctr(x[5]=1);            // over-determined
+	fac.add_ctr(sqr(x[5])=2);
+	System sys(fac);
+	SystemDecomposition dec(sys);
+
+	TEST_ASSERT(dec.nb_btf_blocks()==2);
+	TEST_ASSERT(dec.btf_eqs(0).size()==1);
+	TEST_ASSERT(dec.btf_eqs(0)[0]==0);
+	TEST_ASSERT(dec.btf_vars(0).size()==1);
+	TEST_ASSERT(dec.btf_vars(0)[0]==0);
+	TEST_ASSERT(dec.btf_eqs(1).size()==2);
+	TEST_ASSERT(dec.btf_eqs(1)[0]==1);
+	TEST_ASSERT(dec.btf_eqs(1)[1]==2);
+	TEST_ASSERT(dec.btf_vars(1).size()==2);
+	TEST_ASSERT(dec.btf_vars(1)[0]+dec.btf_vars(1)[1]==3);
+
+	TEST_ASSERT(dec.over_eqs().size()==2);
+	TEST_ASSERT(dec.over_eqs()[0]==5);
+	TEST_ASSERT(dec.over_eqs()[1]==6);
+	TEST_ASSERT(dec.over_vars().size()==1);
+	TEST_ASSERT(dec.over_vars()[0]==5);
+
+	TEST_ASSERT(dec.under_eqs().size()==1);
+	TEST_ASSERT(dec.under_eqs()[0]==4);
+	TEST_ASSERT(dec.under_vars().size()==2);
+	TEST_ASSERT(dec.under_vars()[0]==3);
+	TEST_ASSERT(dec.under_vars()[1]==4);
+}
+
+void TestBlockSolver::btf02() {
+	// components of a vector constraint, in triangular order
+	SystemFactory fac;
+	Variable x(2,"x"),y("y");
+	fac.add_var(x);
+	fac.add_var(y);
+	fac.add_ctr(sqr(y)<=1);
+	const ExprNode& e=ExprVector::new_(x[0]-y,x[1]-x[0],false);
+	fac.add_ctr(e=IntervalVector(2,0));
+	fac.add_ctr(y=1);
+	System sys(fac);
+	SystemDecomposition dec(sys);
+
+	TEST_ASSERT(dec.nb_btf_blocks()==3);
+	TEST_ASSERT(dec.btf_eqs(0)[0]==3);
+	TEST_ASSERT(dec.btf_vars(0)[0]==2);
+	TEST_ASSERT(dec.btf_eqs(1)[0]==1);
+	TEST_ASSERT(dec.btf_vars(1)[0]==0);
+	TEST_ASSERT(dec.btf_eqs(2)[0]==2);
+	TEST_ASSERT(dec.btf_vars(2)[0]==1);
+	TEST_ASSERT(dec.over_eqs().empty());
+	TEST_ASSERT(dec.under_vars().empty());
+}
+
+void TestBlockSolver::solve01() {
+	System* sys=sysex1();
+	BlockSolver s(*sys,1e-6);
+
+	vector<IntervalVector> sols=s.solve(sys->box);
+
+	TEST_ASSERT(s.block_sols(0).size()==2);
+	TEST_ASSERT(s.block_sols(1).size()==2);
+	TEST_ASSERT(s.nb_sols()==4);
+	TEST_ASSERT(sols.size()==4);
+
+	// all the combinations
+	for (unsigned int i=0; i<sols.size(); i++) {
+		TEST_ASSERT(sols[i][2]==Interval(-10,10));
+		TEST_ASSERT(sols[i][0].contains(1) || sols[i][0].contains(-1));
+		TEST_ASSERT(sols[i][3].contains(2) || sols[i][3].contains(-2));
+		for (unsigned int j=0; j<i; j++) {
+			TEST_ASSERT(sols[i]!=sols[j]);
+		}
+	}
+	delete sys;
+}
+
+void TestBlockSolver::solve02() {
+	// a block with no solution
+	SystemFactory fac;
+	Variable x("x"),y("y");
+	fac.add_var(x);
+	fac.add_var(y);
+	fac.add_ctr(sqr(x)=1);
+	fac.add_ctr(sqr(y)=-1);
+	System sys(fac);
+	BlockSolver s(sys,1e-6);
+
+	IntervalVector sol(2);
+	s.start(IntervalVector(2,Interval(-10,10)));
+	TEST_ASSERT(!s.next(sol));
+	TEST_ASSERT(s.nb_sols()==0);
+}
+
+} // end namespace ibex
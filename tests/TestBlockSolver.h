@@ -0,0 +1,43 @@
+/* ============================================================================
+ * I B E X - Block Solver Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_BLOCK_SOLVER_H__
+#define __TEST_BLOCK_SOLVER_H__
+
+#include "cpptest.h"
+#include "ibex_BlockSolver.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestBlockSolver : public TestIbex {
+
+public:
+	TestBlockSolver() {
+
+		TEST_ADD(TestBlockSolver::decompose01);
+		TEST_ADD(TestBlockSolver::decompose02);
+		TEST_ADD(TestBlockSolver::btf01);
+		TEST_ADD(TestBlockSolver::btf02);
+		TEST_ADD(TestBlockSolver::solve01);
+		TEST_ADD(TestBlockSolver::solve02);
+	}
+
+	void decompose01();
+	void decompose02();
+	void btf01();
+	void btf02();
+	void solve01();
+	void solve02();
+};
+
+} // namespace ibex
+#endif // __TEST_BLOCK_SOLVER_H__
@@ -0,0 +1,227 @@
+/* ============================================================================
+ * I B E X - Double Heap Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestCellDoubleHeap.h"
+#include "ibex_CellHeapOptim.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// a cell with y=[lb,ub] (y is the 2nd variable)
+OptimCell* cell(double lb, double ub) {
+	IntervalVector box(2);
+	box[0]=Interval(0,1);
+	box[1]=Interval(lb,ub);
+	return new OptimCell(box);
+}
+
+}
+
+void TestCellDoubleHeap::pop01() {
+	CellDoubleHeap heap(1);
+
+	// lb=i and ub=200-i
+	for (int i=0; i<100; i++) {
+		int j=(i*37)%100;
+		heap.push(cell(j,200-j));
+	}
+
+	// alternate the two criteria
+	for (int i=0; i<50; i++) {
+		TEST_ASSERT(heap.minimum()==i);
+		OptimCell* c=heap.pop();
+		TEST_ASSERT(c->box[1].lb()==i);
+		delete c;
+		c=heap.pop2();
+		TEST_ASSERT(c->box[1].lb()==99-i);
+		delete c;
+	}
+	TEST_ASSERT(heap.empty());
+}
+
+void TestCellDoubleHeap::contract01() {
+	CellDoubleHeap heap(1);
+
+	for (int i=0; i<100; i++) {
+		int j=(i*37)%100;
+		heap.push(cell(j,j+1));
+	}
+
+	heap.contract_heap(49.5);
+	TEST_ASSERT(heap.size()==50);
+
+	for (int i=0; i<50; i++) {
+		OptimCell* c=heap.pop2();
+		TEST_ASSERT(c->box[1].lb()==i);
+		delete c;
+	}
+	TEST_ASSERT(heap.empty());
+}
+
+void TestCellDoubleHeap::lazy01() {
+	CellDoubleHeap heap(1,CellDoubleHeap::C3);
+
+	// C3=loup for the cells of the first kind
+	for (int i=0; i<15; i++) {
+		OptimCell* c=cell(-1000+i,0);
+		c->pf=Interval(0,1);
+		heap.push(c);
+	}
+	// C3=(loup+100)/10 for the last one
+	OptimCell* c=cell(-100,0);
+	c->pf=Interval(-100,-90);
+	heap.push(c);
+
+	TEST_ASSERT(heap.top2()!=c);
+
+	// the order of the second heap is only updated after a few pops
+	heap.contract_heap(0);
+	TEST_ASSERT(heap.size()==16);
+	TEST_ASSERT(heap.top2()!=c);
+
+	delete heap.pop();
+	delete heap.pop();
+	TEST_ASSERT(heap.top2()==c);
+}
+
+void TestCellDoubleHeap::dive01() {
+	CellDoubleHeap heap(1);
+	for (int i=0; i<10; i++)
+		heap.push(cell(10*i,10*i+5));
+	double mem=heap.memory();
+	TEST_ASSERT(mem>=10*sizeof(OptimCell));
+
+	// the best cell starts a dive
+	heap.dive_threshold=0;
+	OptimCell* c=heap.pop();
+	TEST_ASSERT(c->box[1].lb()==0);
+	TEST_ASSERT(heap.diving());
+	delete c;
+
+	// the children are explored in depth-first order
+	heap.push(cell(1,2));
+	heap.push(cell(52,53));
+	heap.push(cell(51,52));
+	TEST_ASSERT(heap.minimum()==1);
+	TEST_ASSERT(heap.top()->box[1].lb()==51);
+	TEST_ASSERT(heap.top2()->box[1].lb()==51);
+
+	// a cell of the dive removed by the loup
+	heap.contract_heap(51.5);
+	TEST_ASSERT(heap.size()==7);
+	c=heap.pop2();
+	TEST_ASSERT(c->box[1].lb()==51);
+	delete c;
+	c=heap.pop();
+	TEST_ASSERT(c->box[1].lb()==1);
+	delete c;
+
+	// the dive is over: a new one starts from the best cell
+	c=heap.pop();
+	TEST_ASSERT(c->box[1].lb()==10);
+	delete c;
+
+	heap.dive_threshold=POS_INFINITY;
+	heap.push(cell(60,61));
+	c=heap.pop();
+	TEST_ASSERT(c->box[1].lb()==60);
+	delete c;
+
+	c=heap.pop();
+	TEST_ASSERT(c->box[1].lb()==20);
+	delete c;
+	TEST_ASSERT(!heap.diving());
+	TEST_ASSERT(heap.size()==3);
+	TEST_ASSERT(heap.memory()==mem*3/10);
+}
+
+void TestCellDoubleHeap::degenerate01() {
+	// the loup of the criteria
+	double loup=1.e8;
+
+	CellDoubleHeap::criterion crit[3] = { CellDoubleHeap::C3, CellDoubleHeap::C5, CellDoubleHeap::C7 };
+
+	for (int k=0; k<3; k++) {
+		CellDoubleHeap heap(1,crit[k]);
+		for (int i=0; i<200; i++) {
+			int j=(i*37)%200;
+			OptimCell* c=cell(1,2);
+			c->pu=1;
+			switch (j%4) {
+			case 0:  c->pf=Interval(loup); break;  // C3=0/0
+			case 1:  c->pf=Interval(5);    break;  // C3=+oo
+			default: c->pf=Interval(0,j);          // C3=loup/j
+			}
+			heap.push(c);
+		}
+
+		// remove cells from the second heap in any order
+		for (int i=0; i<50; i++)
+			delete heap.pop();
+
+		// the second heap is still ordered: C3=+oo first, C3=0/0 last
+		double last=-1;
+		while (!heap.empty()) {
+			OptimCell* c=heap.pop2();
+			double rank=c->pf.diam()>0 ? c->pf.ub() : (c->pf.lb()==5 ? 0 : 1000);
+			TEST_ASSERT(rank>=last);
+			last=rank;
+			delete c;
+		}
+		TEST_ASSERT(last==1000);
+	}
+}
+
+void TestCellDoubleHeap::shuffle01() {
+	// 35 classes of ties (the id of a cell is x)
+	CellDoubleHeap heap(1);
+	CellDoubleHeap heap2(1);
+	for (int i=0; i<100; i++) {
+		OptimCell* c=cell((i*3)%7,20+(i*2)%5);
+		c->box[0]=Interval(i);
+		heap.push(c);
+		heap2.push(new OptimCell(c->box));
+	}
+	heap2.shuffle();
+
+	bool same=true;
+	for (int i=0; i<100; i++) {
+		OptimCell* c=heap.pop();
+		OptimCell* c2=heap2.pop();
+		TEST_ASSERT(c->box[1]==c2->box[1]);
+		if (c->box[0]!=c2->box[0]) same=false;
+		delete c;
+		delete c2;
+	}
+	TEST_ASSERT(!same);
+}
+
+void TestCellDoubleHeap::heap_optim01() {
+	CellHeapOptim heap(1,CellHeapOptim::UB);
+	for (int i=0; i<100; i++) {
+		int j=(i*37)%100;
+		heap.push(cell(j,200-j));
+	}
+	heap.makeheap();
+	for (int i=0; i<100; i++) {
+		heap.cleantop();
+		TEST_ASSERT(heap.top()->box[1].lb()==99-i);
+		OptimCell* c=heap.pop();
+		TEST_ASSERT(c->box[1].lb()==99-i);
+		delete c;
+	}
+	TEST_ASSERT(heap.empty());
+}
+
+} // end namespace ibex
@@ -0,0 +1,45 @@
+/* ============================================================================
+ * I B E X - Double Heap Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_CELL_DOUBLE_HEAP_H__
+#define __TEST_CELL_DOUBLE_HEAP_H__
+
+#include "cpptest.h"
+#include "ibex_CellDoubleHeap.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestCellDoubleHeap : public TestIbex {
+
+public:
+	TestCellDoubleHeap() {
+
+		TEST_ADD(TestCellDoubleHeap::pop01);
+		TEST_ADD(TestCellDoubleHeap::contract01);
+		TEST_ADD(TestCellDoubleHeap::lazy01);
+		TEST_ADD(TestCellDoubleHeap::dive01);
+		TEST_ADD(TestCellDoubleHeap::degenerate01);
+		TEST_ADD(TestCellDoubleHeap::shuffle01);
+		TEST_ADD(TestCellDoubleHeap::heap_optim01);
+	}
+
+	void pop01();
+	void contract01();
+	void lazy01();
+	void dive01();
+	void degenerate01();
+	void shuffle01();
+	void heap_optim01();
+};
+
+} // namespace ibex
+#endif // __TEST_CELL_DOUBLE_HEAP_H__
@@ -0,0 +1,194 @@
+/* ============================================================================
+ * I B E X - Hybrid Cell Buffer Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestCellHybrid.h"
+#include "ibex_Bsc.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// cost = lower bound of the first component
+class CellHybridByLB : public CellHybrid {
+public:
+	CellHybridByLB(double dive_threshold=POS_INFINITY, double max_memory=POS_INFINITY) :
+		CellHybrid(dive_threshold, max_memory) { }
+
+	double cost(const Cell& c) const {
+		return c.box[0].lb();
+	}
+};
+
+// a cell with cost x. The other components depend on x.
+Cell* cell(int x) {
+	IntervalVector box(10);
+	for (int i=0; i<10; i++) box[i]=Interval(x,x+i+1);
+	return new Cell(box);
+}
+
+bool has_cost(const Cell* c, int x) {
+	for (int i=0; i<10; i++)
+		if (c->box[i]!=Interval(x,x+i+1)) return false;
+	return true;
+}
+
+}
+
+void TestCellHybrid::best_first01() {
+	CellHybridByLB buf;
+	for (int i=0; i<100; i++)
+		buf.push(cell((i*37)%100));
+
+	TEST_ASSERT(buf.size()==100);
+	for (int i=0; i<100; i++) {
+		TEST_ASSERT(has_cost(buf.top(),i));
+		Cell* c=buf.pop();
+		TEST_ASSERT(has_cost(c,i));
+		delete c;
+	}
+	TEST_ASSERT(buf.empty());
+	TEST_ASSERT(!buf.diving());
+}
+
+void TestCellHybrid::dive01() {
+	CellHybridByLB buf(0);
+	buf.push(cell(5));
+	buf.push(cell(1));
+	buf.push(cell(3));
+
+	// the best cell starts a dive
+	delete buf.pop();
+	TEST_ASSERT(buf.diving());
+
+	// the children of the best cell are explored in depth-first order
+	buf.push(cell(10));
+	buf.push(cell(20));
+	Cell* c=buf.pop();
+	TEST_ASSERT(has_cost(c,20));
+	delete c;
+	c=buf.pop();
+	TEST_ASSERT(has_cost(c,10));
+	delete c;
+
+	// back to the best cell
+	c=buf.pop();
+	TEST_ASSERT(has_cost(c,3));
+	delete c;
+	TEST_ASSERT(buf.size()==1);
+}
+
+void TestCellHybrid::spill01() {
+	double max_memory=100*(sizeof(Cell)+10*sizeof(Interval));
+	CellHybridByLB buf(POS_INFINITY, max_memory);
+	for (int i=0; i<1000; i++) {
+		buf.push(cell((i*37)%1000));
+		TEST_ASSERT(buf.memory()<=max_memory);
+	}
+
+	TEST_ASSERT(buf.size()==1000);
+	TEST_ASSERT(buf.nb_spilled()>0);
+
+	for (int i=0; i<1000; i++) {
+		Cell* c=buf.pop();
+		TEST_ASSERT(has_cost(c,i));
+		delete c;
+	}
+	TEST_ASSERT(buf.empty());
+	TEST_ASSERT(buf.nb_spilled()==0);
+}
+
+void TestCellHybrid::spill02() {
+	// cells with data: the data remain in memory
+	Cell* c=cell(0);
+	double box_memory=c->memory();
+	c->add<BisectedVar>();
+	double cell_memory=c->memory();
+	TEST_ASSERT(cell_memory>box_memory+sizeof(BisectedVar));
+	delete c;
+
+	double max_memory=100*cell_memory;
+	CellHybridByLB buf(POS_INFINITY, max_memory);
+	for (int i=0; i<1000; i++) {
+		c=cell((i*37)%1000);
+		c->add<BisectedVar>();
+		c->get<BisectedVar>().var=i;
+		buf.push(c);
+		// the memory of the data of spilled cells is counted
+		TEST_ASSERT(buf.memory()>=(buf.size()-100)*(cell_memory-box_memory));
+	}
+	TEST_ASSERT(buf.nb_spilled()>0);
+
+	for (int i=0; i<1000; i++) {
+		c=buf.pop();
+		TEST_ASSERT(has_cost(c,i));
+		TEST_ASSERT(c->get<BisectedVar>().var*37%1000==i);
+		delete c;
+	}
+	TEST_ASSERT(buf.memory()==0);
+}
+
+void TestCellHybrid::spill_stack01() {
+	Cell* c=cell(0);
+	double cell_memory=c->memory();
+	delete c;
+
+	double max_memory=10*cell_memory;
+	CellHybridByLB buf(0, max_memory);
+	buf.push(cell(0));
+	delete buf.pop();
+	TEST_ASSERT(buf.diving());
+
+	// a deep dive: the bottom of the stack is spilled
+	for (int i=0; i<1000; i++) {
+		buf.push(cell(i));
+		TEST_ASSERT(buf.memory()<=max_memory);
+	}
+	TEST_ASSERT(buf.nb_spilled()>0);
+
+	for (int i=999; i>=0; i--) {
+		c=buf.pop();
+		TEST_ASSERT(has_cost(c,i));
+		delete c;
+	}
+	TEST_ASSERT(buf.empty());
+	TEST_ASSERT(buf.nb_spilled()==0);
+	TEST_ASSERT(buf.spill_size()==0);
+}
+
+void TestCellHybrid::holes01() {
+	Cell* c=cell(0);
+	double cell_memory=c->memory();
+	delete c;
+
+	double max_memory=50*cell_memory;
+	CellHybridByLB buf(POS_INFINITY, max_memory);
+
+	// the runs are not loaded back in the order they were spilled
+	double last=NEG_INFINITY;
+	for (int k=0; k<50; k++) {
+		for (int i=0; i<200; i++)
+			buf.push(cell(1000*k+i));
+		for (int i=0; i<150; i++) {
+			c=buf.pop();
+			TEST_ASSERT(c->box[0].lb()>=last);
+			last=c->box[0].lb();
+			delete c;
+		}
+		// the space of the cells loaded back is reused
+		TEST_ASSERT(buf.spill_size()<=(long) ((2*buf.nb_spilled()+200)*10*2*sizeof(double)));
+	}
+	TEST_ASSERT(buf.size()==50*50);
+	TEST_ASSERT(buf.nb_spilled()>1000);
+}
+
+} // end namespace ibex
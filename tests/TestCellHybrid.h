@@ -0,0 +1,43 @@
+/* ============================================================================
+ * I B E X - Hybrid Cell Buffer Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_CELL_HYBRID_H__
+#define __TEST_CELL_HYBRID_H__
+
+#include "cpptest.h"
+#include "ibex_CellHybrid.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestCellHybrid : public TestIbex {
+
+public:
+	TestCellHybrid() {
+
+		TEST_ADD(TestCellHybrid::best_first01);
+		TEST_ADD(TestCellHybrid::dive01);
+		TEST_ADD(TestCellHybrid::spill01);
+		TEST_ADD(TestCellHybrid::spill02);
+		TEST_ADD(TestCellHybrid::spill_stack01);
+		TEST_ADD(TestCellHybrid::holes01);
+	}
+
+	void best_first01();
+	void dive01();
+	void spill01();
+	void spill02();
+	void spill_stack01();
+	void holes01();
+};
+
+} // namespace ibex
+#endif // __TEST_CELL_HYBRID_H__
@@ -0,0 +1,195 @@
+/* ============================================================================
+ * I B E X - Adaptive Composition Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestCtcAdaptive.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// does nothing (but counts the calls)
+class CtcUseless : public Ctc {
+public:
+	CtcUseless() : n(0) { }
+	void contract(IntervalVector& box) { n++; }
+	int n;
+};
+
+// removes the upper half of the first variable
+class CtcHalf : public Ctc {
+public:
+	CtcHalf() : n(0) { }
+	void contract(IntervalVector& box) {
+		n++;
+		box[0]=Interval(box[0].lb(),box[0].mid());
+	}
+	int n;
+};
+
+// does nothing (but takes some CPU time)
+class CtcSlow : public Ctc {
+public:
+	CtcSlow() : n(0) { }
+	void contract(IntervalVector& box) {
+		n++;
+		volatile double x=0;
+		for (int i=0; i<100000; i++) x+=1;
+	}
+	int n;
+};
+
+class CtcEmpty : public Ctc {
+public:
+	void contract(IntervalVector& box) {
+		box.set_empty();
+		throw EmptyBoxException();
+	}
+};
+
+}
+
+void TestCtcAdaptive::level01() {
+	CtcUseless c;
+	CtcAdaptive a(Array<Ctc>(c),vector<double>(1,1.0));
+
+	IntervalVector box(2,Interval(0,8));
+	TEST_ASSERT(a.level(box)==0);
+	box[0]=Interval(0,4);
+	TEST_ASSERT(a.level(box)==0);
+	box[1]=Interval(0,4);
+	TEST_ASSERT(a.level(box)==1);
+	box=IntervalVector(2,Interval(0,1));
+	TEST_ASSERT(a.level(box)==3);
+	box=IntervalVector(2,Interval(0,0));
+	TEST_ASSERT(a.level(box)==a.nb_levels-1);
+}
+
+void TestCtcAdaptive::level02() {
+	CtcUseless c;
+	CtcAdaptive a(Array<Ctc>(c),vector<double>(1,1.0));
+
+	IntervalVector box(2,Interval(0,1));
+	TEST_ASSERT(a.level(box)==0);
+	box=IntervalVector(2,Interval(0,8));
+	TEST_ASSERT(a.level(box)==0);
+	box=IntervalVector(2,Interval(0,1));
+	TEST_ASSERT(a.level(box)==3);
+
+	// a new search, from a smaller box
+	a.reset();
+	TEST_ASSERT(a.level(box)==0);
+	box=IntervalVector(2,Interval(0,0.25));
+	TEST_ASSERT(a.level(box)==2);
+}
+
+void TestCtcAdaptive::level03() {
+	CtcUseless c;
+	CtcAdaptive a(Array<Ctc>(c),vector<double>(1,1.0));
+
+	IntervalVector box(2,Interval::ALL_REALS);
+	TEST_ASSERT(a.level(box)==0);
+	box[0]=Interval(0,4);
+	TEST_ASSERT(a.level(box)==0);
+	box[1]=Interval(0,16);
+	TEST_ASSERT(a.level(box)==0);
+	box[1]=Interval(0,2);
+	TEST_ASSERT(a.level(box)==2);
+	box[0]=Interval::POS_REALS;
+	TEST_ASSERT(a.level(box)==0);
+	box=IntervalVector(2,Interval(0,1));
+	TEST_ASSERT(a.level(box)==4);
+}
+
+void TestCtcAdaptive::schedule01() {
+	CtcHalf cheap;
+	CtcUseless useless;
+	CtcHalf useful;
+	vector<double> cost(3,1.0);
+	cost[0]=0;
+	CtcAdaptive a(Array<Ctc>(cheap,useless,useful),cost);
+
+	int N=1000;
+	for (int k=0; k<N; k++) {
+		IntervalVector box(2,Interval(0,1));
+		a.contract(box);
+	}
+
+	TEST_ASSERT(cheap.n==N);
+	TEST_ASSERT(useful.n==N);
+	// only the tuning calls and the exploration
+	TEST_ASSERT(useless.n>=a.nb_init_calls);
+	TEST_ASSERT(useless.n<a.nb_init_calls+2*a.epsilon*N);
+
+	TEST_ASSERT(a.nb_calls(2,0)==N);
+	TEST_ASSERT(a.gain(1,0)==0);
+	TEST_ASSERT(almost_eq(a.gain(2,0),0.25,1e-10));
+	TEST_ASSERT(a.cost(2,0)==1.0);
+}
+
+void TestCtcAdaptive::schedule02() {
+	CtcHalf cheap;
+	CtcSlow useless;
+	CtcHalf useful;
+	vector<bool> expensive(3,true);
+	expensive[0]=false;
+	CtcAdaptive a(Array<Ctc>(cheap,useless,useful),expensive);
+
+	int N=200;
+	for (int k=0; k<N; k++) {
+		IntervalVector box(2,Interval(0,1));
+		a.contract(box);
+	}
+
+	TEST_ASSERT(cheap.n==N);
+	TEST_ASSERT(useful.n==N);
+	TEST_ASSERT(useless.n>=a.nb_init_calls);
+	TEST_ASSERT(useless.n<a.nb_init_calls+2*a.epsilon*N);
+
+	TEST_ASSERT(a.time(1,0)>0);
+	TEST_ASSERT(a.cost(1,0)>0);
+	TEST_ASSERT(a.cost(1,0)<=1);
+}
+
+void TestCtcAdaptive::seed01() {
+	CtcUseless u1,u2,u3;
+	CtcAdaptive a1(Array<Ctc>(u1),vector<double>(1,1.0),7);
+	CtcAdaptive a2(Array<Ctc>(u2),vector<double>(1,1.0),7);
+	CtcAdaptive a3(Array<Ctc>(u3),vector<double>(1,1.0),8);
+
+	bool same=true;
+	bool same3=true;
+	for (int k=0; k<1000; k++) {
+		IntervalVector box(2,Interval(0,1));
+		a1.contract(box);
+		a2.contract(box);
+		a3.contract(box);
+		same &= u1.n==u2.n;
+		same3 &= u1.n==u3.n;
+	}
+	TEST_ASSERT(same);
+	TEST_ASSERT(!same3);
+}
+
+void TestCtcAdaptive::empty01() {
+	CtcEmpty e;
+	CtcUseless u;
+	CtcAdaptive a(Array<Ctc>(e,u),vector<double>(2,1.0));
+
+	IntervalVector box(2,Interval(0,1));
+	TEST_THROWS(a.contract(box),EmptyBoxException);
+	TEST_ASSERT(box.is_empty());
+	TEST_ASSERT(u.n==0);
+	TEST_ASSERT(a.gain(0,0)==1);
+}
+
+} // end namespace ibex
@@ -0,0 +1,48 @@
+/* ============================================================================
+ * I B E X - Adaptive Composition Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_CTC_ADAPTIVE_H__
+#define __TEST_CTC_ADAPTIVE_H__
+
+#include "cpptest.h"
+#include "ibex_CtcAdaptive.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestCtcAdaptive : public TestIbex {
+
+public:
+	TestCtcAdaptive() {
+
+		TEST_ADD(TestCtcAdaptive::level01);
+		TEST_ADD(TestCtcAdaptive::level02);
+		TEST_ADD(TestCtcAdaptive::level03);
+		TEST_ADD(TestCtcAdaptive::schedule01);
+		TEST_ADD(TestCtcAdaptive::schedule02);
+		TEST_ADD(TestCtcAdaptive::seed01);
+		TEST_ADD(TestCtcAdaptive::empty01);
+	}
+
+	void level01();
+	// the first box is not the root
+	void level02();
+	// unbounded root box
+	void level03();
+	void schedule01();
+	// measured costs
+	void schedule02();
+	void seed01();
+	void empty01();
+};
+
+} // namespace ibex
+#endif // __TEST_CTC_ADAPTIVE_H__
@@ -0,0 +1,163 @@
+/* ============================================================================
+ * I B E X - Fixpoint Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestCtcFixPoint.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// removes the upper half of the first variable
+// (does not report the modifications)
+class CtcHalf : public Ctc {
+public:
+	void contract(IntervalVector& box) {
+		box[0]=Interval(box[0].lb(),box[0].mid());
+	}
+};
+
+// check that the changes are exactly the variables
+// that differ between box1 and box2.
+bool same_changes(const CtcChanges& ch, const IntervalVector& box1, const IntervalVector& box2) {
+	int n=0;
+	for (int i=0; i<box1.size(); i++) {
+		if (box1[i]!=box2[i]) {
+			if (!ch.contains(i) || ch.initial(i)!=box1[i]) return false;
+			n++;
+		}
+	}
+	return n==ch.size();
+}
+
+}
+
+void TestCtcFixPoint::changes01() {
+	CtcChanges ch(4);
+	TEST_ASSERT(ch.size()==0);
+
+	ch.add(2,Interval(0,4));
+	ch.add(0,Interval(1,2));
+	ch.add(2,Interval(0,1)); // ignored
+	TEST_ASSERT(ch.size()==2);
+	TEST_ASSERT(ch[0]==2);
+	TEST_ASSERT(ch[1]==0);
+	TEST_ASSERT(ch.contains(0));
+	TEST_ASSERT(!ch.contains(1));
+	TEST_ASSERT(ch.initial(2)==Interval(0,4));
+
+	IntervalVector box(4,Interval(1,2));
+	box[2]=Interval(0,2);
+	TEST_ASSERT_DELTA(ch.rel_distance(box),0.5,1e-10);
+
+	ch.clear();
+	TEST_ASSERT(ch.size()==0);
+	TEST_ASSERT(!ch.contains(2));
+	TEST_ASSERT(ch.rel_distance(box)==0);
+}
+
+void TestCtcFixPoint::unreported01() {
+	CtcHalf half;
+	Ctc& c=half;
+	TEST_ASSERT(!c.reports_changes());
+
+	IntervalVector box(2,Interval(0,1));
+	CtcChanges ch(2);
+	c.contract(box,ch);
+	TEST_ASSERT(ch.size()==1);
+	TEST_ASSERT(ch[0]==0);
+	TEST_ASSERT(ch.initial(0)==Interval(0,1));
+	TEST_ASSERT(box[0]==Interval(0,0.5));
+}
+
+void TestCtcFixPoint::fwdbwd01() {
+	Variable x,y,z;
+	Function f(x,y,z,x+y-z);
+	CtcFwdBwd fwdbwd(f);
+	Ctc& c=fwdbwd; // (the contract functions of Ctc are hidden)
+	TEST_ASSERT(c.reports_changes());
+
+	IntervalVector box(3);
+	box[0]=Interval(0,1);
+	box[1]=Interval(0,1);
+	box[2]=Interval(-10,1);
+	IntervalVector old_box(box);
+
+	CtcChanges ch(3);
+	c.contract(box,ch);
+	TEST_ASSERT(box[2]==Interval(0,1));
+	TEST_ASSERT(same_changes(ch,old_box,box));
+}
+
+void TestCtcFixPoint::hc4_01() {
+	Variable x1,y1,z1,x2,y2,z2,x3,y3,z3;
+	Function f1(x1,y1,z1,x1+y1-z1);
+	Function f2(x2,y2,z2,x2-2*y2);
+	Function f3(x3,y3,z3,z3-sqr(x3));
+	Array<NumConstraint> csp(3);
+	csp.set_ref(0,*new NumConstraint(f1));
+	csp.set_ref(1,*new NumConstraint(f2));
+	csp.set_ref(2,*new NumConstraint(f3));
+
+	for (int incr=0; incr<2; incr++) {
+		CtcHC4 hc4(csp,0.01,incr==1);
+		Ctc& c=hc4;
+
+		IntervalVector box(3,Interval(-10,10));
+		box[1]=Interval(0.1,1);
+		IntervalVector old_box(box);
+
+		BoolMask impact(3);
+		impact.set_all();
+		BoolMask flags(Ctc::NB_OUTPUT_FLAGS);
+		CtcChanges ch(3);
+		c.contract(box,impact,flags,ch);
+		TEST_ASSERT(ch.size()>0);
+		TEST_ASSERT(same_changes(ch,old_box,box));
+	}
+
+	for (int i=0; i<3; i++) delete &csp[i];
+}
+
+void TestCtcFixPoint::fixpoint01() {
+	Variable x1,y1,x2,y2;
+	Function f1(x1,y1,sqr(x1)+sqr(y1)-1);
+	Function f2(x2,y2,y2-sqr(x2));
+	Array<NumConstraint> csp(2);
+	csp.set_ref(0,*new NumConstraint(f1));
+	csp.set_ref(1,*new NumConstraint(f2));
+
+	CtcHC4 hc4(csp,0.1);
+
+	IntervalVector box(2,Interval(0.1,10));
+
+	// the fixpoint loop before the changes were tracked
+	IntervalVector box1(box);
+	IntervalVector old_box(box);
+	do {
+		old_box=box1;
+		hc4.contract(box1);
+	} while (old_box.rel_distance(box1)>0.01);
+
+	CtcFixPoint fix(hc4,0.01);
+	Ctc& c=fix;
+	IntervalVector box2(box);
+	CtcChanges ch(2);
+	c.contract(box2,ch);
+
+	TEST_ASSERT(box1==box2);
+	TEST_ASSERT(same_changes(ch,box,box2));
+
+	for (int i=0; i<2; i++) delete &csp[i];
+}
+
+} // namespace ibex
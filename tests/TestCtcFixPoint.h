@@ -0,0 +1,43 @@
+/* ============================================================================
+ * I B E X - Fixpoint Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_CTC_FIXPOINT_H__
+#define __TEST_CTC_FIXPOINT_H__
+
+#include "cpptest.h"
+#include "ibex_CtcFixPoint.h"
+#include "ibex_CtcFwdBwd.h"
+#include "ibex_CtcHC4.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestCtcFixPoint : public TestIbex {
+
+public:
+	TestCtcFixPoint() {
+
+		TEST_ADD(TestCtcFixPoint::changes01);
+		TEST_ADD(TestCtcFixPoint::unreported01);
+		TEST_ADD(TestCtcFixPoint::fwdbwd01);
+		TEST_ADD(TestCtcFixPoint::hc4_01);
+		TEST_ADD(TestCtcFixPoint::fixpoint01);
+	}
+
+	void changes01();
+	void unreported01();
+	void fwdbwd01();
+	void hc4_01();
+	void fixpoint01();
+};
+
+} // namespace ibex
+#endif // __TEST_CTC_FIXPOINT_H__
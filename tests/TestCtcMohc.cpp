@@ -0,0 +1,141 @@
+/* ============================================================================
+ * I B E X - Mohc Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestCtcMohc.h"
+#include "ibex_Solver.h"
+#include "ibex_RoundRobin.h"
+#include "ibex_CellStack.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+Function& func() {
+	static Variable x,y;
+	static Function f(x,y,sqr(x)*y-x*sqr(y)+x*y-3*x);
+	return f;
+}
+
+IntervalVector box0() {
+	IntervalVector box(2);
+	box[0]=Interval(-1,2);
+	box[1]=Interval(1,5);
+	return box;
+}
+
+}
+
+void TestCtcMohc::memo01() {
+	Function& f=func();
+	Function_OG fog1(f);
+	Function_OG fog2(f);
+	fog2.memo=false;
+
+	IntervalVector box=box0();
+	TEST_ASSERT(fog1.occurrence_grouping(box));
+	TEST_ASSERT(fog2.occurrence_grouping(box));
+
+	// 95% of the initial box: the grouping of fog1 is kept
+	IntervalVector box1(2);
+	box1[0]=Interval(-0.9,1.95);
+	box1[1]=Interval(1.1,4.9);
+	TEST_ASSERT(fog1.occurrence_grouping(box1));
+	Interval y1=fog1.eval(box1);
+	TEST_ASSERT(y1==fog2.eval(box1));
+
+	for (int i=0; i<=10; i++)
+		for (int j=0; j<=10; j++) {
+			IntervalVector pt(2);
+			pt[0]=box1[0].lb()+i*box1[0].diam()/10;
+			pt[1]=box1[1].lb()+j*box1[1].diam()/10;
+			pt&=box1;
+			TEST_ASSERT(f.eval(pt).is_subset(y1));
+		}
+
+	// without memo, the grouping is recomputed
+	TEST_ASSERT(fog2.occurrence_grouping(box1));
+	TEST_ASSERT(fog2.eval(box1)!=y1);
+}
+
+void TestCtcMohc::memo02() {
+	Function& f=func();
+	Function_OG fog1(f);
+	Function_OG fog2(f);
+	fog2.memo=false;
+
+	IntervalVector box=box0();
+	TEST_ASSERT(fog1.occurrence_grouping(box));
+
+	// half of the initial box
+	IntervalVector box2(2);
+	box2[0]=Interval(-0.5,1);
+	box2[1]=Interval(1,5);
+	// a box that is not a subset of the initial box
+	IntervalVector box3(2);
+	box3[0]=Interval(-1,2.1);
+	box3[1]=Interval(1.2,5);
+
+	TEST_ASSERT(fog1.occurrence_grouping(box2));
+	TEST_ASSERT(fog2.occurrence_grouping(box2));
+	TEST_ASSERT(fog1.eval(box2)==fog2.eval(box2));
+	TEST_ASSERT(fog1.eval(box2,true)==fog2.eval(box2,true));
+
+	TEST_ASSERT(fog1.occurrence_grouping(box3));
+	TEST_ASSERT(fog2.occurrence_grouping(box3));
+	TEST_ASSERT(fog1.eval(box3)==fog2.eval(box3));
+	TEST_ASSERT(fog1.eval(box3,false)==fog2.eval(box3,false));
+}
+
+// solving with Mohc gives the same solutions with
+// and without memoization (cyclohexan3D)
+void TestCtcMohc::memo03() {
+	Variable x1,y1,z1,x2,y2,z2,x3,y3,z3;
+	Function f1(x1,y1,z1,sqr(y1)*(1+sqr(z1))+z1*(z1-24*y1)+13);
+	Function f2(x2,y2,z2,sqr(x2)*(1+sqr(y2))+y2*(y2-24*x2)+13);
+	Function f3(x3,y3,z3,sqr(z3)*(1+sqr(x3))+x3*(x3-24*z3)+13);
+	NumConstraint c1(f1);
+	NumConstraint c2(f2);
+	NumConstraint c3(f3);
+	Array<NumConstraint> csp(c1,c2,c3);
+
+	IntervalVector box(3,Interval(-1e08,1e08));
+
+	vector<IntervalVector> sols[2];
+	int nb_cells[2];
+
+	for (int memo=0; memo<2; memo++) {
+		CtcMohc mohc(csp, 0.01, false, 0.01, CtcMohc::default_univ_newton_min_width, 1.1);
+		for (int i=0; i<mohc.list.size(); i++)
+			dynamic_cast<CtcMohcRevise&>(mohc.list[i]).fog.memo=(memo==1);
+
+		RoundRobin rr(1e-03);
+		CellStack buff;
+		Solver solver(mohc,rr,buff);
+		sols[memo]=solver.solve(box);
+		nb_cells[memo]=solver.nb_cells;
+	}
+
+	TEST_ASSERT(sols[0].size()==16);
+	TEST_ASSERT(sols[1].size()==16);
+	// the search trees are not the same but they have about the same size
+	TEST_ASSERT(nb_cells[1]<=1.1*nb_cells[0]);
+	// each solution is found with and without memo
+	for (unsigned int i=0; i<sols[0].size(); i++) {
+		bool found=false;
+		for (unsigned int j=0; j<sols[1].size(); j++)
+			found |= sols[0][i].intersects(sols[1][j]);
+		TEST_ASSERT(found);
+	}
+}
+
+} // namespace ibex
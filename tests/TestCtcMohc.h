@@ -0,0 +1,40 @@
+/* ============================================================================
+ * I B E X - Mohc Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_CTC_MOHC_H__
+#define __TEST_CTC_MOHC_H__
+
+#include "cpptest.h"
+#include "ibex_CtcMohc.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestCtcMohc : public TestIbex {
+
+public:
+	TestCtcMohc() {
+
+		TEST_ADD(TestCtcMohc::memo01);
+		TEST_ADD(TestCtcMohc::memo02);
+		TEST_ADD(TestCtcMohc::memo03);
+	}
+
+	// the grouping is kept in a slightly smaller box (and it is sound)
+	void memo01();
+	// the grouping is recomputed in a smaller box or in another box
+	void memo02();
+	// same solutions with and without memoization (cyclohexan3D)
+	void memo03();
+};
+
+} // namespace ibex
+#endif // __TEST_CTC_MOHC_H__
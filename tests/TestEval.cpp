@@ -311,4 +311,34 @@ void TestEval::apply04() {
 	check(f3.eval_domain(_x3).i(), Interval(10,10));
 }
 
+void TestEval::point01() {
+	Variable x(2),y;
+	Function f(x,y,sqr(x[0])*y-exp(x[1])/(1+y)+pow(y,3));
+
+	double _pt[]={0.5,-1,2};
+	Vector pt(3,_pt);
+
+	// only scalar operations: the floating-point code is used
+	TEST_ASSERT(f.cf.point_ok);
+	double fx=f.eval_point(pt);
+	TEST_ASSERT(f.eval(pt).contains(fx));
+	TEST_ASSERT_DELTA(fx,0.25*2-::exp(-1.0)/3+8,1e-12);
+
+	// outside the definition domain
+	Function g(x,y,sqrt(x[0]-y));
+	TEST_ASSERT(g.cf.point_ok);
+	TEST_ASSERT(g.eval_point(pt)!=g.eval_point(pt));
+}
+
+void TestEval::point02() {
+	Variable x(2);
+	// dot product: not supported by the floating-point code
+	Function f(x,transpose(x)*x);
+	TEST_ASSERT(!f.cf.point_ok);
+
+	double _pt[]={1,2};
+	Vector pt(2,_pt);
+	TEST_ASSERT_DELTA(f.eval_point(pt),5.0,1e-12);
+}
+
 }
@@ -38,6 +38,9 @@ public:
 		TEST_ADD(TestEval::apply02);
 		TEST_ADD(TestEval::apply03);
 		TEST_ADD(TestEval::apply04);
+
+		TEST_ADD(TestEval::point01);
+		TEST_ADD(TestEval::point02);
 	}
 
 	void deco01();
@@ -57,6 +60,9 @@ public:
 	void apply03();
 	void apply04();
 
+	void point01();
+	void point02();
+
 private:
 	void check_deco(const ExprNode& e);
 };
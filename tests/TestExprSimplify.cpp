@@ -0,0 +1,143 @@
+/* ============================================================================
+ * I B E X - Symbolic simplification tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestExprSimplify.h"
+#include "ibex_ExprSimplify.h"
+#include "ibex_ExprDiff.h"
+#include "ibex_ExprCopy.h"
+#include "ibex_Function.h"
+#include "ibex_SystemFactory.h"
+#include "ibex_System.h"
+
+using namespace std;
+
+namespace ibex {
+
+void TestExprSimplify::cse01() {
+	Variable x("x"),y("y");
+	const ExprNode& e=sin(x*y)+sin(x*y);
+
+	const ExprSymbol& x2=ExprSymbol::new_("x");
+	const ExprSymbol& y2=ExprSymbol::new_("y");
+	const ExprNode& e2=ExprSimplify().simplify(Array<const ExprSymbol>(x,y),Array<const ExprSymbol>(x2,y2),e);
+	Function f(x2,y2,e2);
+
+	TEST_ASSERT(sameExpr(e2,"(sin((x*y))+sin((x*y)))"));
+	// x, y, x*y, sin and +
+	TEST_ASSERT(f.nb_nodes()==5);
+	cleanup(e,false);
+}
+
+void TestExprSimplify::trivial01() {
+	Variable x("x"),y("y");
+	const ExprNode& e=(0*(x+y)+1*y)-(-(-x));
+
+	const ExprSymbol& x2=ExprSymbol::new_("x");
+	const ExprSymbol& y2=ExprSymbol::new_("y");
+	const ExprNode& e2=ExprSimplify().simplify(Array<const ExprSymbol>(x,y),Array<const ExprSymbol>(x2,y2),e);
+
+	TEST_ASSERT(sameExpr(e2,"(y-x)"));
+	// x must not be a father of the removed node x+y
+	TEST_ASSERT(x2.fathers.size()==1);
+	cleanup(e,false);
+	cleanup(e2,true);
+}
+
+void TestExprSimplify::cst01() {
+	Variable x("x");
+	const ExprNode& e=x*(Interval(2)+Interval(3))+pow(x,1);
+
+	const ExprSymbol& x2=ExprSymbol::new_("x");
+	const ExprNode& e2=ExprSimplify().simplify(Array<const ExprSymbol>(x),Array<const ExprSymbol>(x2),e);
+
+	TEST_ASSERT(sameExpr(e2,"((x*5)+x)"));
+	cleanup(e,false);
+	cleanup(e2,true);
+}
+
+void TestExprSimplify::index01() {
+	Variable x("x"),y("y");
+	Array<const ExprNode> c(x,sqr(y));
+	const ExprNode& e=ExprVector::new_(c,false)[1];
+
+	const ExprSymbol& x2=ExprSymbol::new_("x");
+	const ExprSymbol& y2=ExprSymbol::new_("y");
+	const ExprNode& e2=ExprSimplify().simplify(Array<const ExprSymbol>(x,y),Array<const ExprSymbol>(x2,y2),e);
+
+	TEST_ASSERT(sameExpr(e2,"y^2"));
+	TEST_ASSERT(x2.fathers.size()==0);
+	cleanup(e,false);
+	cleanup(e2,true);
+	delete &x2;
+}
+
+void TestExprSimplify::diff01() {
+	Variable x("x"),y("y");
+	Function f(x,y,sqr(x)*y+exp(x*y)*(x-y));
+
+	Array<const ExprSymbol> x2(2);
+	varcopy(f.args(),x2);
+	Function raw(x2,ExprDiff().diff(f.args(),x2,f.expr()));
+
+	Function df(f,Function::DIFF);
+	TEST_ASSERT(df.nb_nodes()<raw.nb_nodes());
+
+	IntervalVector box(2);
+	box[0]=Interval(1,2);
+	box[1]=Interval(-1,3);
+	TEST_ASSERT(df.eval_vector(box).is_subset(raw.eval_vector(box)));
+}
+
+void TestExprSimplify::domain01() {
+	Variable x("x"),y("y");
+	Array<const ExprNode> c(sqrt(x),y);
+	const ExprNode& e=0*sqrt(x)+log(y)*0+ExprVector::new_(c,false)[1]+x*0;
+
+	const ExprSymbol& x2=ExprSymbol::new_("x");
+	const ExprSymbol& y2=ExprSymbol::new_("y");
+	const ExprNode& e2=ExprSimplify().simplify(Array<const ExprSymbol>(x,y),Array<const ExprSymbol>(x2,y2),e);
+	Function f(x2,y2,e2);
+
+	IntervalVector box(2);
+	box[0]=Interval(1,2);
+	box[1]=Interval(1,2);
+	// 0+0+y+0
+	TEST_ASSERT(f.eval(box)==Interval(1,2));
+	box[0]=Interval(-2,-1);
+	TEST_ASSERT(f.eval(box).is_empty());
+	box[0]=Interval(1,2);
+	box[1]=Interval(-2,-1);
+	TEST_ASSERT(f.eval(box).is_empty());
+	cleanup(e,false);
+}
+
+void TestExprSimplify::domain02() {
+	Variable x("x"),y("y");
+	SystemFactory fac;
+	fac.add_var(x);
+	fac.add_var(y);
+	fac.add_ctr(0*sqrt(x)+y=0);
+	fac.add_ctr(x*0+y<=1);
+	System sys(fac);
+
+	IntervalVector box(2);
+	box[0]=Interval(-2,-1);
+	box[1]=Interval(-1,1);
+	IntervalVector fx=sys.f.eval_vector(box);
+	TEST_ASSERT(sys.ctrs[0].f.eval(box).is_empty());
+	TEST_ASSERT(fx.is_empty() || fx[0].is_empty());
+	box[0]=Interval(1,2);
+	fx=sys.f.eval_vector(box);
+	TEST_ASSERT(fx[0]==sys.ctrs[0].f.eval(box));
+	TEST_ASSERT(fx[1]==sys.ctrs[1].f.eval(box));
+}
+
+} // end namespace
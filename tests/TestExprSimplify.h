@@ -0,0 +1,57 @@
+/* ============================================================================
+ * I B E X - Symbolic simplification tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_EXPR_SIMPLIFY_H__
+#define __TEST_EXPR_SIMPLIFY_H__
+
+#include "cpptest.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestExprSimplify : public TestIbex {
+
+public:
+	TestExprSimplify() {
+
+		TEST_ADD(TestExprSimplify::cse01);
+		TEST_ADD(TestExprSimplify::trivial01);
+		TEST_ADD(TestExprSimplify::cst01);
+		TEST_ADD(TestExprSimplify::index01);
+		TEST_ADD(TestExprSimplify::diff01);
+		TEST_ADD(TestExprSimplify::domain01);
+		TEST_ADD(TestExprSimplify::domain02);
+	}
+
+	// identical subexpressions are merged
+	void cse01();
+
+	// 0*x, 1*x, 0+x, -(-x)
+	void trivial01();
+
+	// constant folding
+	void cst01();
+
+	// (x,y)[1] --> y
+	void index01();
+
+	// the derivative has less nodes but the same value
+	void diff01();
+
+	// 0*sqrt(x), log(y)*0 and (sqrt(x),y)[1] are not simplified
+	void domain01();
+
+	// the function of a system has the same definition domain as its constraints
+	void domain02();
+};
+
+} // namespace ibex
+#endif // __TEST_EXPR_SIMPLIFY_H__
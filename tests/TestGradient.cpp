@@ -440,6 +440,41 @@ void TestGradient::jac02() {
 	TEST_ASSERT(almost_eq(J[29][29],Interval(1,1),error));
 }
 
+// vector mode (more components than one block)
+void TestGradient::jac03() {
+	Variable x(3),y;
+	Array<const ExprNode> c(12);
+	c.set_ref(0,x[0]*y-x[1]);
+	c.set_ref(1,exp(x[0])/y);
+	c.set_ref(2,sqr(x[1]+x[2]));
+	c.set_ref(3,sqrt(y)*x[2]);
+	c.set_ref(4,cos(x[0])+sin(x[1]));
+	c.set_ref(5,pow(x[2],3)-atan(y));
+	c.set_ref(6,log(y)*x[0]);
+	c.set_ref(7,-x[1]+abs(x[2]));
+	c.set_ref(8,tanh(x[0]*x[1]));
+	c.set_ref(9,max(x[0],y));
+	c.set_ref(10,x[2]/(1+sqr(y)));
+	c.set_ref(11,2*x[0]);
+	Function f(x,y,ExprVector::new_(c,false));
+	TEST_ASSERT(f.cf.vec_jac_ok);
+
+	IntervalVector box(4);
+	box[0]=Interval(-1,2);
+	box[1]=Interval(0,1);
+	box[2]=Interval(1,3);
+	box[3]=Interval(3,4);
+
+	IntervalMatrix J(12,4);
+	f.jacobian(box,J);
+
+	for (int i=0; i<12; i++) {
+		IntervalVector g(4);
+		f[i].gradient(box,g);
+		TEST_ASSERT(almost_eq(J[i],g,1e-10));
+	}
+}
+
 void TestGradient::hansen01() {
 	IntervalMatrix H(30,30);
 	Ponts30 p30;
@@ -33,6 +33,7 @@ public:
 		TEST_ADD(TestGradient::dist);
 		TEST_ADD(TestGradient::jac01);
 		TEST_ADD(TestGradient::jac02);
+		TEST_ADD(TestGradient::jac03);
 		TEST_ADD(TestGradient::hansen01);
 		TEST_ADD(TestGradient::mulVV);
 		TEST_ADD(TestGradient::transpose01);
@@ -51,6 +52,7 @@ public:
 	void dist();
 	void jac01();
 	void jac02();
+	void jac03();
 	void hansen01();
 
 	void mulVV();
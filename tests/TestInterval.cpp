@@ -205,6 +205,25 @@ void TestInterval::getters06() {
 	TEST_ASSERT_DELTA_MSG(x.mag(),POS_INFINITY,ERROR,"mag");
 }
 
+/* the diameter/radius of a degenerated interval is +0 (not -0),
+ * so that dividing by it gives +oo (see CellDoubleHeap). */
+void TestInterval::getters07() {
+	double pts[] = { 0, 5, -3, 1e8, 0.1, -DBL_MAX };
+	for (int i=0; i<6; i++) {
+		Interval x(pts[i],pts[i]);
+		TEST_ASSERT(x.diam()==0);
+		TEST_ASSERT(x.rad()==0);
+		TEST_ASSERT(1/x.diam()==POS_INFINITY);
+		TEST_ASSERT(1/x.rad()==POS_INFINITY);
+	}
+#ifdef _IBEX_WITH_NATIVE_
+	TEST_ASSERT(1/native::add_up(5,-5)==POS_INFINITY);
+	TEST_ASSERT(1/native::sub_up(1e8,1e8)==POS_INFINITY);
+	TEST_ASSERT(1/native::mul_up(0,-2)==POS_INFINITY);
+	TEST_ASSERT(1/native::div_up(0,-2)==POS_INFINITY);
+#endif
+}
+
 
 void TestInterval::is_subset01()          { TEST_ASSERT(Interval(0,1).is_subset(Interval(0,2))); }
 void TestInterval::is_subset02()          { TEST_ASSERT(!Interval(0,1).is_subset(Interval(1,2))); }
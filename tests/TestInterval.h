@@ -56,6 +56,7 @@ public:
 		TEST_ADD(TestInterval::getters04);
 		TEST_ADD(TestInterval::getters05);
 		TEST_ADD(TestInterval::getters06);
+		TEST_ADD(TestInterval::getters07);
 
 		TEST_ADD(TestInterval::distance01);
 		TEST_ADD(TestInterval::distance02);
@@ -229,6 +230,7 @@ private:
 	void getters04();
 	void getters05();
 	void getters06();
+	void getters07();
 
 	/* test: is_subset */
     void is_subset01();
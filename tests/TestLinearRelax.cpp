@@ -0,0 +1,423 @@
+/* ============================================================================
+ * I B E X - Linear Relaxation Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestLinearRelax.h"
+#include "ibex_SystemFactory.h"
+#include "ibex_Cell.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+const int n=4;
+const int m=3;
+
+// the rows (with zeros)
+const double coef[m][n] = { {  1, 0, -2, 0 },
+                            {  0, 0,  0, 3.5 },
+                            { -1, 2,  0, 1 } };
+
+const double rhs[m] = { 1, -2, 0.5 };
+
+const CmpOp ops[m] = { LEQ, GEQ, LT };
+
+// the same rows, in compressed row format
+struct SparseRows {
+	SparseRows() : nnz(0) {
+		for (int i=0; i<m; i++) {
+			beg[i]=nnz;
+			for (int j=0; j<n; j++)
+				if (coef[i][j]!=0) {
+					ind[nnz]=j;
+					val[nnz++]=coef[i][j];
+				}
+		}
+		beg[m]=nnz;
+	}
+	int nnz;
+	int beg[m+1];
+	int ind[m*n];
+	double val[m*n];
+};
+
+void add_dense(LinearSolver& lp, const CmpOp* _ops=ops, double shift=0) {
+	for (int i=0; i<m; i++) {
+		Vector row(n);
+		for (int j=0; j<n; j++) row[j]=coef[i][j];
+		lp.addConstraint(row,_ops[i],rhs[i]+shift);
+	}
+}
+
+// same constraint matrix and same bounds
+bool same_rows(LinearSolver& lp1, LinearSolver& lp2, int nb_var=n) {
+	if (lp1.getNbRows()!=lp2.getNbRows()) return false;
+	int nb_rows=lp1.getNbRows();
+	Matrix A1(nb_rows,nb_var);
+	Matrix A2(nb_rows,nb_var);
+	IntervalVector B1(nb_rows);
+	IntervalVector B2(nb_rows);
+	lp1.getCoefConstraint(A1);
+	lp2.getCoefConstraint(A2);
+	lp1.getB(B1);
+	lp2.getB(B2);
+	return A1==A2 && B1==B2;
+}
+
+// all the rows of the LP are satisfied by the point p
+bool sound(LinearSolver& lp, const Vector& p) {
+	int nb_rows=lp.getNbRows();
+	Matrix A(nb_rows,p.size());
+	IntervalVector B(nb_rows);
+	lp.getCoefConstraint(A);
+	lp.getB(B);
+	for (int i=0; i<nb_rows; i++) {
+		Interval ax(0.0);
+		for (int j=0; j<p.size(); j++) ax+=A[i][j]*Interval(p[j]);
+		if (!ax.intersects(B[i].inflate(1e-9))) return false;
+	}
+	return true;
+}
+
+// y=1-x^2 and x*y<=0.5
+void sysex1(SystemFactory& fac) {
+	Variable x("x"),y("y");
+	fac.add_var(x);
+	fac.add_var(y);
+	fac.add_ctr(sqr(x)+y=1);
+	fac.add_ctr(x*y<=0.5);
+}
+
+// the solutions of sysex1 with x in [lb,ub]
+Vector solution(double lb, double ub, int i, int nb_points) {
+	Vector p(2);
+	p[0]=lb+(ub-lb)*i/(nb_points-1);
+	p[1]=1-p[0]*p[0];
+	return p;
+}
+
+// a relaxation that only adds the rows above
+// (with the right-hand sides shifted)
+class RowRelax : public LinearRelax {
+public:
+	RowRelax(const CmpOp* ops) : LinearRelax(m,n), ops(ops), shift(0) { }
+
+	int linearization(IntervalVector& box, LinearSolver* lp) {
+		SparseRows rows;
+		for (int i=0; i<m; i++)
+			add_row(rows.beg[i+1]-rows.beg[i], &rows.ind[rows.beg[i]], &rows.val[rows.beg[i]], ops[i], rhs[i]+shift);
+		return flush_rows(lp);
+	}
+
+	const CmpOp* ops;
+	double shift;
+};
+
+// min -x0-x1 subject to the rows above and x in [0,10]^n
+LinearSolver::Status_Sol solve_ex(LinearSolver& lp, Vector& prim, Vector& dual) {
+	lp.initBoundVar(IntervalVector(n,Interval(0,10)));
+	lp.setVarObj(0,-1);
+	lp.setVarObj(1,-1);
+	LinearSolver::Status_Sol stat=lp.solve();
+	if (stat==LinearSolver::OPTIMAL) {
+		lp.getPrimalSol(prim);
+		lp.getDualSol(dual);
+	}
+	return stat;
+}
+
+// optimum: x0=10 (upper bound), x3=0 (lower bound), x1=5.25 (third row).
+// The dual solution is unique: -1.5 for the bound of x0, 0.5 for
+// the bound of x3, -0.5 for the third row and 0 for the other rows.
+bool is_optimum(LinearSolver& lp, const Vector& prim, const Vector& dual) {
+	double _dual[n+m] = { -1.5, 0, 0, 0.5, 0, 0, -0.5 };
+	if (fabs(lp.getObjValue()+15.25)>1e-8) return false;
+	if (fabs(prim[0]-10)>1e-8 || fabs(prim[1]-5.25)>1e-8 || fabs(prim[3])>1e-8) return false;
+	for (int i=0; i<n+m; i++)
+		if (fabs(dual[i]-_dual[i])>1e-8) return false;
+	return true;
+}
+
+}
+
+void TestLinearRelax::sparse01() {
+	LinearSolver lp1(n,m);
+	LinearSolver lp2(n,m);
+	int nb_rows=lp1.getNbRows();
+	add_dense(lp1);
+	TEST_ASSERT(lp1.getNbRows()==nb_rows+m);
+
+	SparseRows rows;
+	for (int i=0; i<m; i++)
+		TEST_ASSERT(lp2.addConstraint(rows.beg[i+1]-rows.beg[i], &rows.ind[rows.beg[i]], &rows.val[rows.beg[i]], ops[i], rhs[i])==LinearSolver::OK);
+	TEST_ASSERT(same_rows(lp1,lp2));
+}
+
+void TestLinearRelax::sparse02() {
+	LinearSolver lp1(n,m);
+	LinearSolver lp2(n,m);
+	add_dense(lp1);
+
+	SparseRows rows;
+	TEST_ASSERT(lp2.addConstraints(m, rows.beg, rows.ind, rows.val, ops, rhs)==LinearSolver::OK);
+	TEST_ASSERT(same_rows(lp1,lp2));
+}
+
+void TestLinearRelax::solve01() {
+	LinearSolver lp1(n,m);
+	LinearSolver lp2(n,m);
+	add_dense(lp1);
+
+	SparseRows rows;
+	lp2.addConstraints(m, rows.beg, rows.ind, rows.val, ops, rhs);
+
+	Vector prim1(n), prim2(n);
+	Vector dual1(n+m), dual2(n+m);
+	TEST_ASSERT(solve_ex(lp1,prim1,dual1)==LinearSolver::OPTIMAL);
+	TEST_ASSERT(solve_ex(lp2,prim2,dual2)==LinearSolver::OPTIMAL);
+	TEST_ASSERT(is_optimum(lp1,prim1,dual1));
+	TEST_ASSERT(is_optimum(lp2,prim2,dual2));
+}
+
+void TestLinearRelax::solve02() {
+	LinearSolver lp(n,m);
+	IntervalVector box(n);
+	RowRelax relax(ops);
+	Vector prim(n);
+	Vector dual(n+m);
+
+	// the rows flushed after a cleanup replace the former ones
+	for (int k=0; k<2; k++) {
+		lp.cleanConst();
+		TEST_ASSERT(relax.linearization(box,&lp)==m);
+		TEST_ASSERT(lp.getNbRows()==n+m);
+		TEST_ASSERT(solve_ex(lp,prim,dual)==LinearSolver::OPTIMAL);
+		TEST_ASSERT(is_optimum(lp,prim,dual));
+	}
+}
+
+void TestLinearRelax::flush01() {
+	LinearSolver lp1(n,m);
+	LinearSolver lp2(n,m);
+	add_dense(lp1);
+
+	IntervalVector box(n);
+	RowRelax relax(ops);
+	int nb_rows=lp2.getNbRows();
+	TEST_ASSERT(relax.linearization(box,&lp2)==m);
+	TEST_ASSERT(lp2.getNbRows()==nb_rows+m);
+	TEST_ASSERT(same_rows(lp1,lp2));
+
+	// the pending rows have been removed and
+	// the rows of the last linearization are reused
+	TEST_ASSERT(relax.linearization(box,&lp2)==m);
+	TEST_ASSERT(lp2.getNbRows()==nb_rows+m);
+	TEST_ASSERT(same_rows(lp1,lp2));
+}
+
+void TestLinearRelax::flush02() {
+	// equality rows are not accepted by the solvers
+	const CmpOp eq_ops[m] = { LEQ, EQ, GEQ };
+	LinearSolver lp(n,m);
+
+	IntervalVector box(n);
+	RowRelax relax(eq_ops);
+	int nb_rows=lp.getNbRows();
+	// depending on the solver, all the rows or only the
+	// valid ones are rejected: the count must be exact.
+	int nb_added=relax.linearization(box,&lp);
+	TEST_ASSERT(nb_added<m);
+	TEST_ASSERT(lp.getNbRows()==nb_rows+nb_added);
+}
+
+void TestLinearRelax::flush03() {
+	LinearSolver lp(n,m);
+	IntervalVector box(n);
+	CmpOp ops2[m] = { LEQ, GEQ, LT };
+	RowRelax relax(ops2);
+	int nb_rows=lp.getNbRows();
+	relax.linearization(box,&lp);
+	TEST_ASSERT(relax.keeps_rows(&lp));
+
+	// only the right-hand sides change
+	relax.shift=1;
+	TEST_ASSERT(relax.linearization(box,&lp)==m);
+	TEST_ASSERT(lp.getNbRows()==nb_rows+m);
+	LinearSolver lp1(n,m);
+	add_dense(lp1,ops2,1);
+	TEST_ASSERT(same_rows(lp,lp1));
+
+	// the second row changes: the last two rows are replaced
+	ops2[1]=LEQ;
+	TEST_ASSERT(relax.linearization(box,&lp)==m);
+	TEST_ASSERT(lp.getNbRows()==nb_rows+m);
+	LinearSolver lp2(n,m);
+	add_dense(lp2,ops2,1);
+	TEST_ASSERT(same_rows(lp,lp2));
+
+	// a row has been added in-between: the rows are not reused
+	Vector row(n,1.0);
+	lp.addConstraint(row,LEQ,10);
+	TEST_ASSERT(relax.linearization(box,&lp)==m);
+	TEST_ASSERT(lp.getNbRows()==nb_rows+2*m+1);
+	TEST_ASSERT(relax.keeps_rows(&lp));
+	TEST_ASSERT(!relax.keeps_rows(&lp1));
+}
+
+void TestLinearRelax::solve03() {
+	LinearSolver lp(n,m);
+	IntervalVector box(n);
+	RowRelax relax(ops);
+	Vector prim(n), prim1(n);
+	Vector dual(n+m), dual1(n+m);
+
+	relax.linearization(box,&lp);
+	TEST_ASSERT(solve_ex(lp,prim,dual)==LinearSolver::OPTIMAL);
+	TEST_ASSERT(is_optimum(lp,prim,dual));
+
+	// the right-hand sides of the rows kept in the solver are updated
+	relax.shift=1;
+	relax.linearization(box,&lp);
+	TEST_ASSERT(lp.getNbRows()==n+m);
+	LinearSolver lp1(n,m);
+	add_dense(lp1,ops,1);
+	TEST_ASSERT(solve_ex(lp,prim,dual)==LinearSolver::OPTIMAL);
+	TEST_ASSERT(solve_ex(lp1,prim1,dual1)==LinearSolver::OPTIMAL);
+	TEST_ASSERT(fabs(lp.getObjValue()-lp1.getObjValue())<1e-8);
+	TEST_ASSERT(fabs(prim[0]-prim1[0])<1e-8 && fabs(prim[1]-prim1[1])<1e-8);
+
+	relax.shift=0;
+	relax.linearization(box,&lp);
+	TEST_ASSERT(solve_ex(lp,prim,dual)==LinearSolver::OPTIMAL);
+	TEST_ASSERT(is_optimum(lp,prim,dual));
+}
+
+void TestLinearRelax::xtaylor01() {
+	SystemFactory fac;
+	sysex1(fac);
+	System sys(fac);
+	sys.box=IntervalVector(2,Interval(-10,10));
+	vector<LinearRelaxXTaylor::corner_point> cpoints;
+	cpoints.push_back(LinearRelaxXTaylor::INF_X);
+	cpoints.push_back(LinearRelaxXTaylor::SUP_X);
+	LinearRelaxXTaylor relax(sys,cpoints,LinearRelaxXTaylor::TAYLOR);
+	LinearRelaxXTaylor fresh(sys,cpoints,LinearRelaxXTaylor::TAYLOR);
+
+	double _box0[][2] = { {-1,1}, {-1,2} };
+	IntervalVector box0(2,_box0);
+	LinearSolver lp0(2,sys.nb_ctr);
+	relax.linearization(box0,&lp0);
+
+	// contracted by less than the reuse ratio: the gradients are reused
+	double _box1[][2] = { {-0.95,0.95}, {-0.95,1.9} };
+	IntervalVector box1(2,_box1);
+	LinearSolver lp1(2,sys.nb_ctr);
+	LinearSolver lp2(2,sys.nb_ctr);
+	int nb_rows=relax.linearization(box1,&lp1);
+	TEST_ASSERT(fresh.linearization(box1,&lp2)==nb_rows);
+	TEST_ASSERT(nb_rows>0);
+	TEST_ASSERT(!same_rows(lp1,lp2,2));
+	TEST_ASSERT(box1==IntervalVector(2,_box1));
+
+	for (int i=0; i<21; i++) {
+		Vector p=solution(-0.95,0.95,i,21);
+		TEST_ASSERT(sound(lp1,p));
+		TEST_ASSERT(sound(lp2,p));
+	}
+}
+
+void TestLinearRelax::xtaylor02() {
+	SystemFactory fac;
+	sysex1(fac);
+	System sys(fac);
+	sys.box=IntervalVector(2,Interval(-10,10));
+	vector<LinearRelaxXTaylor::corner_point> cpoints;
+	cpoints.push_back(LinearRelaxXTaylor::INF_X);
+	cpoints.push_back(LinearRelaxXTaylor::SUP_X);
+	LinearRelaxXTaylor relax(sys,cpoints,LinearRelaxXTaylor::TAYLOR);
+
+	double _box0[][2] = { {-1,1}, {-1,2} };
+	IntervalVector box0(2,_box0);
+	LinearSolver lp0(2,sys.nb_ctr);
+	relax.linearization(box0,&lp0);
+
+	// box2 is not a subset of box0, box3 is much smaller:
+	// the rows are the same as with a fresh relaxation
+	double _box2[][2] = { {0,1.5}, {-1.25,1} };
+	double _box3[][2] = { {0.25,0.5}, {0.5,1} };
+	IntervalVector box2(2,_box2);
+	IntervalVector box3(2,_box3);
+
+	for (int k=0; k<2; k++) {
+		IntervalVector& box = k==0 ? box2 : box3;
+		LinearRelaxXTaylor fresh(sys,cpoints,LinearRelaxXTaylor::TAYLOR);
+		LinearSolver lp1(2,sys.nb_ctr);
+		LinearSolver lp2(2,sys.nb_ctr);
+		int nb_rows=relax.linearization(box,&lp1);
+		TEST_ASSERT(fresh.linearization(box,&lp2)==nb_rows);
+		TEST_ASSERT(nb_rows>0);
+		TEST_ASSERT(same_rows(lp1,lp2,2));
+
+		for (int i=0; i<21; i++)
+			TEST_ASSERT(sound(lp1,solution(box[0].lb(),box[0].ub(),i,21)));
+	}
+}
+
+void TestLinearRelax::xtaylor03() {
+	SystemFactory fac;
+	sysex1(fac);
+	System sys(fac);
+	sys.box=IntervalVector(2,Interval(-10,10));
+	vector<LinearRelaxXTaylor::corner_point> cpoints;
+	cpoints.push_back(LinearRelaxXTaylor::INF_X);
+	cpoints.push_back(LinearRelaxXTaylor::SUP_X);
+	LinearRelaxXTaylor relax(sys,cpoints,LinearRelaxXTaylor::TAYLOR);
+	LinearRelaxXTaylor ref(sys,cpoints,LinearRelaxXTaylor::TAYLOR);
+
+	double _box0[][2] = { {-1,1}, {-1,2} };
+	double _box1[][2] = { {-0.95,0.95}, {-0.95,1.9} };
+	double _box2[][2] = { {0,1.5}, {-1.25,1} };
+	IntervalVector box0(2,_box0);
+	IntervalVector box1(2,_box1);
+	IntervalVector box2(2,_box2);
+
+	Cell* root=new Cell(box0);
+	relax.add_backtrackable(*root);
+	TEST_ASSERT(root->data.used(typeid(XTaylorGradients).name()));
+
+	LinearSolver lp0(2,sys.nb_ctr);
+	relax.set_cell(root);
+	relax.linearization(box0,&lp0);
+	pair<Cell*,Cell*> cells=root->bisect(box1,box1);
+	delete root;
+
+	// gradients computed outside of the cells
+	relax.set_cell(NULL);
+	relax.linearization(box2,&lp0);
+
+	// the gradients of the root cell are reused in the child
+	LinearSolver lp1(2,sys.nb_ctr);
+	LinearSolver lp2(2,sys.nb_ctr);
+	relax.set_cell(cells.first);
+	int nb_rows=relax.linearization(box1,&lp1);
+	ref.linearization(box0,&lp2);
+	lp2.cleanConst();
+	TEST_ASSERT(ref.linearization(box1,&lp2)==nb_rows);
+	TEST_ASSERT(nb_rows>0);
+	TEST_ASSERT(same_rows(lp1,lp2,2));
+
+	relax.set_cell(NULL);
+	delete cells.first;
+	delete cells.second;
+}
+
+} // namespace ibex
@@ -0,0 +1,66 @@
+/* ============================================================================
+ * I B E X - Linear Relaxation Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_LINEAR_RELAX_H__
+#define __TEST_LINEAR_RELAX_H__
+
+#include "cpptest.h"
+#include "ibex_LinearSolver.h"
+#include "ibex_LinearRelax.h"
+#include "ibex_LinearRelaxXTaylor.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestLinearRelax : public TestIbex {
+
+public:
+	TestLinearRelax() {
+
+		TEST_ADD(TestLinearRelax::sparse01);
+		TEST_ADD(TestLinearRelax::sparse02);
+		TEST_ADD(TestLinearRelax::solve01);
+		TEST_ADD(TestLinearRelax::solve02);
+		TEST_ADD(TestLinearRelax::solve03);
+		TEST_ADD(TestLinearRelax::flush01);
+		TEST_ADD(TestLinearRelax::flush02);
+		TEST_ADD(TestLinearRelax::flush03);
+		TEST_ADD(TestLinearRelax::xtaylor01);
+		TEST_ADD(TestLinearRelax::xtaylor02);
+		TEST_ADD(TestLinearRelax::xtaylor03);
+	}
+
+	// sparse rows added one by one (same rows as the dense ones)
+	void sparse01();
+	// sparse rows added at once (same rows as the dense ones)
+	void sparse02();
+	// same optimum and dual solution with dense and sparse rows
+	void solve01();
+	// same optimum with the rows flushed by a relaxation, after cleanConst
+	void solve02();
+	// same optimum with the rows kept by a relaxation (the right-hand sides are updated)
+	void solve03();
+	// number of rows added by the relaxation
+	void flush01();
+	// number of rows added by the relaxation, with a rejected row
+	void flush02();
+	// rows kept in the solver (only the rows that change are replaced)
+	void flush03();
+	// rows built with reused gradients (TAYLOR mode) are sound
+	void xtaylor01();
+	// gradients are recomputed when the box leaves (or strongly shrinks in) their domain
+	void xtaylor02();
+	// gradients stored in the cells (TAYLOR mode)
+	void xtaylor03();
+};
+
+} // namespace ibex
+#endif // __TEST_LINEAR_RELAX_H__
@@ -0,0 +1,107 @@
+/* ============================================================================
+ * I B E X - Multi-box HC4Revise Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestMultiBoxHC4Revise.h"
+#include "ibex_HC4Revise.h"
+
+using namespace std;
+
+namespace ibex {
+
+void TestMultiBoxHC4Revise::check(const Function& f, const Interval& y, const Array<IntervalVector>& boxes, int block_size) {
+	int K=boxes.size();
+
+	Array<IntervalVector> batch(K);
+	for (int k=0; k<K; k++) batch.set_ref(k,*new IntervalVector(boxes[k]));
+	bool* inactive=new bool[K];
+
+	int nb_nonempty=MultiBoxHC4Revise(f,block_size).proj(y,batch,inactive);
+
+	Domain d(Dim::scalar());
+	d.i()=y;
+	int nb=0;
+	for (int k=0; k<K; k++) {
+		IntervalVector box(boxes[k]);
+		bool in=false;
+		try {
+			in=HC4Revise().proj(f,d,box);
+		} catch(EmptyBoxException&) {
+			box.set_empty();
+		}
+		if (!box.is_empty()) nb++;
+		TEST_ASSERT(batch[k]==box);
+		if (!box.is_empty()) TEST_ASSERT(inactive[k]==in);
+	}
+	TEST_ASSERT(nb_nonempty==nb);
+
+	for (int k=0; k<K; k++) delete &batch[k];
+	delete[] inactive;
+}
+
+// a grid of boxes with a number of boxes which is not
+// a multiple of the block size (empty and inactive cases included)
+void TestMultiBoxHC4Revise::batch01() {
+	Variable x,y;
+	Function f(x,y,sqr(x)*y-exp(x)+sin(y)/(1+sqr(y))-x*y);
+
+	const int N=7;
+	Array<IntervalVector> boxes(N*N);
+	for (int i=0; i<N; i++)
+		for (int j=0; j<N; j++) {
+			IntervalVector* box=new IntervalVector(2);
+			(*box)[0]=Interval(-3+i*0.8,-3+(i+1)*0.8+0.1);
+			(*box)[1]=Interval(-2+j*0.6,-2+(j+1)*0.6+0.1);
+			boxes.set_ref(i*N+j,*box);
+		}
+
+	check(f,Interval(-1,1),boxes,8);
+	check(f,Interval(-100,100),boxes,8);
+	check(f,Interval::ZERO,boxes,MultiBoxHC4Revise::default_block_size);
+
+	for (int k=0; k<N*N; k++) delete &boxes[k];
+}
+
+// constants, vector variables used through indices and an empty box
+void TestMultiBoxHC4Revise::batch02() {
+	Variable x(3);
+	Function f(x,x[0]*x[1]-2*x[2]+pow(x[0],3));
+
+	Array<IntervalVector> boxes(5);
+	for (int k=0; k<5; k++) {
+		IntervalVector* box=new IntervalVector(3);
+		(*box)[0]=Interval(-1+0.5*k,1+0.5*k);
+		(*box)[1]=Interval(0,1+k);
+		(*box)[2]=Interval(-k,k);
+		boxes.set_ref(k,*box);
+	}
+	boxes[3].set_empty();
+
+	check(f,Interval(0,1),boxes,2);
+
+	for (int k=0; k<5; k++) delete &boxes[k];
+}
+
+// a function with vector operations (no batch)
+void TestMultiBoxHC4Revise::batch03() {
+	Variable x(2);
+	Function f(x,x*x);
+
+	TEST_ASSERT(!f.cf.point_ok);
+
+	Array<IntervalVector> boxes(3);
+	for (int k=0; k<3; k++) boxes.set_ref(k,*new IntervalVector(2,Interval(-k,k+1)));
+
+	check(f,Interval(1,2),boxes,2);
+
+	for (int k=0; k<3; k++) delete &boxes[k];
+}
+
+} // namespace ibex
@@ -0,0 +1,41 @@
+/* ============================================================================
+ * I B E X - Multi-box HC4Revise Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_MULTI_BOX_HC4_REVISE_H__
+#define __TEST_MULTI_BOX_HC4_REVISE_H__
+
+#include "cpptest.h"
+#include "ibex_MultiBoxHC4Revise.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestMultiBoxHC4Revise : public TestIbex {
+
+public:
+	TestMultiBoxHC4Revise() {
+
+		TEST_ADD(TestMultiBoxHC4Revise::batch01);
+		TEST_ADD(TestMultiBoxHC4Revise::batch02);
+		TEST_ADD(TestMultiBoxHC4Revise::batch03);
+	}
+
+	void batch01();
+	void batch02();
+	void batch03();
+
+private:
+	// check that the batch gives the same result as HC4Revise on each box
+	void check(const Function& f, const Interval& y, const Array<IntervalVector>& boxes, int block_size);
+};
+
+} // namespace ibex
+#endif // __TEST_MULTI_BOX_HC4_REVISE_H__
@@ -0,0 +1,75 @@
+/* ============================================================================
+ * I B E X - Parallel Function Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestParallelFnc.h"
+#include "ibex_Setting.h"
+#include "ibex_Expr.h"
+#include "Ponts30.h"
+
+using namespace std;
+
+namespace ibex {
+
+void TestParallelFnc::ponts01() {
+	Ponts30 p30;
+	Function& f=*p30.f;
+	ParallelFnc pf(f,4,10);
+
+#ifdef _IBEX_WITH_THREADS_
+	TEST_ASSERT(pf.nb_chunks()>1);
+	TEST_ASSERT(pf.nb_threads()==4);
+#else
+	// Ibex is configured without threads
+	TEST_ASSERT(pf.nb_chunks()==0);
+	TEST_ASSERT(pf.nb_threads()==1);
+#endif
+
+	IntervalVector box=p30.init_box;
+
+	// the threads are reused from one call to the other
+	for (int k=0; k<10; k++) {
+		TEST_ASSERT(pf.eval_vector(box)==f.eval_vector(box));
+
+		IntervalMatrix J(30,30);
+		IntervalMatrix J2(30,30);
+		pf.jacobian(box,J);
+		f.jacobian(box,J2);
+		TEST_ASSERT(J==J2);
+
+		box=box.mid()+0.1*(box-box.mid());
+	}
+}
+
+void TestParallelFnc::seq01() {
+	Variable x,y;
+	Function f(x,y,Return(sqr(x)-y,x*y));
+	ParallelFnc pf(f);
+
+	TEST_ASSERT(pf.nb_chunks()==0);
+
+	IntervalVector box(2);
+	box[0]=Interval(1,2);
+	box[1]=Interval(3,4);
+
+	IntervalVector y_(2);
+	y_[0]=Interval(-3,1);
+	y_[1]=Interval(3,8);
+	TEST_ASSERT(pf.eval_vector(box)==y_);
+
+	IntervalMatrix J(2,2);
+	pf.jacobian(box,J);
+	TEST_ASSERT(J[0][0]==Interval(2,4));
+	TEST_ASSERT(J[0][1]==Interval(-1,-1));
+	TEST_ASSERT(J[1][0]==Interval(3,4));
+	TEST_ASSERT(J[1][1]==Interval(1,2));
+}
+
+} // end namespace ibex
@@ -0,0 +1,35 @@
+/* ============================================================================
+ * I B E X - Parallel Function Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_PARALLEL_FNC_H__
+#define __TEST_PARALLEL_FNC_H__
+
+#include "cpptest.h"
+#include "ibex_ParallelFnc.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestParallelFnc : public TestIbex {
+
+public:
+	TestParallelFnc() {
+
+		TEST_ADD(TestParallelFnc::ponts01);
+		TEST_ADD(TestParallelFnc::seq01);
+	}
+
+	void ponts01();
+	void seq01();
+};
+
+} // namespace ibex
+#endif // __TEST_PARALLEL_FNC_H__
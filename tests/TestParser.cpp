@@ -5,21 +5,71 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Jun 22, 2012
-// Last Update : Jun 22, 2012
+// Last Update : Oct 19, 2026
 //============================================================================
 
 #include <sstream>
+#include <fstream>
+#include <locale>
+#include <clocale>
 
 #include "TestParser.h"
+#include "ibex_Setting.h"
 #include "ibex_System.h"
 #include "ibex_SyntaxError.h"
 #include "ibex_CtcFwdBwd.h"
 #include "Ponts30.h"
 
+#ifdef _IBEX_WITH_THREADS_
+#include <pthread.h>
+#endif
+
 using namespace std;
 
 namespace ibex {
 
+namespace {
+
+// content of a file
+string read_file(const char* filename) {
+	ifstream in(filename);
+	stringstream s;
+	s << in.rdbuf();
+	return s.str();
+}
+
+// a locale with the comma as decimal separator
+class CommaNumpunct : public numpunct<char> {
+protected:
+	char do_decimal_point() const { return ','; }
+	char do_thousands_sep() const { return '.'; }
+};
+
+// loads the same system several times
+struct ParseTask {
+	const string* source;
+	Interval value;  // value of the (first) function at the initial box
+	bool ok;         // true if all the loaded systems are the same
+};
+
+void* parse_task(void* arg) {
+	ParseTask& task=*(ParseTask*) arg;
+	task.ok=true;
+	try {
+		for (int k=0; k<10; k++) {
+			System sys(task.source->c_str(), task.source->size());
+			Interval v=sys.f[0].eval(sys.box);
+			if (k==0) task.value=v;
+			task.ok &= (sys.nb_var==30 && sys.nb_ctr==30 && v==task.value);
+		}
+	} catch(SyntaxError&) {
+		task.ok=false;
+	}
+	return NULL;
+}
+
+}
+
 void TestParser::var01() {
 	System sys("quimper/var01.qpr");
 	TEST_ASSERT(sys.func.is_empty());
@@ -305,6 +355,109 @@ void TestParser::loop01() {
 	}
 }
 
+void TestParser::buffer01() {
+	string source=read_file("quimper/ponts.qpr");
+	System sys(source.c_str(), source.size());
+	System sys2("quimper/ponts.qpr");
+	TEST_ASSERT(sys.args.size()==30);
+	for (int i=0; i<30; i++)
+		TEST_ASSERT(strcmp(sys.args[i].name,sys2.args[i].name)==0);
+	TEST_ASSERT(sys.box==sys2.box);
+	TEST_ASSERT(sameExpr(sys.f.expr(),sys2.f.expr()));
+	TEST_ASSERT(sys.ctrs.size()==30);
+	for (int i=0; i<30; i++) {
+		TEST_ASSERT(sameExpr(sys.ctrs[i].f.expr(),sys2.ctrs[i].f.expr()));
+		TEST_ASSERT(sys.ctrs[i].op==sys2.ctrs[i].op);
+	}
+}
+
+void TestParser::buffer02() {
+	// the buffer is not null-terminated
+	const char source[]="Variables x in [0.5,1.25]; Constraints x=1; end garbage";
+	System sys(source, sizeof(source)-1-8);
+	TEST_ASSERT(sys.nb_var==1);
+	TEST_ASSERT(sys.nb_ctr==1);
+	TEST_ASSERT(sys.box[0]==Interval(0.5,1.25));
+
+	TEST_THROWS(System(source, sizeof(source)-1),SyntaxError&);
+}
+
+void TestParser::locale01() {
+	const char source[]="Variables x in [0.5,1.25]; y in [-1e-1,1.5e2]; Constraints x=y; end";
+
+	locale old=locale::global(locale(locale::classic(), new CommaNumpunct()));
+	// also changes the C locale if a locale with a comma is installed
+	string old_c=setlocale(LC_NUMERIC,NULL);
+	if (!setlocale(LC_NUMERIC,"fr_FR.UTF-8")) setlocale(LC_NUMERIC,"de_DE.UTF-8");
+
+	System sys(source, sizeof(source)-1);
+
+	setlocale(LC_NUMERIC,old_c.c_str());
+	locale::global(old);
+
+	TEST_ASSERT(sys.box[0]==Interval(0.5,1.25));
+	TEST_ASSERT(sys.box[1]==Interval(-0.1,150));
+}
+
+void TestParser::thread01() {
+	string source=read_file("quimper/ponts.qpr");
+	ParseTask task[2];
+#ifdef _IBEX_WITH_THREADS_
+	pthread_t thread[2];
+	for (int i=0; i<2; i++) {
+		task[i].source=&source;
+		TEST_ASSERT(pthread_create(&thread[i], NULL, parse_task, &task[i])==0);
+	}
+	for (int i=0; i<2; i++)
+		pthread_join(thread[i], NULL);
+#else
+	// Ibex is configured without threads: the tasks are run in sequence
+	for (int i=0; i<2; i++) {
+		task[i].source=&source;
+		parse_task(&task[i]);
+	}
+#endif
+
+	System sys("quimper/ponts.qpr");
+	Interval v=sys.f[0].eval(sys.box);
+	for (int i=0; i<2; i++) {
+		TEST_ASSERT(task[i].ok);
+		TEST_ASSERT(task[i].value==v);
+	}
+}
+
+void TestParser::lexer01() {
+	// keywords, comments and numbers in all their forms
+	const char source[]=
+			"VARIABLES\n"
+			"  x in [.5,1.25e0]; /* a comment\n"
+			"                       on two lines */\n"
+			"  y in [-1234567,1e+3]; // two floats\n"
+			"Constraints\n"
+			"  x+y>=0;\n"
+			"END";
+	System sys(source, sizeof(source)-1);
+	TEST_ASSERT(sys.nb_var==2);
+	TEST_ASSERT(sys.nb_ctr==1);
+	TEST_ASSERT(sys.box[0]==Interval(0.5,1.25));
+	TEST_ASSERT(sys.box[1]==Interval(-1234567,1000));
+
+	// the newlines in the comments are counted
+	const char error[]=
+			"Variables x; /* 1\n"
+			"2 */ // 3\n"
+			"Constraints\n"
+			"  x+@=0;\n"
+			"end";
+	try {
+		System sys2(error, sizeof(error)-1);
+		TEST_ASSERT(false);
+	} catch(SyntaxError& e) {
+		TEST_ASSERT(e.line==4);
+		TEST_ASSERT(e.token && strcmp(e.token,"@")==0);
+	}
+}
+
 void TestParser::error01() {
 	TEST_THROWS(System("quimper/error01.qpr"),SyntaxError&);
 }
@@ -37,6 +37,11 @@ public:
 		TEST_ADD(TestParser::func02);
 		TEST_ADD(TestParser::func03);
 		TEST_ADD(TestParser::loop01);
+		TEST_ADD(TestParser::buffer01);
+		TEST_ADD(TestParser::buffer02);
+		TEST_ADD(TestParser::locale01);
+		TEST_ADD(TestParser::thread01);
+		TEST_ADD(TestParser::lexer01);
 		//		TEST_ADD(TestParser::error01);
 	}
 
@@ -57,6 +62,11 @@ public:
 	void choco01();
 	void error01();
 	void loop01();
+	void buffer01();
+	void buffer02();
+	void locale01();
+	void thread01();
+	void lexer01();
 
 };
 
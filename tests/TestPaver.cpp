@@ -0,0 +1,176 @@
+/* ============================================================================
+ * I B E X - Paver Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestPaver.h"
+#include "ibex_CtcFwdBwd.h"
+#include "ibex_CtcEmpty.h"
+#include "ibex_PdcDiameterLT.h"
+#include "ibex_RoundRobin.h"
+#include "ibex_LargestFirst.h"
+#include "ibex_CellStack.h"
+#include "ibex_EmptyBoxException.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// halves the first component while it is larger than 0.25
+class CtcHalve : public Ctc {
+public:
+	CtcHalve() : calls(0) { }
+
+	void contract(IntervalVector& box) {
+		calls++;
+		if (box[0].diam()>0.25)
+			box[0]=Interval(box[0].lb(),box[0].mid());
+	}
+
+	int calls;
+};
+
+// removes the box when the first component is smaller than 0.25
+class CtcSmall : public Ctc {
+public:
+	void contract(IntervalVector& box) {
+		if (box[0].diam()<=0.25) {
+			box.set_empty();
+			throw EmptyBoxException();
+		}
+	}
+};
+
+}
+
+void TestPaver::fixpoint01() {
+	CtcHalve halve;
+	CtcSmall small;
+	Array<Ctc> ctc(halve,small);
+	RoundRobin rr(0);
+	CellStack stack;
+	Paver p(ctc,rr,stack);
+
+	// the fixpoint removes the whole box, without bisection
+	int i;
+	IntervalVector box(1);
+	p.start(IntervalVector(1,Interval(0,4)));
+
+	double ub[] = { 4, 2, 1, 0.5 };
+	for (int k=0; k<4; k++) {
+		TEST_ASSERT(p.next(i,box));
+		TEST_ASSERT(i==0);
+		TEST_ASSERT(box[0]==Interval(ub[k]/2,ub[k]));
+	}
+	TEST_ASSERT(p.next(i,box));
+	TEST_ASSERT(i==1);
+	TEST_ASSERT(box[0]==Interval(0,0.25));
+	TEST_ASSERT(!p.next(i,box));
+
+	TEST_ASSERT(halve.calls==4);
+	TEST_ASSERT(p.paving->size()==5);
+	delete p.paving;
+}
+
+void TestPaver::fixpoint02() {
+	CtcHalve halve;
+	CtcSmall small;
+	Array<Ctc> ctc(halve,small);
+	RoundRobin rr(0);
+	CellStack stack;
+	Paver p(ctc,rr,stack);
+
+	// without the fixpoint loop, each contractor is called once per cell
+	p.ctc_loop=false;
+	Paving paving(IntervalVector(1,Interval(0,4)));
+	p.pave(paving);
+	TEST_ASSERT(paving.volume(0)+paving.volume(1)==4);
+	TEST_ASSERT(paving.volume(Paving::UNKNOWN)==0);
+	TEST_ASSERT(paving.tag(Vector(1,3.0))==0);
+	TEST_ASSERT(paving.tag(Vector(1,0.125))==1);
+	TEST_ASSERT(halve.calls>4);
+}
+
+void TestPaver::sivia01() {
+	Variable x,y;
+	Function f(x,y,sqr(x)+sqr(y));
+	NumConstraint c1(x,y,f(x,y)<=4);
+	NumConstraint c2(x,y,f(x,y)>=1);
+	CtcFwdBwd out1(c1);
+	CtcFwdBwd out2(c2);
+	PdcDiameterLT prec(0.1);
+	CtcEmpty boundary(prec);
+	Array<Ctc> ctc(out1,out2,boundary);
+	LargestFirst lf(0.1);
+	CellStack stack;
+	Paver p(ctc,lf,stack);
+
+	IntervalVector box(2,Interval(-3,3));
+	Paving paving(box);
+	p.pave(paving);
+
+	// the whole box is classified
+	double vol=0;
+	for (int i=0; i<3; i++) vol+=paving.volume(i);
+	TEST_ASSERT(almost_eq(Interval(vol),Interval(36),1e-10));
+	TEST_ASSERT(paving.volume(Paving::UNKNOWN)==0);
+
+	// the boxes removed by a contractor do not satisfy its constraint
+	for (int i=0; i<2; i++) {
+		vector<IntervalVector> boxes;
+		paving.boxes(i,boxes);
+		TEST_ASSERT(!boxes.empty());
+		for (vector<IntervalVector>::const_iterator it=boxes.begin(); it!=boxes.end(); it++) {
+			Interval r=f.eval(*it);
+			TEST_ASSERT(i==0? r.lb()>=4 : r.ub()<=1);
+		}
+	}
+
+	// the ring (of area 3*pi) is covered by the boundary
+	TEST_ASSERT(paving.volume(2)>=3*Interval::PI.lb());
+	TEST_ASSERT(paving.tag(Vector(2,0.0))==1);
+	TEST_ASSERT(paving.tag(Vector(2,2.5))==0);
+}
+
+void TestPaver::compat01() {
+	Variable x,y;
+	Function f(x,y,sqr(x)+sqr(y));
+	NumConstraint c1(x,y,f(x,y)<=4);
+	NumConstraint c2(x,y,f(x,y)>=1);
+	CtcFwdBwd out1(c1);
+	CtcFwdBwd out2(c2);
+	PdcDiameterLT prec(0.1);
+	CtcEmpty boundary(prec);
+	Array<Ctc> ctc(out1,out2,boundary);
+	LargestFirst lf(0.1);
+	CellStack stack;
+	Paver p(ctc,lf,stack);
+
+	IntervalVector box(2,Interval(-3,3));
+	Paving paving(box);
+	p.pave(paving);
+
+	// one subpaving per contractor, with the leaves of the paving
+	SubPaving* sub=p.pave(box);
+	TEST_ASSERT(p.paving==NULL);
+	for (int i=0; i<3; i++) {
+		vector<IntervalVector> boxes;
+		paving.boxes(i,boxes);
+		TEST_ASSERT(sub[i].size()==(int) boxes.size());
+		for (int k=0; k<sub[i].size(); k++) {
+			TEST_ASSERT(sub[i].traces[k].first==boxes[k]);
+			TEST_ASSERT(sub[i].traces[k].second.is_empty());
+		}
+	}
+	delete[] sub;
+}
+
+} // namespace ibex
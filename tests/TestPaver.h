@@ -0,0 +1,39 @@
+/* ============================================================================
+ * I B E X - Paver Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_PAVER_H__
+#define __TEST_PAVER_H__
+
+#include "cpptest.h"
+#include "ibex_Paver.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestPaver : public TestIbex {
+
+public:
+	TestPaver() {
+
+		TEST_ADD(TestPaver::fixpoint01);
+		TEST_ADD(TestPaver::fixpoint02);
+		TEST_ADD(TestPaver::sivia01);
+		TEST_ADD(TestPaver::compat01);
+	}
+
+	void fixpoint01();
+	void fixpoint02();
+	void sivia01();
+	void compat01();
+};
+
+} // namespace ibex
+#endif // __TEST_PAVER_H__
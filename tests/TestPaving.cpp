@@ -0,0 +1,133 @@
+/* ============================================================================
+ * I B E X - Paving Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestPaving.h"
+#include <stdio.h>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// [0,4]x[0,4] with [1,3]x[1,3] tagged 1, the rest tagged 0.
+Paving* square() {
+	IntervalVector box(2,Interval(0,4));
+	Paving* p=new Paving(box);
+	IntervalVector after(2,Interval(1,3));
+	Paving::Node* leaf=p->contract(p->root(),box,after,0);
+	leaf->var=1;
+	return p;
+}
+
+}
+
+void TestPaving::contract01() {
+	IntervalVector box(2,Interval(0,4));
+	Paving p(box);
+	IntervalVector after(2,Interval(1,3));
+	vector<IntervalVector> removed;
+	Paving::Node* leaf=p.contract(p.root(),box,after,0,&removed);
+
+	TEST_ASSERT(leaf!=NULL && leaf->is_leaf());
+	TEST_ASSERT(leaf->var==Paving::UNKNOWN);
+	TEST_ASSERT(box==after);
+	TEST_ASSERT(p.size()==5);
+	TEST_ASSERT(removed.size()==4);
+	TEST_ASSERT(almost_eq(Interval(p.volume(0)),Interval(12),1e-10));
+	TEST_ASSERT(almost_eq(Interval(p.volume(Paving::UNKNOWN)),Interval(4),1e-10));
+
+	vector<IntervalVector> list;
+	p.boxes(Paving::UNKNOWN,list);
+	TEST_ASSERT(list.size()==1);
+	TEST_ASSERT(list[0]==after);
+}
+
+void TestPaving::contract02() {
+	Paving* p=square();
+	IntervalVector box(2,Interval(1,3));
+
+	pair<Paving::Node*,Paving::Node*> leaves=p->bisect(p->root()->right->left->right->left, 0, 2);
+	IntervalVector empty=IntervalVector::empty(2);
+	IntervalVector left=box;
+	left[0]=Interval(1,2);
+	TEST_ASSERT(p->contract(leaves.first,left,empty,2)==NULL);
+	TEST_ASSERT(p->size()==6);
+	TEST_ASSERT(almost_eq(Interval(p->volume(2)),Interval(2),1e-10));
+	TEST_ASSERT(almost_eq(Interval(p->volume(1)),Interval(2),1e-10));
+
+	Vector pt(2);
+	pt[0]=1.5; pt[1]=2;
+	TEST_ASSERT(p->tag(pt)==2);
+	pt[0]=2.5;
+	TEST_ASSERT(p->tag(pt)==1);
+	pt[0]=0.5;
+	TEST_ASSERT(p->tag(pt)==0);
+	pt[0]=5;
+	TEST_ASSERT(p->tag(pt)==Paving::UNKNOWN);
+	delete p;
+}
+
+void TestPaving::unite01() {
+	Paving* p=square();
+	IntervalVector box(2,Interval(0,4));
+	Paving q(box);
+	q.bisect(q.root(),0,2).first->var=1;
+
+	p->unite(q,1);
+	TEST_ASSERT(almost_eq(Interval(p->volume(1)),Interval(10),1e-10));
+	TEST_ASSERT(almost_eq(Interval(p->volume(0)),Interval(6),1e-10));
+
+	Vector pt(2);
+	pt[0]=0.5; pt[1]=3.5;
+	TEST_ASSERT(p->tag(pt)==1);
+	pt[0]=3.5;
+	TEST_ASSERT(p->tag(pt)==0);
+	delete p;
+}
+
+void TestPaving::intersect01() {
+	Paving* p=square();
+	IntervalVector box(2,Interval(0,4));
+	Paving q(box);
+	q.bisect(q.root(),0,2).first->var=1;
+
+	p->intersect(q,1,0);
+	TEST_ASSERT(almost_eq(Interval(p->volume(1)),Interval(2),1e-10));
+	TEST_ASSERT(almost_eq(Interval(p->volume(0)),Interval(14),1e-10));
+
+	vector<IntervalVector> list;
+	p->boxes(1,list);
+	TEST_ASSERT(list.size()==1);
+	IntervalVector res(2,Interval(1,3));
+	res[0]=Interval(1,2);
+	TEST_ASSERT(list[0]==res);
+	delete p;
+}
+
+void TestPaving::save01() {
+	Paving* p=square();
+	char filename[]="subpaving.tmp";
+	p->save(filename);
+	Paving q(filename);
+	TEST_ASSERT(q.box()==p->box());
+	TEST_ASSERT(q.size()==p->size());
+	TEST_ASSERT(almost_eq(Interval(q.volume(1)),Interval(4),1e-10));
+
+	FILE* fd=fopen(filename,"wb");
+	fputs("IBEXPAV",fd);
+	fclose(fd);
+	TEST_THROWS(Paving r(filename), Paving::InvalidFile);
+	remove(filename);
+	delete p;
+}
+
+} // end namespace ibex
@@ -0,0 +1,41 @@
+/* ============================================================================
+ * I B E X - Paving Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_PAVING_H__
+#define __TEST_PAVING_H__
+
+#include "cpptest.h"
+#include "ibex_Paving.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestPaving : public TestIbex {
+
+public:
+	TestPaving() {
+
+		TEST_ADD(TestPaving::contract01);
+		TEST_ADD(TestPaving::contract02);
+		TEST_ADD(TestPaving::unite01);
+		TEST_ADD(TestPaving::intersect01);
+		TEST_ADD(TestPaving::save01);
+	}
+
+	void contract01();
+	void contract02();
+	void unite01();
+	void intersect01();
+	void save01();
+};
+
+} // namespace ibex
+#endif // __TEST_PAVING__
@@ -0,0 +1,157 @@
+/* ============================================================================
+ * I B E X - Set Image Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestSetImage.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+double volume(const vector<IntervalVector>& boxes) {
+	double v=0;
+	for (unsigned int i=0; i<boxes.size(); i++)
+		v+=boxes[i].volume();
+	return v;
+}
+
+// true if all the boxes of the first list are in the second one
+bool included(const vector<IntervalVector>& l1, const vector<IntervalVector>& l2) {
+	for (unsigned int i=0; i<l1.size(); i++) {
+		bool found=false;
+		for (unsigned int j=0; !found && j<l2.size(); j++)
+			found = l1[i]==l2[j];
+		if (!found) return false;
+	}
+	return true;
+}
+
+}
+
+void TestSetImage::next01() {
+	// image of [0,1]x[0,1] by a rotation (up to a factor)
+	Variable x1,x2;
+	Function f(x1,x2,Return(x1+x2,x1-x2));
+	IntervalVector box(2,Interval(0,1));
+	SetImage img(f,box);
+	TEST_ASSERT(img.precision()==-1);
+
+	img.start(box,0.1);
+	TEST_ASSERT(img.precision()==0.1);
+
+	IntervalVector y(2);
+	BoolInterval status;
+	vector<IntervalVector> in,bound;
+	while (img.next(y,status)) {
+		TEST_ASSERT(status==YES || status==MAYBE);
+		if (status==YES) {
+			in.push_back(y);
+			TEST_ASSERT(img.interior().back()==y);
+		} else {
+			bound.push_back(y);
+			TEST_ASSERT(img.boundary().back()==y);
+		}
+	}
+	TEST_ASSERT(!in.empty());
+	TEST_ASSERT(!bound.empty());
+	TEST_ASSERT(in==img.interior());
+	TEST_ASSERT(bound==img.boundary());
+	// the paving is over
+	TEST_ASSERT(!img.next(y,status));
+
+	// same result in one call
+	SetImage img2(f,box);
+	img2.pave(box,0.1);
+	TEST_ASSERT(img2.interior()==in);
+	TEST_ASSERT(img2.boundary()==bound);
+}
+
+void TestSetImage::refine01() {
+	Variable x1,x2;
+	Function f(x1,x2,Return(x1+x2,x1-x2));
+	IntervalVector box(2,Interval(0,1));
+	SetImage img(f,box);
+	img.pave(box,0.25);
+	vector<IntervalVector> in=img.interior();
+	double vb=volume(img.boundary());
+
+	img.refine(0.1);
+	TEST_ASSERT(img.precision()==0.1);
+	TEST_ASSERT(img.boundary().empty());
+	TEST_ASSERT(img.interior()==in);
+
+	IntervalVector y(2);
+	BoolInterval status;
+	while (img.next(y,status)) { }
+
+	// the inner boxes are kept
+	TEST_ASSERT(img.interior().size()>in.size());
+	for (unsigned int i=0; i<in.size(); i++)
+		TEST_ASSERT(img.interior()[i]==in[i]);
+	TEST_ASSERT(volume(img.boundary())<vb);
+
+	// same paving as from scratch
+	SetImage img2(f,box);
+	img2.pave(box,0.1);
+	TEST_ASSERT(img2.interior().size()==img.interior().size());
+	TEST_ASSERT(img2.boundary().size()==img.boundary().size());
+	TEST_ASSERT(included(img.interior(),img2.interior()));
+	TEST_ASSERT(included(img.boundary(),img2.boundary()));
+}
+
+void TestSetImage::resume01() {
+	Variable x1,x2;
+	Function f(x1,x2,Return(x1+x2,x1-x2));
+	IntervalVector box(2,Interval(0,1));
+	SetImage img(f,box);
+	img.pave(box,0.25);
+	vector<IntervalVector> in=img.interior();
+	vector<IntervalVector> bound=img.boundary();
+
+	// larger precision: nothing to do
+	img.pave(box,0.5);
+	TEST_ASSERT(img.precision()==0.25);
+	TEST_ASSERT(img.interior()==in);
+	TEST_ASSERT(img.boundary()==bound);
+
+	// smaller precision: resumed from the boundary
+	img.pave(box,0.1);
+	TEST_ASSERT(img.precision()==0.1);
+	for (unsigned int i=0; i<in.size(); i++)
+		TEST_ASSERT(img.interior()[i]==in[i]);
+
+	SetImage img2(f,box);
+	img2.pave(box,0.1);
+	TEST_ASSERT(img2.interior().size()==img.interior().size());
+	TEST_ASSERT(img2.boundary().size()==img.boundary().size());
+	TEST_ASSERT(included(img.interior(),img2.interior()));
+	TEST_ASSERT(included(img.boundary(),img2.boundary()));
+}
+
+void TestSetImage::restart01() {
+	Variable x1,x2;
+	Function f(x1,x2,Return(x1+x2,x1-x2));
+	IntervalVector box(2,Interval(0,1));
+	SetImage img(f,box);
+	img.pave(box,0.1);
+
+	// another box: calculated from scratch
+	IntervalVector box2(2,Interval(0,0.5));
+	img.pave(box2,0.1);
+
+	SetImage img2(f,box);
+	img2.pave(box2,0.1);
+	TEST_ASSERT(img.interior()==img2.interior());
+	TEST_ASSERT(img.boundary()==img2.boundary());
+}
+
+} // namespace ibex
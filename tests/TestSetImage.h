@@ -0,0 +1,39 @@
+/* ============================================================================
+ * I B E X - Set Image Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_SET_IMAGE_H__
+#define __TEST_SET_IMAGE_H__
+
+#include "cpptest.h"
+#include "ibex_SetImage.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestSetImage : public TestIbex {
+
+public:
+	TestSetImage() {
+
+		TEST_ADD(TestSetImage::next01);
+		TEST_ADD(TestSetImage::refine01);
+		TEST_ADD(TestSetImage::resume01);
+		TEST_ADD(TestSetImage::restart01);
+	}
+
+	void next01();
+	void refine01();
+	void resume01();
+	void restart01();
+};
+
+} // namespace ibex
+#endif // __TEST_SET_IMAGE_H__
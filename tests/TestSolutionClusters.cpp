@@ -0,0 +1,110 @@
+/* ============================================================================
+ * I B E X - Solution Clusters Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestSolutionClusters.h"
+#include "ibex_Function.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+IntervalVector square(double x, double y, double w) {
+	IntervalVector box(2);
+	box[0]=Interval(x,x+w);
+	box[1]=Interval(y,y+w);
+	return box;
+}
+
+}
+
+void TestSolutionClusters::merge01() {
+	SolutionClusters cl(2);
+
+	// a row of 100 adjacent boxes, added in a "random" order
+	for (int i=0; i<100; i++)
+		cl.add(square((i*37)%100,0,1));
+
+	// two isolated boxes
+	cl.add(square(0,10,1));
+	cl.add(square(50,10,1));
+
+	TEST_ASSERT(cl.size()==3);
+
+	int total=0;
+	for (int i=0; i<cl.size(); i++) {
+		total+=cl[i].nb_boxes;
+		if (cl[i].nb_boxes==100) {
+			TEST_ASSERT(cl[i].hull==(square(0,0,1)|square(99,0,1)));
+		} else {
+			TEST_ASSERT(cl[i].nb_boxes==1);
+		}
+	}
+	TEST_ASSERT(total==102);
+}
+
+void TestSolutionClusters::merge02() {
+	SolutionClusters cl(2,10);
+
+	for (int i=0; i<100; i++)
+		cl.add(square(i,0,1));
+
+	TEST_ASSERT(cl.size()==10);
+	for (int i=0; i<cl.size(); i++)
+		TEST_ASSERT(cl[i].hull.max_diam()<=10);
+}
+
+void TestSolutionClusters::certify01() {
+	Variable x,y;
+	Function f(x,y,Return(x-y,x+y-1));
+
+	SolutionClusters cl(f);
+	const SolutionClusters::Cluster& c=cl.add(square(0.5-1e-8,0.5-1e-8,2e-8));
+	TEST_ASSERT(c.certified);
+	TEST_ASSERT(c.region.contains(Vector(2,0.5)));
+	TEST_ASSERT(cl.covered(IntervalVector(2,Interval(0.5))));
+	TEST_ASSERT(!cl.covered(square(0.7,0.7,1e-9)));
+
+	// a box close to the solution
+	cl.add(square(0.5-1e-9,0.5-1e-9,2e-9));
+	TEST_ASSERT(cl.size()==1);
+	TEST_ASSERT(cl[0].nb_boxes==2);
+}
+
+void TestSolutionClusters::exclusion01() {
+	Variable x,y;
+	Function f(x,y,Return(x-y,x+y-1));
+
+	SolutionClusters cl(f,POS_INFINITY,true);
+	const SolutionClusters::Cluster& c=cl.add(square(0.5-1e-8,0.5-1e-8,2e-8));
+	TEST_ASSERT(c.certified);
+	// f is linear: the solution is unique everywhere
+	TEST_ASSERT(c.region.max_diam()>1);
+
+	IntervalVector box=square(0.4,0.4,0.2);
+	TEST_ASSERT(cl.trim(box));
+
+	// a box that overlaps the region on the right
+	double r=c.region[0].ub();
+	box=square(r-0.5,0.4,1);
+	box[1]=c.region[1];
+	TEST_ASSERT(!cl.trim(box));
+	TEST_ASSERT(box[0]==Interval(r,r+0.5));
+
+	// a box that overlaps the region on a corner cannot be trimmed
+	box=square(r-0.5,c.region[1].ub()-0.5,1);
+	IntervalVector box2(box);
+	TEST_ASSERT(!cl.trim(box));
+	TEST_ASSERT(box==box2);
+}
+
+} // end namespace ibex
@@ -0,0 +1,39 @@
+/* ============================================================================
+ * I B E X - Solution Clusters Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_SOLUTION_CLUSTERS_H__
+#define __TEST_SOLUTION_CLUSTERS_H__
+
+#include "cpptest.h"
+#include "ibex_SolutionClusters.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestSolutionClusters : public TestIbex {
+
+public:
+	TestSolutionClusters() {
+
+		TEST_ADD(TestSolutionClusters::merge01);
+		TEST_ADD(TestSolutionClusters::merge02);
+		TEST_ADD(TestSolutionClusters::certify01);
+		TEST_ADD(TestSolutionClusters::exclusion01);
+	}
+
+	void merge01();
+	void merge02();
+	void certify01();
+	void exclusion01();
+};
+
+} // namespace ibex
+#endif // __TEST_SOLUTION_CLUSTERS__
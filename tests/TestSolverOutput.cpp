@@ -0,0 +1,191 @@
+/* ============================================================================
+ * I B E X - Solver Output Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestSolverOutput.h"
+#include "ibex_Solver.h"
+#include "ibex_CtcFwdBwd.h"
+#include "ibex_RoundRobin.h"
+#include "ibex_CellStack.h"
+#include <stdio.h>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// stores the solutions and pauses the search every "period" solutions
+// (never if period=0)
+class PauseOutput : public SolverOutput {
+public:
+	PauseOutput(int period) : period(period) { }
+
+	bool push(const IntervalVector& sol) {
+		sols.push_back(sol);
+		return period==0 || sols.size()%period!=0;
+	}
+
+	unsigned int period;
+	vector<IntervalVector> sols;
+};
+
+// the unit circle: a curve, hence many solutions
+class Circle {
+public:
+	Circle() : f(x,y,sqr(x)+sqr(y)-1), c(f,EQ), ctc(c), rr(0.1),
+		solver(ctc,rr,stack), box(2,Interval(-2,2)) { }
+
+	Variable x,y;
+	Function f;
+	NumConstraint c;
+	CtcFwdBwd ctc;
+	RoundRobin rr;
+	CellStack stack;
+	Solver solver;
+	IntervalVector box;
+};
+
+bool same(const vector<IntervalVector>& s1, const vector<IntervalVector>& s2) {
+	if (s1.size()!=s2.size()) return false;
+	for (unsigned int i=0; i<s1.size(); i++)
+		if (s1[i]!=s2[i]) return false;
+	return true;
+}
+
+void copy_file(const char* from, const char* to, long size) {
+	FILE* in=fopen(from,"rb");
+	FILE* out=fopen(to,"wb");
+	for (long i=0; i<size; i++) fputc(fgetc(in),out);
+	fclose(in);
+	fclose(out);
+}
+
+}
+
+void TestSolverOutput::stream01() {
+	Circle pb;
+	vector<IntervalVector> ref=pb.solver.solve(pb.box);
+	TEST_ASSERT(ref.size()>10);
+
+	PauseOutput out(0);
+	TEST_ASSERT(!pb.solver.solve(pb.box,out));
+	TEST_ASSERT(same(out.sols,ref));
+	TEST_ASSERT(pb.stack.empty());
+}
+
+void TestSolverOutput::pause01() {
+	Circle pb;
+	vector<IntervalVector> ref=pb.solver.solve(pb.box);
+
+	PauseOutput out(3);
+	int calls=1;
+	bool paused=pb.solver.solve(pb.box,out);
+	while (paused) {
+		// the search is paused right after the consumer refused a solution
+		TEST_ASSERT(out.sols.size()==3*calls);
+		TEST_ASSERT(!pb.stack.empty() || out.sols.size()==ref.size());
+		paused=pb.solver.next(out);
+		calls++;
+	}
+	TEST_ASSERT(same(out.sols,ref));
+	TEST_ASSERT(calls==(int) ref.size()/3+1);
+}
+
+void TestSolverOutput::restart01() {
+	Circle pb;
+	vector<IntervalVector> ref=pb.solver.solve(pb.box);
+
+	// a paused search is dropped by a new one
+	PauseOutput out(1);
+	TEST_ASSERT(pb.solver.solve(pb.box,out));
+	TEST_ASSERT(pb.solver.solve(pb.box,out));
+	TEST_ASSERT(out.sols.size()==2);
+	TEST_ASSERT(out.sols[0]==ref[0] && out.sols[1]==ref[0]);
+}
+
+void TestSolverOutput::binary01() {
+	Circle pb;
+	vector<IntervalVector> ref=pb.solver.solve(pb.box);
+
+	char filename[]="solutions.tmp";
+	{
+		// a small buffer, flushed several times
+		SolverBinaryOutput out(filename,2,4);
+		TEST_ASSERT(!pb.solver.solve(pb.box,out));
+		TEST_ASSERT(out.nb_sols()==(long) ref.size());
+	}
+	vector<IntervalVector> sols;
+	SolverBinaryOutput::read(filename,sols);
+	TEST_ASSERT(same(sols,ref));
+
+	// exact values (including infinite bounds)
+	{
+		SolverBinaryOutput out(filename,2);
+		IntervalVector x(2);
+		x[0]=Interval(-0.1,1e-300);
+		x[1]=Interval(NEG_INFINITY,1);
+		out.push(x);
+		x[1]=Interval::ALL_REALS;
+		out.push(x);
+	}
+	sols.clear();
+	SolverBinaryOutput::read(filename,sols);
+	TEST_ASSERT(sols.size()==2);
+	TEST_ASSERT(sols[0][0]==Interval(-0.1,1e-300));
+	TEST_ASSERT(sols[0][1]==Interval(NEG_INFINITY,1));
+	TEST_ASSERT(sols[1][1]==Interval::ALL_REALS);
+	remove(filename);
+}
+
+void TestSolverOutput::binary02() {
+	char filename[]="solutions.tmp";
+	char filename2[]="solutions2.tmp";
+	{
+		SolverBinaryOutput out(filename,3);
+		out.push(IntervalVector(3,Interval(0,1)));
+		out.push(IntervalVector(3,Interval(1,2)));
+	}
+	// header: 8+2*sizeof(int) bytes
+	long size=8+2*sizeof(int)+2*6*sizeof(double);
+	vector<IntervalVector> sols;
+
+	// a whole solution is missing: undetectable
+	copy_file(filename,filename2,size-6*sizeof(double));
+	SolverBinaryOutput::read(filename2,sols);
+	TEST_ASSERT(sols.size()==1);
+
+	// truncated solution
+	sols.clear();
+	copy_file(filename,filename2,size-sizeof(double));
+	TEST_THROWS(SolverBinaryOutput::read(filename2,sols), SolverBinaryOutput::InvalidFile);
+
+	// truncated header
+	sols.clear();
+	copy_file(filename,filename2,10);
+	TEST_THROWS(SolverBinaryOutput::read(filename2,sols), SolverBinaryOutput::InvalidFile);
+
+	FILE* fd=fopen(filename2,"wb");
+	fputs("IBEXPAV",fd);
+	fclose(fd);
+	TEST_THROWS(SolverBinaryOutput::read(filename2,sols), SolverBinaryOutput::InvalidFile);
+
+	remove(filename);
+	remove(filename2);
+}
+
+void TestSolverOutput::write_failure01() {
+#ifdef __linux__
+	// all the writes into /dev/full fail with ENOSPC
+	TEST_THROWS(SolverBinaryOutput out("/dev/full",2), SolverBinaryOutput::WriteFailure);
+#endif
+}
+
+} // namespace ibex
@@ -0,0 +1,43 @@
+/* ============================================================================
+ * I B E X - Solver Output Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_SOLVER_OUTPUT_H__
+#define __TEST_SOLVER_OUTPUT_H__
+
+#include "cpptest.h"
+#include "ibex_SolverOutput.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestSolverOutput : public TestIbex {
+
+public:
+	TestSolverOutput() {
+
+		TEST_ADD(TestSolverOutput::stream01);
+		TEST_ADD(TestSolverOutput::pause01);
+		TEST_ADD(TestSolverOutput::restart01);
+		TEST_ADD(TestSolverOutput::binary01);
+		TEST_ADD(TestSolverOutput::binary02);
+		TEST_ADD(TestSolverOutput::write_failure01);
+	}
+
+	void stream01();
+	void pause01();
+	void restart01();
+	void binary01();
+	void binary02();
+	void write_failure01();
+};
+
+} // namespace ibex
+#endif // __TEST_SOLVER_OUTPUT_H__
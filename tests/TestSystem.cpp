@@ -15,7 +15,9 @@
 #include "ibex_SystemFactory.h"
 #include "ibex_SyntaxError.h"
 #include "ibex_NormalizedSystem.h"
+#include "ibex_SystemCache.h"
 
+#include <stdio.h>
 #include <sstream>
 
 using namespace std;
@@ -362,4 +364,130 @@ void TestSystem::merge04() {
 		TEST_ASSERT(sameExpr(sys3.ctrs[sys1.nb_ctr+i].f.expr(),sys2.ctrs[i].f.expr()));
 }
 
+void TestSystem::check_same(System& sys1, System& sys2) {
+	TEST_ASSERT(sys1.nb_var==sys2.nb_var);
+	TEST_ASSERT(sys1.nb_ctr==sys2.nb_ctr);
+	TEST_ASSERT(sys1.args.size()==sys2.args.size());
+	for (int i=0; i<sys1.args.size(); i++) {
+		TEST_ASSERT(strcmp(sys1.args[i].name,sys2.args[i].name)==0);
+		TEST_ASSERT(sys1.args[i].dim==sys2.args[i].dim);
+	}
+	TEST_ASSERT(sys1.box==sys2.box);
+	TEST_ASSERT(sys1.func.size()==sys2.func.size());
+	TEST_ASSERT((sys1.goal==NULL)==(sys2.goal==NULL));
+	if (sys1.goal)
+		TEST_ASSERT(sameExpr(sys1.goal->expr(),sys2.goal->expr()));
+	TEST_ASSERT(sys1.ctrs.size()==sys2.ctrs.size());
+	for (int i=0; i<sys1.ctrs.size(); i++) {
+		TEST_ASSERT(sameExpr(sys1.ctrs[i].f.expr(),sys2.ctrs[i].f.expr()));
+		TEST_ASSERT(sys1.ctrs[i].op==sys2.ctrs[i].op);
+	}
+	if (sys1.nb_ctr>0) {
+		TEST_ASSERT(sameExpr(sys1.f.expr(),sys2.f.expr()));
+		TEST_ASSERT(sys1.f.eval_vector(sys1.box)==sys2.f.eval_vector(sys2.box));
+	}
+}
+
+void TestSystem::cache01() {
+	System& sys(*sysex1());
+	SystemCache::write("sysex1.cache",sys);
+
+	SystemCache cache("sysex1.cache");
+	TEST_ASSERT(cache.from_cache);
+	TEST_ASSERT(cache.content()==0);
+	check_same(sys,cache.system());
+
+	delete &sys;
+	remove("sysex1.cache");
+}
+
+void TestSystem::cache02() {
+	System sys("quimper/func02.qpr");
+	remove("func02.cache");
+
+	{
+		SystemCache cache("quimper/func02.qpr","func02.cache");
+		TEST_ASSERT(!cache.from_cache);
+		check_same(sys,cache.system());
+	}
+
+	SystemCache cache("quimper/func02.qpr","func02.cache");
+	TEST_ASSERT(cache.from_cache);
+	check_same(sys,cache.system());
+	// the constraints still call the auxiliary functions
+	TEST_ASSERT(cache.system().func.size()==3);
+	TEST_ASSERT(sameExpr(cache.system().ctrs[0].f.expr(),"(x2-f1(x1))"));
+
+	remove("func02.cache");
+}
+
+void TestSystem::cache03() {
+	System& sys(*sysex2());
+	NormalizedSystem norm(sys,1e-8);
+	ExtendedSystem ext(sys,1e-8);
+	SystemCache::write("sysex2.cache",sys,&norm,&ext,true,1e-8);
+
+	SystemCache cache("sysex2.cache");
+	TEST_ASSERT(cache.content()==(SystemCache::NORMALIZED | SystemCache::EXTENDED | SystemCache::DIFF));
+	check_same(sys,cache.system());
+	check_same(norm,cache.normalized());
+	check_same(ext,cache.extended());
+	for (int i=0; i<norm.nb_ctr; i++)
+		TEST_ASSERT(cache.normalized().original_index(i)==norm.original_index(i));
+	TEST_ASSERT(strcmp(cache.extended().args[ext.args.size()-1].name,ExtendedSystem::goal_name())==0);
+
+	// derivatives read from the cache
+	TEST_ASSERT(sameExpr(cache.system().goal->diff().expr(),sys.goal->diff().expr()));
+	for (int i=0; i<norm.nb_ctr; i++)
+		TEST_ASSERT(sameExpr(cache.normalized().ctrs[i].f.diff().expr(),norm.ctrs[i].f.diff().expr()));
+
+	delete &sys;
+	remove("sysex2.cache");
+}
+
+void TestSystem::cache04() {
+	const char* src1="variables x,y; constraints x+y=0; end";
+	const char* src2="variables x,y; constraints x-y=0; end";
+
+	FILE* fd=fopen("cache04.bch","w");
+	fputs(src1,fd);
+	fclose(fd);
+	remove("cache04.cache");
+
+	{ SystemCache cache("cache04.bch","cache04.cache");
+	  TEST_ASSERT(!cache.from_cache); }
+	{ SystemCache cache("cache04.bch","cache04.cache");
+	  TEST_ASSERT(cache.from_cache);
+	  TEST_ASSERT(sameExpr(cache.system().ctrs[0].f.expr(),"(x+y)")); }
+	// a variant not in the cache
+	{ SystemCache cache("cache04.bch","cache04.cache",SystemCache::NORMALIZED);
+	  TEST_ASSERT(!cache.from_cache); }
+	{ SystemCache cache("cache04.bch","cache04.cache");
+	  TEST_ASSERT(cache.from_cache);
+	  TEST_ASSERT(cache.content()==SystemCache::NORMALIZED); }
+
+	// the source file is modified: the cache is stale
+	fd=fopen("cache04.bch","w");
+	fputs(src2,fd);
+	fclose(fd);
+	{ SystemCache cache("cache04.bch","cache04.cache");
+	  TEST_ASSERT(!cache.from_cache);
+	  TEST_ASSERT(sameExpr(cache.system().ctrs[0].f.expr(),"(x-y)")); }
+
+	// a corrupted cache file
+	fd=fopen("cache04.cache","r+");
+	fseek(fd,-1,SEEK_END);
+	fputc('#',fd);
+	fclose(fd);
+	try {
+		SystemCache cache("cache04.cache");
+		TEST_ASSERT(false);
+	} catch(SystemCache::InvalidCache&) { }
+	{ SystemCache cache("cache04.bch","cache04.cache");
+	  TEST_ASSERT(!cache.from_cache); }
+
+	remove("cache04.bch");
+	remove("cache04.cache");
+}
+
 } // end namespace
@@ -14,6 +14,7 @@
 
 #include "cpptest.h"
 #include "utils.h"
+#include "ibex_System.h"
 
 namespace ibex {
 
@@ -36,6 +37,10 @@ public:
 		TEST_ADD(TestSystem::merge02);
 		TEST_ADD(TestSystem::merge03);
 		TEST_ADD(TestSystem::merge04);
+		TEST_ADD(TestSystem::cache01);
+		TEST_ADD(TestSystem::cache02);
+		TEST_ADD(TestSystem::cache03);
+		TEST_ADD(TestSystem::cache04);
 	}
 
 	void factory01();
@@ -53,6 +58,13 @@ public:
 	void merge02();
 	void merge03();
 	void merge04();
+	void cache01();
+	void cache02();
+	void cache03();
+	void cache04();
+
+private:
+	void check_same(System& sys1, System& sys2);
 };
 
 } // end namespace
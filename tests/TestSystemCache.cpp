@@ -0,0 +1,180 @@
+/* ============================================================================
+ * I B E X - System Cache Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestSystemCache.h"
+
+#include <stdio.h>
+#include <string>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+const char* source_file="cache01.tmp.qpr";
+const char* cache_file="cache01.tmp.cache";
+
+// the source: a system of one variable with a
+// (one-argument) auxiliary function
+const char* univariate=
+		"variables\n"
+		"  x in [-1,2];\n"
+		"function g(y)\n"
+		"  return y^3;\n"
+		"end\n"
+		"constraints\n"
+		"  g(x)-x=0;\n"
+		"  x^2-x<=0;\n"
+		"end\n";
+
+void write_file(const char* filename, const string& text) {
+	FILE* fd=fopen(filename,"wb");
+	fwrite(text.data(),1,text.size(),fd);
+	fclose(fd);
+}
+
+string read_file(const char* filename) {
+	FILE* fd=fopen(filename,"rb");
+	string s;
+	char buf[4096];
+	size_t n;
+	while ((n=fread(buf,1,sizeof(buf),fd))>0)
+		s.append(buf,n);
+	fclose(fd);
+	return s;
+}
+
+// same layout as in ibex_SystemCache.cpp
+struct Header {
+	char magic[8];
+	int version;
+	unsigned int byte_order;
+	int size_of_double;
+	int content;
+	double eps;
+	unsigned long long source_hash;
+	unsigned long long body_hash;
+	unsigned long long body_size;
+};
+
+}
+
+void TestSystemCache::univariate01() {
+	write_file(source_file,univariate);
+	remove(cache_file);
+
+	IntervalVector box(1,Interval(1,2));
+	{
+		SystemCache cache(source_file,cache_file,SystemCache::DIFF);
+		TEST_ASSERT(!cache.from_cache);
+	}
+	{
+		SystemCache cache(source_file,cache_file,SystemCache::DIFF);
+		TEST_ASSERT(cache.from_cache);
+		System& sys=cache.system();
+		TEST_ASSERT(sys.nb_var==1);
+		TEST_ASSERT(sys.nb_ctr==2);
+		TEST_ASSERT(sys.func.size()==1);
+		// derivatives read from the cache
+		check(sys.func[0].diff().eval(box),Interval(3,12));
+		check(sys.ctrs[1].f.diff().eval(box),Interval(1,3));
+		// second derivative (not in the cache)
+		check(sys.ctrs[1].f.diff().diff().eval(box),Interval(2,2));
+		check(sys.ctrs[0].f.eval(box),Interval(-1,7));
+	}
+	remove(cache_file);
+	remove(source_file);
+}
+
+void TestSystemCache::ponts01() {
+	remove(cache_file);
+	int content=SystemCache::NORMALIZED | SystemCache::EXTENDED | SystemCache::DIFF;
+	{
+		SystemCache cache("quimper/ponts.qpr",cache_file,content);
+		TEST_ASSERT(!cache.from_cache);
+	}
+
+	System sys("quimper/ponts.qpr");
+	NormalizedSystem norm(sys);
+	ExtendedSystem ext(sys);
+
+	SystemCache cache("quimper/ponts.qpr",cache_file,content);
+	TEST_ASSERT(cache.from_cache);
+	TEST_ASSERT(cache.content()==content);
+	TEST_ASSERT(cache.system().nb_var==30);
+	TEST_ASSERT(cache.system().nb_ctr==30);
+	TEST_ASSERT(cache.system().box==sys.box);
+	TEST_ASSERT(cache.system().f.eval_vector(sys.box)==sys.f.eval_vector(sys.box));
+	for (int i=0; i<30; i++)
+		TEST_ASSERT(cache.system().ctrs[i].f.diff().eval_vector(sys.box)==sys.ctrs[i].f.diff().eval_vector(sys.box));
+	TEST_ASSERT(cache.normalized().nb_ctr==norm.nb_ctr);
+	TEST_ASSERT(cache.normalized().f.eval_vector(sys.box)==norm.f.eval_vector(sys.box));
+	TEST_ASSERT(cache.extended().nb_var==ext.nb_var);
+	TEST_ASSERT(cache.extended().nb_ctr==ext.nb_ctr);
+	remove(cache_file);
+}
+
+void TestSystemCache::stale01() {
+	write_file(source_file,univariate);
+	remove(cache_file);
+	{
+		SystemCache cache(source_file,cache_file);
+		TEST_ASSERT(!cache.from_cache);
+	}
+	{
+		// DIFF was not in the cache
+		SystemCache cache(source_file,cache_file,SystemCache::DIFF);
+		TEST_ASSERT(!cache.from_cache);
+	}
+	write_file(source_file,string(univariate)+"\n");
+	{
+		SystemCache cache(source_file,cache_file,SystemCache::DIFF);
+		TEST_ASSERT(!cache.from_cache);
+	}
+	{
+		SystemCache cache(source_file,cache_file,SystemCache::DIFF);
+		TEST_ASSERT(cache.from_cache);
+	}
+	remove(cache_file);
+	remove(source_file);
+}
+
+void TestSystemCache::truncated01() {
+	write_file(source_file,univariate);
+	remove(cache_file);
+	{
+		SystemCache cache(source_file,cache_file,SystemCache::NORMALIZED | SystemCache::DIFF);
+	}
+	string data=read_file(cache_file);
+	TEST_ASSERT(data.size()>sizeof(Header));
+	size_t body_size=data.size()-sizeof(Header);
+
+	// the body is truncated but the header is consistent: the
+	// file is only rejected when a system is partially read.
+	for (size_t size=0; size<body_size; size+=body_size/20+1) {
+		string cut=data.substr(0,sizeof(Header)+size);
+		Header& h=*(Header*) &cut[0];
+		h.body_size=size;
+		h.body_hash=SystemCache::hash(cut.data()+sizeof(Header),size);
+		write_file(cache_file,cut);
+		TEST_THROWS(SystemCache cache(cache_file),SystemCache::InvalidCache&);
+		// the source is parsed again
+		SystemCache cache(source_file,cache_file,SystemCache::NORMALIZED | SystemCache::DIFF);
+		TEST_ASSERT(!cache.from_cache);
+		TEST_ASSERT(cache.system().nb_ctr==2);
+		write_file(cache_file,data);
+	}
+	remove(cache_file);
+	remove(source_file);
+}
+
+} // namespace ibex
@@ -0,0 +1,39 @@
+/* ============================================================================
+ * I B E X - System Cache Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_SYSTEM_CACHE_H__
+#define __TEST_SYSTEM_CACHE_H__
+
+#include "cpptest.h"
+#include "ibex_SystemCache.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestSystemCache : public TestIbex {
+
+public:
+	TestSystemCache() {
+
+		TEST_ADD(TestSystemCache::univariate01);
+		TEST_ADD(TestSystemCache::ponts01);
+		TEST_ADD(TestSystemCache::stale01);
+		TEST_ADD(TestSystemCache::truncated01);
+	}
+
+	void univariate01();
+	void ponts01();
+	void stale01();
+	void truncated01();
+};
+
+} // namespace ibex
+#endif // __TEST_SYSTEM_CACHE_H__
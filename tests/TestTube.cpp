@@ -0,0 +1,259 @@
+/* ============================================================================
+ * I B E X - Tube Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestTube.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+const double dt=0.5;
+const int n=37;
+
+// a tube over [0,18.5] with bounded slices of various widths
+// (all the bounds are multiples of 0.25 so that sums are exact)
+Tube tube() {
+	Tube x(0,n*dt,dt);
+	for (int i=0; i<n; i++) {
+		double lb=((i*7)%11)*0.25-1;
+		x.set(i,Interval(lb,lb+((i*3)%5)*0.25));
+	}
+	return x;
+}
+
+Interval naive_hull(const Tube& x, int kmin, int kmax) {
+	Interval h=Interval::EMPTY_SET;
+	for (int i=kmin; i<=kmax; i++) h |= x[i];
+	return h;
+}
+
+Interval naive_integral(const Tube& x, int kmin, int kmax) {
+	Interval s(0,0);
+	for (int i=kmin; i<=kmax; i++) s += x[i]*x.get_delta_t();
+	return s;
+}
+
+// a degenerate derivative (the Euler steps are then exact)
+Tube deriv() {
+	Tube v(0,n*dt,dt);
+	for (int i=0; i<n; i++)
+		v.set(i,Interval(0.5*(i%3)-0.5));
+	return v;
+}
+
+// forward and backward sweeps over all the slices
+void naive_fwdbwd(Tube& x, const Tube& v) {
+	for (int i=0; i<n-1; i++)
+		x.set(i+1,x[i+1] & (x[i]+v[i]*x.get_delta_t()));
+	for (int i=n-1; i>=1; i--)
+		x.set(i-1,x[i-1] & (x[i]-v[i-1]*x.get_delta_t()));
+}
+
+}
+
+void TestTube::at01() {
+	Tube x=tube();
+	TEST_ASSERT(x.size()==n);
+	for (int kmin=0; kmin<n; kmin++)
+		for (int kmax=kmin; kmax<n; kmax++)
+			TEST_ASSERT(x.at(Interval(kmin*dt,(kmax+1)*dt))==naive_hull(x,kmin,kmax));
+	// a time inside the 4th slice
+	TEST_ASSERT(x.at(Interval(1.6,1.7))==x[3]);
+}
+
+void TestTube::max_min01() {
+	Tube x=tube();
+	Interval h=naive_hull(x,0,n-1);
+	TEST_ASSERT(x.max()==h.ub());
+	TEST_ASSERT(x.min()==h.lb());
+
+	x.set(10,Interval(-1,POS_INFINITY));
+	TEST_ASSERT(x.max()==POS_INFINITY);
+}
+
+void TestTube::integral01() {
+	Tube x=tube();
+	for (int kmin=0; kmin<n; kmin++)
+		for (int kmax=kmin; kmax<n; kmax++)
+			TEST_ASSERT(x.integral(kmin,kmax)==naive_integral(x,kmin,kmax));
+	TEST_ASSERT(x.integral(5,4)==Interval(0,0));
+}
+
+void TestTube::primitive01() {
+	Tube x=tube();
+	Tube y(x);
+	y.integral();
+	for (int i=0; i<n; i++)
+		TEST_ASSERT(y[i]==naive_integral(x,0,i));
+}
+
+void TestTube::ctcIn01() {
+	Tube x=tube();
+	x.max(); // build the tree
+
+	x.ctcIn(2.0,Interval(0,0.25)); // 5th slice
+	TEST_ASSERT(x[4]==(tube()[4] & Interval(0,0.25)));
+	TEST_ASSERT(x.at(Interval(0,n*dt))==naive_hull(x,0,n-1));
+	TEST_ASSERT(x.integral(0,n-1)==naive_integral(x,0,n-1));
+
+	x.ctcIn(Interval(5,8),Interval(-0.5,0.5)); // slices 10 to 15
+	for (int i=10; i<16; i++)
+		TEST_ASSERT(x[i].is_subset(Interval(-0.5,0.5)));
+	for (int kmin=0; kmin<n; kmin+=3)
+		for (int kmax=kmin; kmax<n; kmax++) {
+			TEST_ASSERT(x.at(Interval(kmin*dt,(kmax+1)*dt))==naive_hull(x,kmin,kmax));
+			TEST_ASSERT(x.integral(kmin,kmax)==naive_integral(x,kmin,kmax));
+		}
+}
+
+void TestTube::ctcInter01() {
+	Tube x=tube();
+	x.max(); // build the tree
+
+	// no slice becomes empty (otherwise, the whole tube is empty)
+	Tube y(0,n*dt,dt);
+	for (int i=0; i<n; i++)
+		y.set(i,x[i].mid()+Interval(-0.125,0.25));
+	Tube z(x);
+	x.ctcInter(y);
+	for (int i=0; i<n; i++)
+		TEST_ASSERT(x[i]==(z[i] & y[i]));
+	TEST_ASSERT(!x.is_empty());
+	for (int kmin=0; kmin<n; kmin+=2)
+		for (int kmax=kmin; kmax<n; kmax++) {
+			TEST_ASSERT(x.at(Interval(kmin*dt,(kmax+1)*dt))==naive_hull(x,kmin,kmax));
+			TEST_ASSERT(x.integral(kmin,kmax)==naive_integral(x,kmin,kmax));
+		}
+	TEST_ASSERT(x.max()==naive_hull(x,0,n-1).ub());
+	TEST_ASSERT(x.min()==naive_hull(x,0,n-1).lb());
+}
+
+void TestTube::write01() {
+	Tube x=tube();
+	x.max(); // build the tree
+
+	// direct write access: the tree is updated
+	x.set(20,Interval(-10,10));
+	TEST_ASSERT(x.max()==10);
+	TEST_ASSERT(x.min()==-10);
+	TEST_ASSERT(x.integral(0,n-1)==naive_integral(x,0,n-1));
+
+	// enlarging a slice is not a contraction
+	x.set(20,Interval(-20,20));
+	TEST_ASSERT(x.max()==20);
+	TEST_ASSERT(x.integral(0,n-1)==naive_integral(x,0,n-1));
+	x.set(20,Interval(0,1));
+	TEST_ASSERT(x.max()==naive_hull(x,0,n-1).ub());
+	TEST_ASSERT(x.min()==naive_hull(x,0,n-1).lb());
+	TEST_ASSERT(x.integral(0,n-1)==naive_integral(x,0,n-1));
+
+	double max=x.max();
+	x+=Interval(1,1);
+	TEST_ASSERT(x.max()==max+1);
+	TEST_ASSERT(x.integral(3,30)==naive_integral(x,3,30));
+}
+
+void TestTube::resample01() {
+	Tube x=tube();
+	Tube y(x);
+	y.resample(3*dt);
+	TEST_ASSERT(y.size()==12);
+	TEST_ASSERT(y.get_delta_t()==3*dt);
+	for (int i=0; i<y.size(); i++)
+		TEST_ASSERT(y[i]==naive_hull(x,3*i,3*i+2));
+	TEST_ASSERT(y.integral(0,11)==naive_integral(y,0,11));
+}
+
+void TestTube::fwdbwd01() {
+	Tube v=deriv();
+	Tube x(0,n*dt,dt);
+	x.ctcIn(0.0,Interval(0,1));
+	Tube y(x);
+	x.ctcFwdBwd(v);
+	naive_fwdbwd(y,v);
+	for (int i=0; i<n; i++)
+		TEST_ASSERT(x[i]==y[i]);
+	TEST_ASSERT(!x[n-1].is_unbounded());
+
+	// only the neighborhood of the 20th slice is affected
+	x.ctcIn(10.0,x[20].lb()+Interval(0.25,0.5));
+	y=x;
+	x.ctcFwdBwd(v);
+	naive_fwdbwd(y,v);
+	for (int i=0; i<n; i++)
+		TEST_ASSERT(x[i]==y[i]);
+	TEST_ASSERT(x[0]==Interval(0.25,0.5));
+}
+
+void TestTube::fwdbwd02() {
+	Tube v=deriv();
+	Tube x(0,n*dt,dt);
+	x.ctcIn(0.0,Interval(0,1));
+	x.ctcFwdBwd(v);
+
+	// reading the slices does not mark them as modified
+	for (int i=0; i<n; i++) x[i].mid();
+
+	// two separate modifications, through the write access
+	x.set(5,x[5] & (x[5].lb()+Interval(0,0.5)));
+	x.set(30,x[30] & (x[30].lb()+Interval(0.25,1)));
+	Tube y(x);
+	x.ctcFwd(v);
+	x.ctcBwd(v);
+	naive_fwdbwd(y,v);
+	for (int i=0; i<n; i++)
+		TEST_ASSERT(x[i]==y[i]);
+	TEST_ASSERT(x[0]==Interval(0.25,0.5));
+}
+
+void TestTube::fwdbwd_fnc01() {
+	Variable t;
+	Function f(t,t);
+
+	Tube v(0,n*dt,dt,f);
+	for (int i=0; i<n; i++)
+		TEST_ASSERT(v[i]==Interval(i*dt,(i+1)*dt));
+
+	Tube x(0,n*dt,dt);
+	x.ctcIn(0.0,Interval(0,1));
+	Tube y(x);
+	x.ctcFwdBwd(f);
+	y.ctcFwdBwd(v);
+	for (int i=0; i<n; i++)
+		TEST_ASSERT(x[i]==y[i]);
+
+	// the values of f are reused
+	x.ctcIn(10.0,x[20].mid());
+	y.ctcIn(10.0,y[20].mid());
+	x.ctcFwdBwd(f);
+	y.ctcFwdBwd(v);
+	for (int i=0; i<n; i++)
+		TEST_ASSERT(x[i]==y[i]);
+
+	// ... until the time discretization changes
+	Tube x2(0,n*dt,2*dt);
+	x2.ctcIn(0.0,Interval(0,1));
+	Tube y2(x2);
+	x2.ctcFwd(f);
+	y2.ctcFwd(Tube(0,n*dt,2*dt,f));
+	for (int i=0; i<x2.size(); i++)
+		TEST_ASSERT(x2[i]==y2[i]);
+	x.resample(2*dt);
+	y.resample(2*dt);
+	x.ctcBwd(f);
+	y.ctcBwd(Tube(0,x.get_tF(),2*dt,f));
+	for (int i=0; i<x.size(); i++)
+		TEST_ASSERT(x[i]==y[i]);
+}
+
+} // namespace ibex
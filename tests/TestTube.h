@@ -0,0 +1,53 @@
+/* ============================================================================
+ * I B E X - Tube Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 19, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_TUBE_H__
+#define __TEST_TUBE_H__
+
+#include "cpptest.h"
+#include "ibex_Tube.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestTube : public TestIbex {
+
+public:
+	TestTube() {
+
+		TEST_ADD(TestTube::at01);
+		TEST_ADD(TestTube::max_min01);
+		TEST_ADD(TestTube::integral01);
+		TEST_ADD(TestTube::primitive01);
+		TEST_ADD(TestTube::ctcIn01);
+		TEST_ADD(TestTube::ctcInter01);
+		TEST_ADD(TestTube::write01);
+		TEST_ADD(TestTube::resample01);
+		TEST_ADD(TestTube::fwdbwd01);
+		TEST_ADD(TestTube::fwdbwd02);
+		TEST_ADD(TestTube::fwdbwd_fnc01);
+	}
+
+	void at01();
+	void max_min01();
+	void integral01();
+	void primitive01();
+	void ctcIn01();
+	void ctcInter01();
+	void write01();
+	void resample01();
+	void fwdbwd01();
+	void fwdbwd02();
+	void fwdbwd_fnc01();
+};
+
+} // namespace ibex
+#endif // __TEST_TUBE_H__
@@ -24,31 +24,37 @@
 #include "TestDim.h"
 #include "TestArith.h"
 #include "TestInnerArith.h"
+#include "TestTube.h"
 #include "TestAffine2.h"
 //#include "TestDomain.h"
 
 // ================ symbolic ===============
 #include "TestExpr.h"
 #include "TestExprCopy.h"
+#include "TestExprSimplify.h"
 #include "TestExprDiff.h"
 #include "TestExprSplitOcc.h"
 #include "TestFunction.h"
+#include "TestParallelFnc.h"
 #include "TestNumConstraint.h"
 #include "TestEval.h"
 #include "TestGradient.h"
 #include "TestHC4Revise.h"
+#include "TestMultiBoxHC4Revise.h"
 #include "TestInHC4Revise.h"
 #include "TestHC4.h"
 
 // ================ parser ===============
 #include "TestParser.h"
 #include "TestSystem.h"
+#include "TestSystemCache.h"
 
 // ================ system ===============
 #include "TestFritzJohn.h"
 
 // ================ numeric ===============
 #include "TestLinear.h"
+#include "TestLinearRelax.h"
 #include "TestNewton.h"
 
 // ================ predicates ===============
@@ -60,6 +66,19 @@
 //#include "TestCtcSubBox.h"
 #include "TestCtcNotIn.h"
 #include "TestCtcExist.h"
+#include "TestCtcAdaptive.h"
+#include "TestCtcFixPoint.h"
+#include "TestCtcMohc.h"
+
+// ================ strategy ===============
+#include "TestSetImage.h"
+#include "TestPaver.h"
+#include "TestPaving.h"
+#include "TestSolutionClusters.h"
+#include "TestCellHybrid.h"
+#include "TestCellDoubleHeap.h"
+#include "TestBlockSolver.h"
+#include "TestSolverOutput.h"
 
 #include "TestAffine2.h"
 
@@ -84,26 +103,32 @@ int main() {
     ts.add(auto_ptr<Test::Suite>(new TestDim()));
     ts.add(auto_ptr<Test::Suite>(new TestArith()));
     ts.add(auto_ptr<Test::Suite>(new TestInnerArith()));
+    ts.add(auto_ptr<Test::Suite>(new TestTube()));
     //ts.add(auto_ptr<Test::Suite>(new TestDomain()));
 
     ts.add(auto_ptr<Test::Suite>(new TestAffine2()));
 
     ts.add(auto_ptr<Test::Suite>(new TestExpr()));
     ts.add(auto_ptr<Test::Suite>(new TestExprCopy()));
+    ts.add(auto_ptr<Test::Suite>(new TestExprSimplify()));
     ts.add(auto_ptr<Test::Suite>(new TestExprDiff()));
     ts.add(auto_ptr<Test::Suite>(new TestExprSplitOcc()));
     ts.add(auto_ptr<Test::Suite>(new TestFunction()));
+    ts.add(auto_ptr<Test::Suite>(new TestParallelFnc()));
     ts.add(auto_ptr<Test::Suite>(new TestNumConstraint()));
     ts.add(auto_ptr<Test::Suite>(new TestEval()));
 
     ts.add(auto_ptr<Test::Suite>(new TestParser()));
     ts.add(auto_ptr<Test::Suite>(new TestSystem()));
+    ts.add(auto_ptr<Test::Suite>(new TestSystemCache()));
 
     ts.add(auto_ptr<Test::Suite>(new TestHC4Revise()));
+    ts.add(auto_ptr<Test::Suite>(new TestMultiBoxHC4Revise()));
     ts.add(auto_ptr<Test::Suite>(new TestInHC4Revise()));
     ts.add(auto_ptr<Test::Suite>(new TestGradient()));
 
     ts.add(auto_ptr<Test::Suite>(new TestLinear()));
+    ts.add(auto_ptr<Test::Suite>(new TestLinearRelax()));
     ts.add(auto_ptr<Test::Suite>(new TestNewton()));
 
     ts.add(auto_ptr<Test::Suite>(new TestPdcHansenFeasibility()));
@@ -112,8 +137,20 @@ int main() {
     ts.add(auto_ptr<Test::Suite>(new TestCtcInteger()));
     ts.add(auto_ptr<Test::Suite>(new TestCtcNotIn()));
     ts.add(auto_ptr<Test::Suite>(new TestCtcExist()));
+    ts.add(auto_ptr<Test::Suite>(new TestCtcAdaptive()));
+    ts.add(auto_ptr<Test::Suite>(new TestCtcFixPoint()));
+    ts.add(auto_ptr<Test::Suite>(new TestCtcMohc()));
     ts.add(auto_ptr<Test::Suite>(new TestFritzJohn()));
 
+    ts.add(auto_ptr<Test::Suite>(new TestSetImage()));
+    ts.add(auto_ptr<Test::Suite>(new TestPaver()));
+    ts.add(auto_ptr<Test::Suite>(new TestPaving()));
+    ts.add(auto_ptr<Test::Suite>(new TestSolutionClusters()));
+    ts.add(auto_ptr<Test::Suite>(new TestCellHybrid()));
+    ts.add(auto_ptr<Test::Suite>(new TestCellDoubleHeap()));
+    ts.add(auto_ptr<Test::Suite>(new TestBlockSolver()));
+    ts.add(auto_ptr<Test::Suite>(new TestSolverOutput()));
+
     return ts.run(output,false) ? EXIT_SUCCESS : EXIT_FAILURE;
 
 }